@@ -0,0 +1,126 @@
+#include <anira/InferenceConfig.h>
+#include <anira/PrePostProcessor.h>
+#include <anira/utils/Buffer.h>
+#include <anira/utils/InferenceBackend.h>
+#include <anira/utils/RingBuffer.h>
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace anira;
+
+namespace {
+
+// The processor only needs a configuration to be constructed, the helpers work on any shapes
+InferenceConfig make_config(size_t num_channels, size_t num_samples) {
+    auto const channels = static_cast<int64_t>(num_channels);
+    auto const samples = static_cast<int64_t>(num_samples);
+    return InferenceConfig(
+        std::vector<ModelData>{ModelData("placeholder", InferenceBackend::CUSTOM)},
+        std::vector<TensorShape>{TensorShape({{1, channels, samples}}, {{1, channels, samples}})},
+        1.f);
+}
+
+}  // namespace
+
+// Extracts new samples plus overlapping past samples from the send buffer into a tensor
+static void BM_PopSamplesFromBufferWithOverlap(::benchmark::State& state) {
+    auto const num_channels = static_cast<size_t>(state.range(0));
+    auto const num_new_samples = static_cast<size_t>(state.range(1));
+    auto const num_old_samples = static_cast<size_t>(state.range(2));
+    size_t const num_total_samples = num_new_samples + num_old_samples;
+
+    InferenceConfig config = make_config(num_channels, num_total_samples);
+    PrePostProcessor pp_processor(config);
+
+    // The ring buffer keeps at least num_old_samples already read samples behind the read position
+    RingBuffer input;
+    input.initialize_with_positions(num_channels, num_total_samples + num_new_samples);
+    for (size_t channel = 0; channel < num_channels; ++channel) {
+        for (size_t sample = 0; sample < num_total_samples; ++sample) {
+            input.push_sample(channel, static_cast<float>(sample));
+            input.pop_sample(channel);
+        }
+    }
+    BufferF output(1, num_channels * num_total_samples);
+
+    for (auto _ : state) {
+        for (size_t channel = 0; channel < num_channels; ++channel) {
+            for (size_t sample = 0; sample < num_new_samples; ++sample) {
+                input.push_sample(channel, static_cast<float>(sample));
+            }
+        }
+        pp_processor.pop_samples_from_buffer(input, output, num_new_samples, num_old_samples);
+        ::benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(num_channels * num_total_samples));
+}
+
+// Extracts a batch of windows advancing by a hop each, e.g. one window per predicted sample of
+// a model with a large receptive field
+static void BM_PopWindowsFromBuffer(::benchmark::State& state) {
+    auto const num_windows = static_cast<size_t>(state.range(0));
+    auto const window_size = static_cast<size_t>(state.range(1));
+    constexpr size_t k_hop_size = 1;
+    size_t const num_new_samples = num_windows * k_hop_size;
+
+    InferenceConfig config = make_config(1, window_size);
+    PrePostProcessor pp_processor(config);
+
+    RingBuffer input;
+    input.initialize_with_positions(1, window_size + num_new_samples);
+    for (size_t sample = 0; sample < window_size; ++sample) {
+        input.push_sample(0, static_cast<float>(sample));
+        input.pop_sample(0);
+    }
+    BufferF output(1, num_windows * window_size);
+
+    for (auto _ : state) {
+        for (size_t sample = 0; sample < num_new_samples; ++sample) {
+            input.push_sample(0, static_cast<float>(sample));
+        }
+        pp_processor.pop_windows_from_buffer(input, output, num_windows, window_size, k_hop_size);
+        ::benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_windows * window_size));
+}
+
+// Writes a tensor back into the receive buffer
+static void BM_PushSamplesToBuffer(::benchmark::State& state) {
+    auto const num_channels = static_cast<size_t>(state.range(0));
+    auto const num_samples = static_cast<size_t>(state.range(1));
+
+    InferenceConfig config = make_config(num_channels, num_samples);
+    PrePostProcessor pp_processor(config);
+
+    BufferF input(1, num_channels * num_samples);
+    RingBuffer output;
+    output.initialize_with_positions(num_channels, num_samples * 2);
+
+    float sum = 0.f;
+    for (auto _ : state) {
+        pp_processor.push_samples_to_buffer(input, output, num_samples);
+        for (size_t channel = 0; channel < num_channels; ++channel) {
+            for (size_t sample = 0; sample < num_samples; ++sample) {
+                sum += output.pop_sample(channel);
+            }
+        }
+        ::benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_channels * num_samples));
+}
+
+BENCHMARK(BM_PopSamplesFromBufferWithOverlap)
+    ->ArgNames({"channels", "new", "old"})
+    ->ArgsProduct({{1, 2}, {64, 512, 2048}, {0, 512, 13332}});
+
+BENCHMARK(BM_PopWindowsFromBuffer)
+    ->ArgNames({"windows", "window"})
+    ->ArgsProduct({{64, 256}, {150, 1024}});
+
+BENCHMARK(BM_PushSamplesToBuffer)
+    ->ArgNames({"channels", "block"})
+    ->ArgsProduct({{1, 2, 8}, {64, 512, 4096}});
@@ -0,0 +1,53 @@
+#include <anira/scheduler/Context.h>
+#include <anira/scheduler/SessionElement.h>
+#include <benchmark/benchmark.h>
+#include <concurrentqueue.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+using namespace anira;
+
+namespace {
+
+// Same queue type and preallocation as the static inference queue of the Context
+moodycamel::ConcurrentQueue<InferenceData>& get_queue() {
+    static moodycamel::ConcurrentQueue<InferenceData> queue(
+        Context::k_min_capacity_inference_queue,
+        0,
+        Context::k_max_num_instances);
+    return queue;
+}
+
+}  // namespace
+
+// Enqueue from the benchmark threads and dequeue in the same thread. With several threads this
+// shows the contention between sessions submitting and inference threads dequeuing.
+static void BM_InferenceQueueRoundTrip(::benchmark::State& state) {
+    auto& queue = get_queue();
+    auto const batch_size = static_cast<size_t>(state.range(0));
+
+    moodycamel::ProducerToken producer_token(queue);
+    moodycamel::ConsumerToken consumer_token(queue);
+    // A real struct, so the reference counting of the shared pointers is part of the measurement
+    auto const thread_safe_struct = std::make_shared<SessionElement::ThreadSafeStruct>(
+        std::vector<size_t>{512},
+        std::vector<size_t>{512});
+    InferenceData data;
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < batch_size; ++i) {
+            queue.try_enqueue(producer_token, InferenceData{nullptr, thread_safe_struct});
+        }
+        for (size_t i = 0; i < batch_size; ++i) {
+            if (!queue.try_dequeue(consumer_token, data)) {
+                // Another thread took the element, take one of its elements instead
+                queue.try_dequeue(data);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch_size));
+}
+
+BENCHMARK(BM_InferenceQueueRoundTrip)->ArgName("batch")->Arg(1)->Arg(16)->ThreadRange(1, 8);
@@ -0,0 +1,98 @@
+#include <anira/utils/Buffer.h>
+#include <anira/utils/MemoryBlock.h>
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+using namespace anira;
+
+// Sample-wise writes through the accessor, the way the pre- and post-processors fill tensors
+static void BM_BufferSetSample(::benchmark::State& state) {
+    auto const num_channels = static_cast<size_t>(state.range(0));
+    auto const block_size = static_cast<size_t>(state.range(1));
+
+    Buffer<float> buffer(num_channels, block_size);
+    for (auto _ : state) {
+        for (size_t channel = 0; channel < num_channels; ++channel) {
+            for (size_t sample = 0; sample < block_size; ++sample) {
+                buffer.set_sample(channel, sample, static_cast<float>(sample));
+            }
+        }
+        ::benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(num_channels * block_size * sizeof(float)));
+}
+
+// Block copy between two buffers through the channel pointers
+static void BM_BufferCopyChannels(::benchmark::State& state) {
+    auto const num_channels = static_cast<size_t>(state.range(0));
+    auto const block_size = static_cast<size_t>(state.range(1));
+
+    Buffer<float> source(num_channels, block_size);
+    Buffer<float> destination(num_channels, block_size);
+    for (auto _ : state) {
+        for (size_t channel = 0; channel < num_channels; ++channel) {
+            std::memcpy(destination.get_write_pointer(channel),
+                        source.get_read_pointer(channel),
+                        block_size * sizeof(float));
+        }
+        ::benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(num_channels * block_size * sizeof(float)));
+}
+
+static void BM_BufferClear(::benchmark::State& state) {
+    auto const num_channels = static_cast<size_t>(state.range(0));
+    auto const block_size = static_cast<size_t>(state.range(1));
+
+    Buffer<float> buffer(num_channels, block_size);
+    for (auto _ : state) {
+        buffer.clear();
+        ::benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(num_channels * block_size * sizeof(float)));
+}
+
+// Swapping is how the inference threads hand over tensors without copying
+static void BM_BufferSwapData(::benchmark::State& state) {
+    auto const num_channels = static_cast<size_t>(state.range(0));
+    auto const block_size = static_cast<size_t>(state.range(1));
+
+    Buffer<float> first(num_channels, block_size);
+    Buffer<float> second(num_channels, block_size);
+    for (auto _ : state) {
+        first.swap_data(second);
+        ::benchmark::DoNotOptimize(first.data());
+    }
+}
+
+// Allocating copy, must never happen on the audio thread but shows the cost of doing so
+static void BM_MemoryBlockCopy(::benchmark::State& state) {
+    auto const size = static_cast<size_t>(state.range(0));
+
+    MemoryBlock<float> block(size);
+    for (auto _ : state) {
+        MemoryBlock<float> copy(block);
+        ::benchmark::DoNotOptimize(copy.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(size * sizeof(float)));
+}
+
+BENCHMARK(BM_BufferSetSample)
+    ->ArgNames({"channels", "block"})
+    ->ArgsProduct({{1, 2, 8}, {64, 512, 4096}});
+
+BENCHMARK(BM_BufferCopyChannels)
+    ->ArgNames({"channels", "block"})
+    ->ArgsProduct({{1, 2, 8}, {64, 512, 4096}});
+
+BENCHMARK(BM_BufferClear)->ArgNames({"channels", "block"})->ArgsProduct({{1, 2, 8}, {64, 512, 4096}});
+
+BENCHMARK(BM_BufferSwapData)->ArgNames({"channels", "block"})->ArgsProduct({{1, 8}, {512}});
+
+BENCHMARK(BM_MemoryBlockCopy)->ArgName("size")->RangeMultiplier(8)->Range(64, 32768);
@@ -0,0 +1,62 @@
+#include <anira/utils/FFT.h>
+#include <anira/utils/SpectralSpec.h>
+#include <anira/utils/SpectralTransform.h>
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace anira;
+
+// Transforms one frame, the work of every frame of the spectral stage
+static void BM_FFTForward(::benchmark::State& state) {
+    auto const size = static_cast<size_t>(state.range(0));
+
+    FFT fft;
+    fft.prepare(size);
+    std::vector<float> input(size);
+    for (size_t n = 0; n < size; ++n) { input[n] = static_cast<float>(n % 64) / 64.f; }
+    std::vector<float> real(size / 2 + 1);
+    std::vector<float> imag(size / 2 + 1);
+
+    for (auto _ : state) {
+        fft.forward(input.data(), real.data(), imag.data());
+        ::benchmark::DoNotOptimize(real.data());
+        ::benchmark::DoNotOptimize(imag.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+BENCHMARK(BM_FFTForward)->ArgName("size")->RangeMultiplier(4)->Range(64, 4096);
+
+// Analyzes and synthesizes the frames of one inference, the work of the inference thread
+static void BM_SpectralTransformRoundTrip(::benchmark::State& state) {
+    auto const feature = static_cast<SpectralFeature>(state.range(0));
+    constexpr size_t k_fft_size = 1024;
+    constexpr size_t k_hop_size = 256;
+    constexpr size_t k_num_samples = 2048;
+
+    SpectralTransform analysis;
+    analysis.prepare({feature, k_fft_size, k_hop_size, 80}, 1, k_num_samples, 48000.f);
+    SpectralTransform synthesis;
+    synthesis.prepare({COMPLEX_SPECTRUM, k_fft_size, k_hop_size}, 1, k_num_samples, 48000.f);
+    std::vector<float> signal(analysis.get_signal_size());
+    for (size_t n = 0; n < signal.size(); ++n) { signal[n] = static_cast<float>(n % 64) / 64.f; }
+    std::vector<float> features(analysis.get_feature_size());
+    std::vector<float> spectra(synthesis.get_feature_size());
+    std::vector<float> output(synthesis.get_signal_size());
+    std::vector<float> work(synthesis.get_work_size());
+
+    for (auto _ : state) {
+        analysis.analyze(signal.data(), features.data(), work.data());
+        synthesis.synthesize(spectra.data(), output.data(), work.data());
+        ::benchmark::DoNotOptimize(features.data());
+        ::benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(k_num_samples));
+}
+
+BENCHMARK(BM_SpectralTransformRoundTrip)
+    ->ArgName("feature")
+    ->DenseRange(COMPLEX_SPECTRUM, LOG_MEL_SPECTRUM);
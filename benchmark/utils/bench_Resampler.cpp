@@ -0,0 +1,40 @@
+#include <anira/utils/Buffer.h>
+#include <anira/utils/Resampler.h>
+#include <anira/utils/ResamplerQuality.h>
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace anira;
+
+// Resamples one host block from 44.1 kHz to 48 kHz per channel, the work of the send side
+static void BM_ResamplerProcess(::benchmark::State& state) {
+    auto const quality = static_cast<ResamplerQuality>(state.range(0));
+    auto const block_size = static_cast<size_t>(state.range(1));
+    constexpr size_t k_num_channels = 2;
+
+    Resampler resampler;
+    resampler.prepare(k_num_channels, 44100., 48000., quality, block_size);
+    BufferF input(k_num_channels, block_size);
+    BufferF output(k_num_channels, resampler.get_max_num_output_samples(block_size));
+    for (size_t channel = 0; channel < k_num_channels; ++channel) {
+        for (size_t sample = 0; sample < block_size; ++sample) {
+            input.set_sample(channel, sample, static_cast<float>(sample % 64) / 64.f);
+        }
+    }
+
+    for (auto _ : state) {
+        size_t const num_output_samples = resampler.process(input.get_array_of_read_pointers(),
+                                                            block_size,
+                                                            output.get_array_of_write_pointers(),
+                                                            output.get_num_samples());
+        ::benchmark::DoNotOptimize(num_output_samples);
+        ::benchmark::DoNotOptimize(output.get_read_pointer(0));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(k_num_channels * block_size));
+}
+
+BENCHMARK(BM_ResamplerProcess)
+    ->ArgNames({"quality", "block"})
+    ->ArgsProduct({{LOW_QUALITY, MEDIUM_QUALITY, HIGH_QUALITY}, {64, 512, 4096}});
@@ -0,0 +1,99 @@
+#include <anira/utils/MirroredRingBuffer.h>
+#include <anira/utils/RingBuffer.h>
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace anira;
+
+// Pushes and pops one block per channel, the pattern of the audio thread in process()
+static void BM_RingBufferPushPop(::benchmark::State& state) {
+    auto const num_channels = static_cast<size_t>(state.range(0));
+    auto const block_size = static_cast<size_t>(state.range(1));
+
+    RingBuffer ring_buffer;
+    ring_buffer.initialize_with_positions(num_channels, block_size * 4);
+
+    float sum = 0.f;
+    for (auto _ : state) {
+        for (size_t channel = 0; channel < num_channels; ++channel) {
+            for (size_t sample = 0; sample < block_size; ++sample) {
+                ring_buffer.push_sample(channel, static_cast<float>(sample));
+            }
+        }
+        for (size_t channel = 0; channel < num_channels; ++channel) {
+            for (size_t sample = 0; sample < block_size; ++sample) {
+                sum += ring_buffer.pop_sample(channel);
+            }
+        }
+        ::benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_channels * block_size));
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(num_channels * block_size * sizeof(float) * 2));
+}
+
+// Reads a block of past samples, as done for overlapping model inputs
+static void BM_RingBufferPastSamples(::benchmark::State& state) {
+    auto const num_channels = static_cast<size_t>(state.range(0));
+    auto const block_size = static_cast<size_t>(state.range(1));
+
+    RingBuffer ring_buffer;
+    ring_buffer.initialize_with_positions(num_channels, block_size * 2);
+    for (size_t channel = 0; channel < num_channels; ++channel) {
+        for (size_t sample = 0; sample < block_size; ++sample) {
+            ring_buffer.push_sample(channel, static_cast<float>(sample));
+            ring_buffer.pop_sample(channel);
+        }
+    }
+
+    float sum = 0.f;
+    for (auto _ : state) {
+        for (size_t channel = 0; channel < num_channels; ++channel) {
+            for (size_t offset = 1; offset <= block_size; ++offset) {
+                sum += ring_buffer.get_past_sample(channel, offset);
+            }
+        }
+        ::benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_channels * block_size));
+}
+
+// Pushes a block and reads a window of past and new samples in place, the access pattern of
+// models with overlapping inputs
+static void BM_MirroredRingBufferWindow(::benchmark::State& state) {
+    auto const num_channels = static_cast<size_t>(state.range(0));
+    auto const block_size = static_cast<size_t>(state.range(1));
+    size_t const window_size = block_size * 4;
+
+    MirroredRingBuffer ring_buffer;
+    ring_buffer.initialize(num_channels, window_size + block_size);
+    std::vector<float> const block(block_size, 0.5f);
+
+    float sum = 0.f;
+    for (auto _ : state) {
+        for (size_t channel = 0; channel < num_channels; ++channel) {
+            ring_buffer.push_samples(channel, block.data(), block_size);
+            const float* window =
+                ring_buffer.get_window(channel, block_size, window_size - block_size);
+            sum += window[0] + window[window_size - 1];
+            ring_buffer.advance(channel, block_size);
+        }
+        ::benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_channels * block_size));
+}
+
+BENCHMARK(BM_RingBufferPushPop)
+    ->ArgNames({"channels", "block"})
+    ->ArgsProduct({{1, 2, 8}, {64, 512, 4096}});
+
+BENCHMARK(BM_RingBufferPastSamples)
+    ->ArgNames({"channels", "block"})
+    ->ArgsProduct({{1, 2, 8}, {64, 512, 4096}});
+
+BENCHMARK(BM_MirroredRingBufferWindow)
+    ->ArgNames({"channels", "block"})
+    ->ArgsProduct({{1, 2, 8}, {64, 512, 4096}});
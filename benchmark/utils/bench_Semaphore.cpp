@@ -0,0 +1,46 @@
+#include <anira/utils/Semaphore.h>
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace anira;
+
+// Uncontended release and try_acquire, the fast path used on every inference
+static void BM_SemaphoreReleaseTryAcquire(::benchmark::State& state) {
+    Semaphore semaphore(0);
+    for (auto _ : state) {
+        semaphore.release();
+        ::benchmark::DoNotOptimize(semaphore.try_acquire());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Round trip between two threads that block on each other, measures the wake-up latency that an
+// inference thread adds when it signals a waiting audio thread
+static void BM_SemaphorePingPong(::benchmark::State& state) {
+    Semaphore ping(0);
+    Semaphore pong(0);
+    std::atomic<bool> running{true};
+
+    std::thread partner([&] {
+        while (true) {
+            ping.acquire();
+            if (!running.load(std::memory_order_acquire)) { break; }
+            pong.release();
+        }
+    });
+
+    for (auto _ : state) {
+        ping.release();
+        pong.acquire();
+    }
+
+    running.store(false, std::memory_order_release);
+    ping.release();
+    partner.join();
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_SemaphoreReleaseTryAcquire);
+BENCHMARK(BM_SemaphorePingPong)->UseRealTime();
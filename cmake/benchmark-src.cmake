@@ -5,8 +5,12 @@
 target_sources(${PROJECT_NAME}
     PRIVATE
         # TODO: find out why we need to add the header files here, so that they can find the <benchmark/benchmark.h> and <gtest/gtest.h> files
+        include/anira/benchmark/BenchmarkReporter.h
         include/anira/benchmark/ProcessBlockFixture.h
+        include/anira/benchmark/RealtimeHarness.h
+        src/benchmark/BenchmarkReporter.cpp
         src/benchmark/ProcessBlockFixture.cpp
+        src/benchmark/RealtimeHarness.cpp
 )
 
 # This disables the default behavior of adding all targets to the CTest dashboard.
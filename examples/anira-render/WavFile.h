@@ -0,0 +1,182 @@
+#ifndef ANIRA_RENDER_WAV_FILE_H
+#define ANIRA_RENDER_WAV_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Reads and writes 32-bit IEEE float WAV files. The reader checks every chunk size against the
+// file, so truncated or foreign files are reported instead of being reinterpreted.
+namespace wav {
+
+constexpr uint16_t k_format_ieee_float = 3;
+constexpr uint16_t k_format_extensible = 0xFFFE;
+constexpr uint32_t k_fmt_size = 16;
+constexpr uint32_t k_fmt_extensible_size = 40;
+
+namespace detail {
+
+inline bool read_u16(std::istream& stream, uint16_t& value) {
+    unsigned char bytes[2];
+    if (!stream.read(reinterpret_cast<char*>(bytes), sizeof(bytes))) { return false; }
+    value = static_cast<uint16_t>(bytes[0] | (bytes[1] << 8));
+    return true;
+}
+
+inline bool read_u32(std::istream& stream, uint32_t& value) {
+    unsigned char bytes[4];
+    if (!stream.read(reinterpret_cast<char*>(bytes), sizeof(bytes))) { return false; }
+    value = static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+            (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+    return true;
+}
+
+inline void write_u16(std::ostream& stream, uint16_t value) {
+    char const bytes[2] = {static_cast<char>(value & 0xFF), static_cast<char>(value >> 8)};
+    stream.write(bytes, sizeof(bytes));
+}
+
+inline void write_u32(std::ostream& stream, uint32_t value) {
+    char const bytes[4] = {static_cast<char>(value & 0xFF),
+                           static_cast<char>((value >> 8) & 0xFF),
+                           static_cast<char>((value >> 16) & 0xFF),
+                           static_cast<char>((value >> 24) & 0xFF)};
+    stream.write(bytes, sizeof(bytes));
+}
+
+inline bool fail(const std::string& path, const std::string& reason) {
+    std::cerr << path << ": " << reason << std::endl;
+    return false;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Reads the interleaved samples of a 32-bit IEEE float WAV file
+ *
+ * Accepts WAVE_FORMAT_IEEE_FLOAT and WAVE_FORMAT_EXTENSIBLE with a float subformat. Any other
+ * format, e.g. 16 or 24-bit PCM, and chunks that exceed the file are rejected with an error on
+ * std::cerr.
+ *
+ * @return True if the file was read, false otherwise
+ */
+inline bool read_wav(const std::string& path,
+                     std::vector<float>& data,
+                     uint32_t& sample_rate,
+                     uint16_t& num_channels) {
+    std::ifstream ifs{path, std::ios_base::binary | std::ios_base::ate};
+    if (!ifs) { return detail::fail(path, "cannot open file"); }
+    auto const file_size = static_cast<uint64_t>(ifs.tellg());
+    ifs.seekg(0);
+
+    char riff_id[4];
+    char wave_id[4];
+    uint32_t riff_size = 0;
+    if (!ifs.read(riff_id, 4) || !detail::read_u32(ifs, riff_size) || !ifs.read(wave_id, 4) ||
+        std::memcmp(riff_id, "RIFF", 4) != 0 || std::memcmp(wave_id, "WAVE", 4) != 0) {
+        return detail::fail(path, "not a RIFF/WAVE file");
+    }
+
+    bool fmt_read = false;
+    uint16_t format = 0;
+    uint16_t bits_per_sample = 0;
+    uint16_t block_align = 0;
+    char chunk_id[4];
+    uint32_t chunk_size = 0;
+    while (ifs.read(chunk_id, 4) && detail::read_u32(ifs, chunk_size)) {
+        auto const chunk_start = static_cast<uint64_t>(ifs.tellg());
+        if (chunk_size > file_size - chunk_start) {
+            return detail::fail(path, "chunk exceeds the end of the file");
+        }
+
+        if (std::memcmp(chunk_id, "fmt ", 4) == 0) {
+            uint32_t byte_rate = 0;
+            if (chunk_size < k_fmt_size || !detail::read_u16(ifs, format) ||
+                !detail::read_u16(ifs, num_channels) || !detail::read_u32(ifs, sample_rate) ||
+                !detail::read_u32(ifs, byte_rate) || !detail::read_u16(ifs, block_align) ||
+                !detail::read_u16(ifs, bits_per_sample)) {
+                return detail::fail(path, "malformed fmt chunk");
+            }
+            if (format == k_format_extensible) {
+                // cbSize, valid bits and channel mask precede the subformat GUID, whose first two
+                // bytes are the format code
+                uint16_t extension_size = 0;
+                uint16_t valid_bits = 0;
+                uint32_t channel_mask = 0;
+                if (chunk_size < k_fmt_extensible_size || !detail::read_u16(ifs, extension_size) ||
+                    !detail::read_u16(ifs, valid_bits) || !detail::read_u32(ifs, channel_mask) ||
+                    !detail::read_u16(ifs, format)) {
+                    return detail::fail(path, "malformed extensible fmt chunk");
+                }
+            }
+            fmt_read = true;
+        } else if (std::memcmp(chunk_id, "data", 4) == 0) {
+            if (!fmt_read) { return detail::fail(path, "data chunk before fmt chunk"); }
+            if (format != k_format_ieee_float || bits_per_sample != 32) {
+                return detail::fail(path,
+                                    "unsupported sample format " + std::to_string(format) + " (" +
+                                        std::to_string(bits_per_sample) +
+                                        " bit), only 32-bit IEEE float is supported");
+            }
+            if (num_channels == 0 || sample_rate == 0 ||
+                block_align != num_channels * sizeof(float)) {
+                return detail::fail(path, "inconsistent fmt chunk");
+            }
+            size_t const num_frames = chunk_size / block_align;
+            data.resize(num_frames * num_channels);
+            if (!ifs.read(reinterpret_cast<char*>(data.data()),
+                          static_cast<std::streamsize>(data.size() * sizeof(float)))) {
+                return detail::fail(path, "truncated data chunk");
+            }
+            return true;
+        }
+
+        // Chunks are padded to an even size
+        ifs.seekg(static_cast<std::streamoff>(chunk_start + chunk_size + (chunk_size & 1)));
+    }
+    return detail::fail(path, fmt_read ? "no data chunk" : "no fmt chunk");
+}
+
+/**
+ * @brief Writes interleaved samples as a 32-bit IEEE float WAV file
+ *
+ * @return True if the file was written, false otherwise
+ */
+inline bool write_wav(const std::string& path,
+                      const std::vector<float>& data,
+                      uint16_t num_channels,
+                      uint32_t sample_rate) {
+    std::ofstream ofs{path, std::ios_base::binary};
+    if (!ofs) { return detail::fail(path, "cannot open file"); }
+
+    auto const data_size = static_cast<uint32_t>(data.size() * sizeof(float));
+    auto const block_align = static_cast<uint16_t>(num_channels * sizeof(float));
+
+    ofs.write("RIFF", 4);
+    detail::write_u32(ofs, 4 + 8 + k_fmt_size + 8 + data_size);
+    ofs.write("WAVE", 4);
+
+    ofs.write("fmt ", 4);
+    detail::write_u32(ofs, k_fmt_size);
+    detail::write_u16(ofs, k_format_ieee_float);
+    detail::write_u16(ofs, num_channels);
+    detail::write_u32(ofs, sample_rate);
+    detail::write_u32(ofs, sample_rate * block_align);
+    detail::write_u16(ofs, block_align);
+    detail::write_u16(ofs, 32);
+
+    ofs.write("data", 4);
+    detail::write_u32(ofs, data_size);
+    ofs.write(reinterpret_cast<const char*>(data.data()), data_size);
+
+    if (!ofs) { return detail::fail(path, "cannot write file"); }
+    return true;
+}
+
+}  // namespace wav
+
+#endif  // ANIRA_RENDER_WAV_FILE_H
@@ -0,0 +1,238 @@
+/* ==========================================================================
+
+anira-render: offline batch renderer for WAV files driven by JSON configs
+
+Usage:
+    anira-render <config.json> <input_dir> <output_dir> [sessions]
+
+Every .wav file in <input_dir> is rendered through the model described by the
+JsonConfigLoader config and written as 32-bit float WAV to <output_dir>. Files
+are distributed over [sessions] InferenceHandler instances that share one
+Context, and the real-time factor (processing time / audio duration) is
+reported per file.
+
+========================================================================== */
+
+#include <anira/anira.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "WavFile.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+struct RenderSession {
+    std::unique_ptr<anira::PrePostProcessor> m_pp_processor;
+    std::unique_ptr<anira::InferenceHandler> m_inference_handler;
+    uint32_t m_prepared_sample_rate = 0;
+};
+
+
+struct RenderResult {
+    bool m_success = false;
+    double m_duration_s = 0.;
+    double m_processing_time_s = 0.;
+};
+
+// Preparing a session drains the inference queue shared by all sessions of the Context, so it
+// holds prepare_mutex exclusively and rendering holds it shared
+RenderResult render_file(RenderSession& session,
+                         std::shared_mutex& prepare_mutex,
+                         const anira::InferenceConfig& inference_config,
+                         const fs::path& input_path,
+                         const fs::path& output_path) {
+    RenderResult result;
+
+    std::vector<float> interleaved_input;
+    uint32_t sample_rate = 0;
+    uint16_t num_file_channels = 0;
+    if (!wav::read_wav(input_path.string(), interleaved_input, sample_rate, num_file_channels)) {
+        return result;
+    }
+
+    size_t const num_input_channels = inference_config.get_preprocess_input_channels()[0];
+    size_t const num_output_channels = inference_config.get_postprocess_output_channels()[0];
+    size_t const input_size = inference_config.get_preprocess_input_size()[0];
+    size_t const output_size = inference_config.get_postprocess_output_size()[0];
+    size_t const num_frames = interleaved_input.size() / num_file_channels;
+    size_t const num_output_frames = num_frames * output_size / input_size;
+    // The output keeps the duration of the input, so its rate scales with the size ratio
+    uint64_t const scaled_sample_rate = static_cast<uint64_t>(sample_rate) * output_size;
+    if (scaled_sample_rate % input_size != 0) {
+        std::cerr << input_path.string() << ": the sample rate " << sample_rate
+                  << " Hz scaled by the output size " << output_size << " / input size "
+                  << input_size << " is not an integer rate" << std::endl;
+        return result;
+    }
+    auto const output_sample_rate = static_cast<uint32_t>(scaled_sample_rate / input_size);
+
+    // Files with fewer channels than the model expects repeat their last channel
+    anira::BufferF input(num_input_channels, num_frames);
+    for (size_t channel = 0; channel < num_input_channels; ++channel) {
+        size_t const file_channel = std::min<size_t>(channel, num_file_channels - 1);
+        for (size_t frame = 0; frame < num_frames; ++frame) {
+            input.set_sample(channel,
+                             frame,
+                             interleaved_input[frame * num_file_channels + file_channel]);
+        }
+    }
+    anira::BufferF output(num_output_channels, num_output_frames);
+
+    if (session.m_prepared_sample_rate != sample_rate) {
+        std::unique_lock<std::shared_mutex> const lock(prepare_mutex);
+        session.m_inference_handler->prepare(
+            anira::HostConfig(static_cast<float>(input_size), static_cast<float>(sample_rate)));
+        session.m_prepared_sample_rate = sample_rate;
+    }
+
+    std::shared_lock<std::shared_mutex> const lock(prepare_mutex);
+    auto const start = std::chrono::steady_clock::now();
+    size_t const rendered =
+        session.m_inference_handler->render(input.get_array_of_read_pointers(),
+                                            num_frames,
+                                            output.get_array_of_write_pointers(),
+                                            num_output_frames);
+    auto const end = std::chrono::steady_clock::now();
+
+    std::vector<float> interleaved_output(rendered * num_output_channels);
+    for (size_t frame = 0; frame < rendered; ++frame) {
+        for (size_t channel = 0; channel < num_output_channels; ++channel) {
+            interleaved_output[frame * num_output_channels + channel] =
+                output.get_sample(channel, frame);
+        }
+    }
+    if (!wav::write_wav(output_path.string(),
+                        interleaved_output,
+                        static_cast<uint16_t>(num_output_channels),
+                        output_sample_rate)) {
+        return result;
+    }
+
+    result.m_success = true;
+    result.m_duration_s = static_cast<double>(num_frames) / sample_rate;
+    result.m_processing_time_s = std::chrono::duration<double>(end - start).count();
+    return result;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 4) {
+        std::cerr << "Usage: " << argv[0] << " <config.json> <input_dir> <output_dir> [sessions]"
+                  << std::endl;
+        return 1;
+    }
+
+    anira::JsonConfigLoader json_config_loader(argv[1]);
+    std::unique_ptr<anira::InferenceConfig> inference_config =
+        json_config_loader.get_inference_config();
+    std::unique_ptr<anira::ContextConfig> context_config =
+        json_config_loader.get_context_config();
+    if (inference_config == nullptr || context_config == nullptr) {
+        std::cerr << "Could not load config " << argv[1] << std::endl;
+        return 1;
+    }
+    // A WAV file holds one stream, so the model must stream one input and one output tensor
+    if (inference_config->get_tensor_input_shape().size() != 1 ||
+        inference_config->get_tensor_output_shape().size() != 1) {
+        std::cerr << "Only models with one input and one output tensor are supported" << std::endl;
+        return 1;
+    }
+    if (inference_config->get_preprocess_input_size()[0] == 0 ||
+        inference_config->get_postprocess_output_size()[0] == 0) {
+        std::cerr << "The input and output tensor must be streamable, their preprocess input and "
+                     "postprocess output sizes must not be 0"
+                  << std::endl;
+        return 1;
+    }
+
+    fs::path const input_dir(argv[2]);
+    fs::path const output_dir(argv[3]);
+    fs::create_directories(output_dir);
+
+    std::vector<fs::path> files;
+    for (const auto& entry : fs::directory_iterator(input_dir)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".wav") {
+            files.push_back(entry.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+    if (files.empty()) {
+        std::cerr << "No .wav files found in " << input_dir << std::endl;
+        return 1;
+    }
+
+    size_t num_sessions = argc > 4 ? std::stoul(argv[4]) : context_config->m_num_threads;
+    num_sessions = std::clamp<size_t>(num_sessions, 1, files.size());
+
+    // Sessions are created up front on the main thread, since registering sessions with the
+    // shared Context is not thread-safe
+    anira::InferenceBackend const backend = inference_config->m_model_data[0].m_backend;
+    std::vector<RenderSession> sessions(num_sessions);
+    for (auto& session : sessions) {
+        session.m_pp_processor = std::make_unique<anira::PrePostProcessor>(*inference_config);
+        session.m_inference_handler = std::make_unique<anira::InferenceHandler>(
+            *session.m_pp_processor,
+            *inference_config,
+            *context_config);
+        session.m_inference_handler->set_inference_backend(backend);
+    }
+
+    std::atomic<size_t> next_file{0};
+    std::mutex print_mutex;
+    std::shared_mutex prepare_mutex;
+    std::atomic<bool> all_succeeded{true};
+    double total_duration_s = 0.;
+    auto const total_start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (auto& session : sessions) {
+        workers.emplace_back([&] {
+            for (size_t i = next_file.fetch_add(1); i < files.size(); i = next_file.fetch_add(1)) {
+                fs::path const output_path = output_dir / files[i].filename();
+                RenderResult const result =
+                    render_file(session, prepare_mutex, *inference_config, files[i], output_path);
+
+                std::lock_guard<std::mutex> const lock(print_mutex);
+                if (!result.m_success) {
+                    all_succeeded.store(false);
+                    std::cerr << "Failed to render " << files[i] << std::endl;
+                    continue;
+                }
+                total_duration_s += result.m_duration_s;
+                std::cout << std::fixed << std::setprecision(4) << files[i].filename().string()
+                          << ": " << result.m_duration_s << " s audio in "
+                          << result.m_processing_time_s << " s, real-time factor: "
+                          << result.m_processing_time_s / result.m_duration_s
+                          << std::endl;
+            }
+        });
+    }
+    for (auto& worker : workers) { worker.join(); }
+
+    double const total_time_s =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - total_start).count();
+    std::cout << "Rendered " << files.size() << " files (" << total_duration_s << " s audio) with "
+              << num_sessions << " sessions in " << total_time_s
+              << " s, overall real-time factor: " << total_time_s / total_duration_s << std::endl;
+
+    // Handlers must be released before the config they reference
+    sessions.clear();
+
+    return all_succeeded.load() ? 0 : 1;
+}
@@ -0,0 +1,161 @@
+/* ==========================================================================
+
+anira-replay: offline backend profiling of recorded inference inputs
+
+Usage:
+    anira-replay <config.json> <recording.bin> [repetitions]
+
+The recording is written by anira::InputRecorder while a host processes audio.
+Its input tensors are fed straight into a newly created processor for every
+recorded backend of the JsonConfigLoader config, bypassing the scheduler. The
+replayed process times are reported next to the inference and queue wait times
+of the recording, which separates the cost of the backend from the overhead of
+anira and the system the recording was made on.
+
+========================================================================== */
+
+#include <anira/anira.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::unique_ptr<anira::BackendBase> create_processor(
+    anira::InferenceBackend backend, [[maybe_unused]] anira::InferenceConfig& inference_config) {
+    switch (backend) {
+#ifdef USE_LIBTORCH
+        case anira::InferenceBackend::LIBTORCH:
+            return std::make_unique<anira::LibtorchProcessor>(inference_config);
+#endif
+#ifdef USE_ONNXRUNTIME
+        case anira::InferenceBackend::ONNX:
+            return std::make_unique<anira::OnnxRuntimeProcessor>(inference_config);
+#endif
+#ifdef USE_TFLITE
+        case anira::InferenceBackend::TFLITE:
+            return std::make_unique<anira::TFLiteProcessor>(inference_config);
+#endif
+#ifdef USE_LITERT
+        case anira::InferenceBackend::LITERT:
+            return std::make_unique<anira::LiteRtProcessor>(inference_config);
+#endif
+        default:
+            return nullptr;
+    }
+}
+
+bool has_model(const anira::InferenceConfig& inference_config, anira::InferenceBackend backend) {
+    return std::any_of(inference_config.m_model_data.begin(),
+                       inference_config.m_model_data.end(),
+                       [backend](const anira::ModelData& model) {
+                           return model.m_backend == backend;
+                       });
+}
+
+// Percentile of the non-negative durations in ms
+double get_percentile_ms(std::vector<int64_t> durations, double percentile) {
+    durations.erase(std::remove(durations.begin(), durations.end(), -1), durations.end());
+    if (durations.empty()) { return 0.; }
+    std::sort(durations.begin(), durations.end());
+    auto const index = static_cast<size_t>(
+        std::ceil(percentile / 100. * static_cast<double>(durations.size())));
+    return static_cast<double>(durations[std::clamp<size_t>(index, 1, durations.size()) - 1]) /
+           1e6;
+}
+
+void print_row(const std::string& name, const std::vector<int64_t>& durations) {
+    std::cout << std::left << std::setw(24) << name << std::right << std::fixed
+              << std::setprecision(3) << std::setw(12) << get_percentile_ms(durations, 50.)
+              << std::setw(12) << get_percentile_ms(durations, 99.) << std::setw(12)
+              << get_percentile_ms(durations, 100.) << '\n';
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <config.json> <recording.bin> [repetitions]"
+                  << std::endl;
+        return 1;
+    }
+
+    anira::JsonConfigLoader json_config_loader(argv[1]);
+    std::unique_ptr<anira::InferenceConfig> inference_config =
+        json_config_loader.get_inference_config();
+    if (inference_config == nullptr) {
+        std::cerr << "Could not load config " << argv[1] << std::endl;
+        return 1;
+    }
+
+    std::vector<anira::RecordedInference> records;
+    if (!anira::InputRecorder::read(argv[2], records) && records.empty()) {
+        std::cerr << "Could not read recording " << argv[2] << std::endl;
+        return 1;
+    }
+    size_t const repetitions = argc > 3 ? std::max<size_t>(std::stoul(argv[3]), 1) : 1;
+
+    std::vector<anira::InferenceBackend> backends;
+    for (const auto& record : records) {
+        if (std::find(backends.begin(), backends.end(), record.m_backend) == backends.end()) {
+            backends.push_back(record.m_backend);
+        }
+    }
+
+    bool success = true;
+    for (anira::InferenceBackend const backend : backends) {
+        std::vector<anira::RecordedInference> backend_records;
+        std::vector<int64_t> recorded_inference;
+        std::vector<int64_t> recorded_queue_wait;
+        for (const auto& record : records) {
+            if (record.m_backend != backend) { continue; }
+            backend_records.push_back(record);
+            recorded_inference.push_back(record.m_inference_ns);
+            recorded_queue_wait.push_back(record.m_queue_wait_ns);
+        }
+
+        std::unique_ptr<anira::BackendBase> processor =
+            has_model(*inference_config, backend) ? create_processor(backend, *inference_config)
+                                                  : nullptr;
+        if (processor == nullptr) {
+            std::cerr << "Skipping " << backend_records.size()
+                      << " records of a backend without a model in the config or that is not "
+                         "available in this build"
+                      << std::endl;
+            success = false;
+            continue;
+        }
+        processor->prepare();
+
+        std::vector<int64_t> replayed;
+        for (size_t repetition = 0; repetition < repetitions; ++repetition) {
+            std::vector<int64_t> const durations =
+                anira::InputRecorder::replay(*processor, backend_records);
+            replayed.insert(replayed.end(), durations.begin(), durations.end());
+        }
+        size_t const num_skipped =
+            static_cast<size_t>(std::count(replayed.begin(), replayed.end(), -1)) / repetitions;
+
+        std::cout << "Backend " << inference_config->get_model_path(backend) << ": "
+                  << backend_records.size() << " records";
+        if (num_skipped > 0) {
+            std::cout << ", " << num_skipped << " skipped due to mismatching tensor sizes";
+            success = false;
+        }
+        std::cout << '\n'
+                  << std::left << std::setw(24) << "[ms]" << std::right << std::setw(12) << "p50"
+                  << std::setw(12) << "p99" << std::setw(12) << "max" << '\n';
+        print_row("recorded inference", recorded_inference);
+        print_row("recorded queue wait", recorded_queue_wait);
+        print_row("replayed inference", replayed);
+    }
+
+    return success ? 0 : 1;
+}
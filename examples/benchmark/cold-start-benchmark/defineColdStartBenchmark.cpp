@@ -0,0 +1,145 @@
+#include <anira/anira.h>
+#include <anira/utils/helperFunctions.h>
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../../../extras/models/cnn/CNNConfig.h"
+#include "../../../extras/models/cnn/CNNPrePostProcessor.h"
+#include "../../../extras/models/hybrid-nn/HybridNNConfig.h"
+#include "../../../extras/models/hybrid-nn/HybridNNPrePostProcessor.h"
+#include "../../../extras/models/stateful-rnn/StatefulRNNConfig.h"
+#include "MemoryUsage.h"
+
+/* ============================================================ *
+ * ========================= Configs ========================== *
+ * ============================================================ */
+
+#define NUM_REPETITIONS 5
+#define SAMPLE_RATE 44100
+
+std::vector<int> num_parallel_processors = {1, 2, 4};
+std::vector<anira::InferenceBackend> inference_backends = {
+#ifdef USE_LIBTORCH
+    anira::InferenceBackend::LIBTORCH,
+#endif
+#ifdef USE_ONNXRUNTIME
+    anira::InferenceBackend::ONNX,
+#endif
+#ifdef USE_TFLITE
+    anira::InferenceBackend::TFLITE,
+#endif
+#ifdef USE_LITERT
+    anira::InferenceBackend::LITERT,
+#endif
+};
+std::vector<anira::InferenceConfig> inference_configs = {cnn_config, hybridnn_config, rnn_config};
+
+static void Arguments(::benchmark::internal::Benchmark* b) {
+    for (int i = 0; i < inference_configs.size(); ++i) {
+        for (int j = 0; j < inference_backends.size(); ++j) {
+#ifdef USE_ONNXRUNTIME
+            // ONNX backend does not support stateful RNN
+            if (i == 2 && inference_backends[j] == anira::InferenceBackend::ONNX) { continue; }
+#endif
+            for (int k = 0; k < num_parallel_processors.size(); ++k) {
+                b->Args({i, j, num_parallel_processors[k]});
+            }
+        }
+    }
+}
+
+static std::unique_ptr<anira::PrePostProcessor> create_pp_processor(
+    int model,
+    anira::InferenceConfig& inference_config) {
+    if (model == 0) { return std::make_unique<CNNPrePostProcessor>(inference_config); }
+    if (model == 1) { return std::make_unique<HybridNNPrePostProcessor>(inference_config); }
+    return std::make_unique<anira::PrePostProcessor>(inference_config);
+}
+
+/* ============================================================ *
+ * ================== BENCHMARK DEFINITIONS =================== *
+ * ============================================================ */
+
+// Every iteration starts from scratch: the handler is the only session, so the context with its
+// inference threads is created with it and released again when it is destroyed. The reported time
+// is the time from construction until the first block of inferred output is available.
+static void BM_COLD_START(::benchmark::State& state) {
+    auto const model = static_cast<int>(state.range(0));
+    anira::InferenceBackend const inference_backend = inference_backends[state.range(1)];
+
+    anira::InferenceConfig inference_config = inference_configs[model];
+    // The handler loads the models of all backends in the config, only the measured one is kept
+    std::erase_if(inference_config.m_model_data, [&](const anira::ModelData& model_data) {
+        return model_data.m_backend != inference_backend;
+    });
+    inference_config.m_num_parallel_processors = static_cast<unsigned int>(state.range(2));
+
+    // The models have a fixed input size, so the host buffer matches it
+    auto const buffer_size = inference_config.get_preprocess_input_size()[0];
+    anira::HostConfig host_config = {static_cast<float>(buffer_size), SAMPLE_RATE};
+
+    anira::Buffer<float> buffer(inference_config.get_preprocess_input_channels()[0], buffer_size);
+    anira::fill_buffer(buffer);
+
+    for (auto _ : state) {
+        size_t const rss_before = get_current_rss();
+
+        auto const construction_start = std::chrono::steady_clock::now();
+        std::unique_ptr<anira::PrePostProcessor> pp_processor =
+            create_pp_processor(model, inference_config);
+        auto inference_handler =
+            std::make_unique<anira::InferenceHandler>(*pp_processor, inference_config);
+        auto const construction_end = std::chrono::steady_clock::now();
+
+        inference_handler->prepare(host_config);
+        inference_handler->set_inference_backend(inference_backend);
+        auto const prepare_end = std::chrono::steady_clock::now();
+
+        // process() returns the latency padding first, the block is inferred once the receive
+        // buffer is refilled to the level before the call
+        size_t const prev_num_received_samples = inference_handler->get_available_samples(0);
+        inference_handler->process(buffer.get_array_of_write_pointers(), buffer_size);
+        while (inference_handler->get_available_samples(0) < prev_num_received_samples) {
+            std::this_thread::sleep_for(std::chrono::nanoseconds(10));
+        }
+        auto const first_output = std::chrono::steady_clock::now();
+
+        size_t const rss_after = get_current_rss();
+
+        inference_handler.reset();
+        pp_processor.reset();
+
+        auto const to_ms = [](auto duration) {
+            return std::chrono::duration<double, std::milli>(duration).count();
+        };
+        state.SetIterationTime(
+            std::chrono::duration<double>(first_output - construction_start).count());
+        state.counters["construction_ms"] = to_ms(construction_end - construction_start);
+        state.counters["prepare_ms"] = to_ms(prepare_end - construction_end);
+        state.counters["first_output_ms"] = to_ms(first_output - prepare_end);
+        state.counters["rss_growth_mb"] =
+            static_cast<double>(rss_after > rss_before ? rss_after - rss_before : 0) / 1e6;
+        state.counters["peak_rss_mb"] = static_cast<double>(get_peak_rss()) / 1e6;
+    }
+}
+
+// /* ============================================================ *
+//  * ================== BENCHMARK REGISTRATION ================== *
+//  * ============================================================ */
+
+BENCHMARK(BM_COLD_START)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1)
+    ->Repetitions(NUM_REPETITIONS)
+    ->ArgNames({"model", "backend", "processors"})
+    ->Apply(Arguments)
+    ->ComputeStatistics("min", anira::calculate_min)
+    ->ComputeStatistics("max", anira::calculate_max)
+    ->DisplayAggregatesOnly(false)
+    ->UseManualTime();
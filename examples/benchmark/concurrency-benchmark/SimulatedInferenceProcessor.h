@@ -0,0 +1,28 @@
+#ifndef ANIRA_SIMULATED_INFERENCE_PROCESSOR_H
+#define ANIRA_SIMULATED_INFERENCE_PROCESSOR_H
+
+#include <anira/anira.h>
+
+#include <chrono>
+
+// Custom backend that copies the input to the output and busy-waits for a fixed time, so the
+// scheduler can be benchmarked with a known and stable inference cost and without model files
+class SimulatedInferenceProcessor : public anira::BackendBase {
+public:
+    SimulatedInferenceProcessor(anira::InferenceConfig& inference_config,
+                                std::chrono::microseconds inference_time)
+        : anira::BackendBase(inference_config), m_inference_time(inference_time) {}
+
+    void process(std::vector<anira::BufferF>& input,
+                 std::vector<anira::BufferF>& output,
+                 std::shared_ptr<anira::SessionElement> session) override {
+        auto const until = std::chrono::steady_clock::now() + m_inference_time;
+        anira::BackendBase::process(input, output, session);
+        while (std::chrono::steady_clock::now() < until) {}
+    }
+
+private:
+    std::chrono::microseconds m_inference_time;
+};
+
+#endif  // ANIRA_SIMULATED_INFERENCE_PROCESSOR_H
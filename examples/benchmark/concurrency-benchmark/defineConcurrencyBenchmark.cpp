@@ -0,0 +1,159 @@
+#include <anira/anira.h>
+#include <anira/utils/helperFunctions.h>
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "SimulatedInferenceProcessor.h"
+
+/* ============================================================ *
+ * ========================= Configs ========================== *
+ * ============================================================ */
+
+#define NUM_REPETITIONS 1
+#define BUFFER_SIZE 512
+#define SAMPLE_RATE 48000
+#define AUDIO_DURATION_SECONDS 2
+#define SIMULATED_INFERENCE_TIME_US 1000
+#define MAX_INFERENCE_TIME_MS 2.f
+
+// Number of sessions (each driven by its own simulated audio callback thread) and number of
+// inference threads of the shared context
+std::vector<int> num_sessions = {1, 4, 16, 32};
+std::vector<int> num_threads = {1, 2, 4, 8};
+
+static std::vector<anira::ModelData> model_data_simulated_config = {
+    anira::ModelData("simulated", anira::InferenceBackend::CUSTOM)};
+
+static std::vector<anira::TensorShape> tensor_shape_simulated_config = {
+    {{{1, 1, BUFFER_SIZE}}, {{1, 1, BUFFER_SIZE}}}};
+
+static anira::InferenceConfig simulated_config(model_data_simulated_config,
+                                               tensor_shape_simulated_config,
+                                               MAX_INFERENCE_TIME_MS);
+
+static void Arguments(::benchmark::internal::Benchmark* b) {
+    for (int i = 0; i < num_sessions.size(); ++i) {
+        for (int j = 0; j < num_threads.size(); ++j) { b->Args({num_sessions[i], num_threads[j]}); }
+    }
+}
+
+/* ============================================================ *
+ * ================== BENCHMARK DEFINITIONS =================== *
+ * ============================================================ */
+
+// Runs every session on its own thread that calls process() once per audio period, like an audio
+// device callback would, and reports how well the shared context keeps up. The reported time is
+// the mean duration of a process() call.
+static void BM_CONCURRENCY(::benchmark::State& state) {
+    auto const num_sessions = static_cast<size_t>(state.range(0));
+    auto const num_inference_threads = static_cast<unsigned int>(state.range(1));
+
+    anira::HostConfig host_config = {BUFFER_SIZE, SAMPLE_RATE};
+    anira::ContextConfig context_config(num_inference_threads);
+
+    auto const period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(static_cast<double>(BUFFER_SIZE) / SAMPLE_RATE));
+    size_t const num_callbacks = AUDIO_DURATION_SECONDS * SAMPLE_RATE / BUFFER_SIZE;
+
+    // The handlers are declared last, so they are destroyed before the processors they use
+    std::vector<std::unique_ptr<anira::PrePostProcessor>> pp_processors;
+    std::vector<std::unique_ptr<SimulatedInferenceProcessor>> custom_processors;
+    std::vector<std::unique_ptr<anira::InferenceHandler>> inference_handlers;
+    for (size_t s = 0; s < num_sessions; ++s) {
+        pp_processors.push_back(std::make_unique<anira::PrePostProcessor>(simulated_config));
+        custom_processors.push_back(std::make_unique<SimulatedInferenceProcessor>(
+            simulated_config,
+            std::chrono::microseconds(SIMULATED_INFERENCE_TIME_US)));
+        inference_handlers.push_back(
+            std::make_unique<anira::InferenceHandler>(*pp_processors.back(),
+                                                      simulated_config,
+                                                      *custom_processors.back(),
+                                                      context_config));
+        inference_handlers.back()->prepare(host_config);
+        inference_handlers.back()->set_inference_backend(anira::InferenceBackend::CUSTOM);
+    }
+
+    for (auto _ : state) {
+        for (auto& inference_handler : inference_handlers) {
+            inference_handler->reset_statistics();
+        }
+
+        anira::Histogram callback_time;
+        std::atomic<uint64_t> callback_overruns{0};
+
+        // Audio devices are not aligned, so the callbacks of the sessions are spread over one
+        // period
+        auto const start = std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
+        std::vector<std::thread> callback_threads;
+        for (size_t s = 0; s < num_sessions; ++s) {
+            callback_threads.emplace_back([&, s] {
+                anira::Buffer<float> buffer(1, BUFFER_SIZE);
+                anira::fill_buffer(buffer);
+                auto next_callback = start + period * s / num_sessions;
+                for (size_t callback = 0; callback < num_callbacks; ++callback) {
+                    std::this_thread::sleep_until(next_callback);
+                    auto const begin = std::chrono::steady_clock::now();
+                    inference_handlers[s]->process(buffer.get_array_of_write_pointers(),
+                                                   BUFFER_SIZE);
+                    auto const end = std::chrono::steady_clock::now();
+                    callback_time.record(static_cast<uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin)
+                            .count()));
+                    next_callback += period;
+                    if (end > next_callback) {
+                        callback_overruns.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            });
+            anira::HighPriorityThread::elevate_priority(callback_threads.back().native_handle(),
+                                                        true);
+        }
+        for (auto& callback_thread : callback_threads) { callback_thread.join(); }
+
+        anira::HistogramSnapshot completion;
+        anira::HistogramSnapshot queue_wait;
+        anira::HistogramSnapshot missing_samples;
+        uint64_t deadline_misses = 0;
+        for (auto& inference_handler : inference_handlers) {
+            anira::InferenceStatistics const statistics = inference_handler->get_statistics();
+            completion.merge(statistics.m_completion);
+            missing_samples.merge(statistics.m_missing_samples);
+            for (const auto& backend : statistics.m_backends) {
+                queue_wait.merge(backend.m_queue_wait);
+            }
+            deadline_misses += statistics.m_deadline_misses;
+        }
+        anira::HistogramSnapshot const callback = callback_time.snapshot();
+
+        state.SetIterationTime(callback.get_mean() / 1e9);
+        state.counters["deadline_misses"] = static_cast<double>(deadline_misses);
+        state.counters["missing_samples"] = static_cast<double>(missing_samples.m_sum);
+        state.counters["callback_overruns"] =
+            static_cast<double>(callback_overruns.load(std::memory_order_relaxed));
+        state.counters["completion_p50_%"] = static_cast<double>(completion.get_percentile(50.));
+        state.counters["completion_p99_%"] = static_cast<double>(completion.get_percentile(99.));
+        state.counters["completion_p999_%"] =
+            static_cast<double>(completion.get_percentile(99.9));
+        state.counters["queue_wait_p99_us"] =
+            static_cast<double>(queue_wait.get_percentile(99.)) / 1e3;
+        state.counters["callback_p99_us"] = static_cast<double>(callback.get_percentile(99.)) / 1e3;
+    }
+}
+
+// /* ============================================================ *
+//  * ================== BENCHMARK REGISTRATION ================== *
+//  * ============================================================ */
+
+BENCHMARK(BM_CONCURRENCY)
+    ->Unit(benchmark::kMicrosecond)
+    ->Iterations(1)
+    ->Repetitions(NUM_REPETITIONS)
+    ->ArgNames({"sessions", "threads"})
+    ->Apply(Arguments)
+    ->UseManualTime();
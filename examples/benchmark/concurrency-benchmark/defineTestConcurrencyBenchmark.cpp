@@ -0,0 +1,14 @@
+#include <anira/anira.h>
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+TEST(Benchmark, Concurrency) {
+#if __linux__ || __APPLE__
+    pthread_t self = pthread_self();
+#elif WIN32
+    HANDLE self = GetCurrentThread();
+#endif
+    anira::HighPriorityThread::elevate_priority(self, true);
+
+    benchmark::RunSpecifiedBenchmarks();
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include <anira/anira.h>
+#include <anira/benchmark.h>
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include "../../../extras/models/model-pool/SimpleStereoGainConfig.h"
+#include "../../../extras/models/third-party/ircam-acids/RaveFunkDrumConfig.h"
+
+/* ============================================================ *
+ * ========================= Configs ========================== *
+ * ============================================================ */
+
+#define NUM_ITERATIONS 5
+#define NUM_REPETITIONS 2
+#define SAMPLE_RATE 44100
+
+std::vector<int> buffer_sizes = {512, 2048};
+std::vector<anira::InferenceBackend> inference_backends = {
+#ifdef USE_LIBTORCH
+    anira::InferenceBackend::LIBTORCH,
+#endif
+#ifdef USE_ONNXRUNTIME
+    anira::InferenceBackend::ONNX,
+#endif
+#ifdef USE_TFLITE
+    anira::InferenceBackend::TFLITE,
+#endif
+#ifdef USE_LITERT
+    anira::InferenceBackend::LITERT,
+#endif
+};
+// The stereo gain model has a streamable stereo input and output plus a non-streamable gain
+// parameter and scalar output, the RAVE model is only available for LibTorch
+std::vector<anira::InferenceConfig> inference_configs = {stereo_gain_config,
+                                                         rave_funk_drum_config};
+
+static void Arguments(::benchmark::internal::Benchmark* b) {
+    for (int i = 0; i < buffer_sizes.size(); ++i) {
+        for (int j = 0; j < inference_configs.size(); ++j) {
+            for (int k = 0; k < inference_backends.size(); ++k) {
+                if (j == 1 && inference_backends[k] != anira::InferenceBackend::LIBTORCH) {
+                    continue;
+                }
+                b->Args({buffer_sizes[i], j, k});
+            }
+        }
+    }
+}
+
+/* ============================================================ *
+ * ================== BENCHMARK DEFINITIONS =================== *
+ * ============================================================ */
+
+typedef anira::benchmark::ProcessBlockFixture ProcessBlockFixture;
+
+BENCHMARK_DEFINE_F(ProcessBlockFixture, BM_MULTI_TENSOR)(::benchmark::State& state) {
+    anira::HostConfig host_config = {static_cast<float>(get_buffer_size()), SAMPLE_RATE};
+    anira::InferenceConfig inference_config = inference_configs[state.range(1)];
+    anira::InferenceBackend inference_backend = inference_backends[state.range(2)];
+
+    anira::PrePostProcessor pp_processor(inference_config);
+
+    m_inference_handler = std::make_unique<anira::InferenceHandler>(pp_processor, inference_config);
+    m_inference_handler->prepare(host_config);
+    m_inference_handler->set_inference_backend(inference_backend);
+
+    // One buffer per input and output tensor, sized from the tensor shapes of the config
+    allocate_tensor_buffers(inference_config, host_config);
+
+    initialize_repetition(inference_config, host_config, inference_backend);
+
+    for (auto _ : state) {
+        push_random_samples_in_tensor_buffers();
+
+        initialize_iteration();
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        process_tensor_buffers();
+
+        // Waits for every streamable output tensor and records when each one was processed
+        while (!buffer_processed()) { std::this_thread::sleep_for(std::chrono::nanoseconds(10)); }
+
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+        interation_step(start, end, state);
+    }
+    repetition_step();
+
+    // The handler must not outlive the local pre- and post-processor
+    m_inference_handler.reset();
+}
+
+// /* ============================================================ *
+//  * ================== BENCHMARK REGISTRATION ================== *
+//  * ============================================================ */
+
+BENCHMARK_REGISTER_F(ProcessBlockFixture, BM_MULTI_TENSOR)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(NUM_ITERATIONS)
+    ->Repetitions(NUM_REPETITIONS)
+    ->Apply(Arguments)
+    ->ComputeStatistics("min", anira::calculate_min)
+    ->ComputeStatistics("max", anira::calculate_max)
+    ->DisplayAggregatesOnly(false)
+    ->UseManualTime();
@@ -0,0 +1,22 @@
+#include <anira/anira.h>
+#include <anira/benchmark.h>
+#include <benchmark/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+TEST(Benchmark, MultiTensor) {
+#if __linux__ || __APPLE__
+    pthread_t self = pthread_self();
+#elif WIN32
+    HANDLE self = GetCurrentThread();
+#endif
+    anira::HighPriorityThread::elevate_priority(self, true);
+
+    benchmark::RunSpecifiedBenchmarks();
+
+    // Writes the results to ANIRA_BENCHMARK_OUTPUT and fails on regressions against
+    // ANIRA_BENCHMARK_BASELINE if the variables are set
+    EXPECT_TRUE(
+        anira::benchmark::ProcessBlockFixture::m_reporter.report_from_environment(std::cout));
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include <anira/anira.h>
+#include <anira/benchmark.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "../../../extras/models/hybrid-nn/HybridNNConfig.h"
+#include "../../../extras/models/hybrid-nn/HybridNNPrePostProcessor.h"
+
+/* ============================================================ *
+ * ========================= Configs ========================== *
+ * ============================================================ */
+
+#define SAMPLE_RATE 44100
+#define RUN_DURATION_MS 2000
+#define LATENCY_RESOLUTION 32
+
+std::vector<float> buffer_sizes = {64, 128, 256, 512, 1024, 2048};
+std::vector<anira::InferenceBackend> inference_backends = {
+#ifdef USE_LIBTORCH
+    anira::InferenceBackend::LIBTORCH,
+#endif
+#ifdef USE_ONNXRUNTIME
+    anira::InferenceBackend::ONNX,
+#endif
+#ifdef USE_TFLITE
+    anira::InferenceBackend::TFLITE,
+#endif
+#ifdef USE_LITERT
+    anira::InferenceBackend::LITERT,
+#endif
+};
+
+/* ============================================================ *
+ * ===================== HARNESS DEFINITION =================== *
+ * ============================================================ */
+
+// Drives the model like an audio host at every buffer size and searches the smallest latency at
+// which no output is zero-filled, once per backend
+TEST(RealtimeHarness, HybridNN) {
+    anira::InferenceConfig inference_config = hybridnn_config;
+    HybridNNPrePostProcessor pp_processor(inference_config);
+
+    for (auto inference_backend : inference_backends) {
+        anira::InferenceHandler inference_handler(pp_processor, inference_config);
+        inference_handler.set_inference_backend(inference_backend);
+
+        anira::benchmark::RealtimeHarness harness(inference_handler, inference_config);
+        std::vector<anira::benchmark::LatencySearchResult> const results =
+            harness.sweep(SAMPLE_RATE,
+                          buffer_sizes,
+                          std::chrono::milliseconds(RUN_DURATION_MS),
+                          LATENCY_RESOLUTION);
+
+        std::cout << "\n------------------------------------------------------------\n"
+                  << "Model: " << inference_config.get_model_path(inference_backend) << '\n';
+        anira::benchmark::RealtimeHarness::print_results(std::cout, results);
+    }
+}
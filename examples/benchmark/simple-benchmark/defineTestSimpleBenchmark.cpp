@@ -1,7 +1,10 @@
 #include <anira/anira.h>
+#include <anira/benchmark.h>
 #include <benchmark/benchmark.h>
 #include <gtest/gtest.h>
 
+#include <iostream>
+
 TEST(Benchmark, Simple) {
 #if __linux__ || __APPLE__
     pthread_t self = pthread_self();
@@ -11,4 +14,9 @@ TEST(Benchmark, Simple) {
     anira::HighPriorityThread::elevate_priority(self, true);
 
     benchmark::RunSpecifiedBenchmarks();
+
+    // Writes the results to ANIRA_BENCHMARK_OUTPUT and fails on regressions against
+    // ANIRA_BENCHMARK_BASELINE if the variables are set
+    EXPECT_TRUE(
+        anira::benchmark::ProcessBlockFixture::m_reporter.report_from_environment(std::cout));
 }
\ No newline at end of file
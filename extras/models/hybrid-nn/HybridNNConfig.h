@@ -25,10 +25,10 @@ static std::vector<anira::ModelData> model_data_hybridnn_config = {
 
 static std::vector<anira::TensorShape> tensor_shape_hybridnn_config = {
 #ifdef USE_TFLITE
-    {{{256, 150, 1}}, {{256, 1}}, anira::InferenceBackend::TFLITE},
+    {{{256, 150, 1}}, {{256, 1}}, anira::InferenceBackend::TFLITE, anira::CHANNELS_LAST},
 #endif
 #ifdef USE_LITERT
-    {{{256, 150, 1}}, {{256, 1}}, anira::InferenceBackend::LITERT},
+    {{{256, 150, 1}}, {{256, 1}}, anira::InferenceBackend::LITERT, anira::CHANNELS_LAST},
 #endif
     {{{256, 1, 150}}, {{256, 1}}}};
 
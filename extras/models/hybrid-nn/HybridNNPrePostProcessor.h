@@ -13,34 +13,14 @@ public:
         std::vector<anira::RingBuffer>& input,
         std::vector<anira::BufferF>& output,
         [[maybe_unused]] anira::InferenceBackend current_inference_backend) override {
-        int64_t num_batches = 0;
-        int64_t num_input_samples = 0;
-        int64_t num_output_samples = 0;
-
-        bool channels_last = false;
-        anira::InferenceBackend channels_last_backend = anira::InferenceBackend::CUSTOM;
-#ifdef USE_TFLITE
-        if (current_inference_backend == anira::InferenceBackend::TFLITE) {
-            channels_last = true;
-            channels_last_backend = anira::InferenceBackend::TFLITE;
-        }
-#endif
-#ifdef USE_LITERT
-        if (current_inference_backend == anira::InferenceBackend::LITERT) {
-            channels_last = true;
-            channels_last_backend = anira::InferenceBackend::LITERT;
-        }
-#endif
-        if (channels_last) {
-            num_batches = m_inference_config.get_tensor_input_shape(channels_last_backend)[0][0];
-            num_input_samples = m_inference_config.get_tensor_input_shape(channels_last_backend)[0][1];
-            num_output_samples =
-                m_inference_config.get_tensor_output_shape(channels_last_backend)[0][1];
-        } else {
-            num_batches = m_inference_config.get_tensor_input_shape()[0][0];
-            num_input_samples = m_inference_config.get_tensor_input_shape()[0][2];
-            num_output_samples = m_inference_config.get_tensor_output_shape()[0][1];
-        }
+        // The tensors are planar for every backend, anira transposes them for the channels-last
+        // TFLite and LiteRT models, so the sizes do not depend on the layout of the backend
+        size_t const num_batches =
+            static_cast<size_t>(m_inference_config.get_tensor_input_shape()[0][0]);
+        size_t const num_input_samples =
+            m_inference_config.get_tensor_input_size()[0] / num_batches;
+        size_t const num_output_samples =
+            m_inference_config.get_tensor_output_size()[0] / num_batches;
         if (
 #ifdef USE_LIBTORCH
             current_inference_backend != anira::InferenceBackend::LIBTORCH &&
@@ -58,14 +38,9 @@ public:
             throw std::runtime_error("Invalid inference backend");
         }
 
-        for (size_t batch = 0; batch < (size_t)num_batches; batch++) {
-            size_t base_index = batch * (size_t)num_input_samples;
-            pop_samples_from_buffer(input[0],
-                                    output[0],
-                                    (size_t)num_output_samples,
-                                    (size_t)(num_input_samples - num_output_samples),
-                                    base_index);
-        }
+        // Every batch holds the receptive field of one output sample
+        pop_windows_from_buffer(
+            input[0], output[0], num_batches, num_input_samples, num_output_samples);
     }
 };
 
@@ -116,6 +116,26 @@ struct ANIRA_API ContextConfig {
      */
     std::vector<InferenceBackend> m_enabled_backends;
 
+    /**
+     * @brief Whether real-time memory is prefaulted and locked in physical memory
+     *
+     * When enabled, the ring buffers and inference structures of every session are prefaulted
+     * and locked after each prepare(), and the backend processors of the session lock their
+     * model memory where the runtime exposes it. Each inference thread locks the top
+     * MemoryLock::k_stack_size bytes of its stack when it starts. This avoids the page faults
+     * that cause dropouts after prepare() or under memory pressure.
+     *
+     * Locking can fail if it exceeds the limits of the system, e.g. RLIMIT_MEMLOCK on Linux.
+     * The memory is then only prefaulted, and the failures are reported by
+     * InferenceHandler::get_memory_lock_status() and Context::get_memory_lock_status().
+     *
+     * @note Enabling it on an existing context applies to sessions prepared and threads started
+     * afterwards. Backends that swap their tensor memory with the inference structures (LibTorch,
+     * TensorFlow Lite) keep all tensors locked only in arena mode, see
+     * InferenceHandler::set_arena_enabled().
+     */
+    bool m_lock_memory = false;
+
 private:
     /**
      * @brief Equality comparison operator
@@ -129,7 +149,8 @@ private:
      **/
     bool operator==(const ContextConfig& other) const {
         return m_num_threads == other.m_num_threads && m_anira_version == other.m_anira_version &&
-               m_enabled_backends == other.m_enabled_backends;
+               m_enabled_backends == other.m_enabled_backends &&
+               m_lock_memory == other.m_lock_memory;
     }
 
     /**
@@ -3,6 +3,9 @@
 
 #include <anira/utils/InferenceBackend.h>
 #include <anira/utils/Logger.h>
+#include <anira/utils/ResamplerQuality.h>
+#include <anira/utils/SpectralSpec.h>
+#include <anira/utils/TensorLayout.h>
 
 #include <array>
 #include <cassert>
@@ -187,7 +190,9 @@ struct ANIRA_API ModelData {
  * The TensorShape struct specifies the dimensional structure of tensors used by
  * neural network models. It supports both universal shapes (backend-agnostic) and
  * backend-specific shapes for models that require different tensor layouts across
- * different inference engines.
+ * different inference engines. A backend-specific shape can declare the channels-last layout, in
+ * which case anira transposes the planar tensors of the pre- and post-processing around the
+ * inference.
  *
  * @warning All tensor shapes must have at least one input and one output tensor
  * defined to ensure proper model configuration.
@@ -201,6 +206,7 @@ struct ANIRA_API TensorShape {
                                             ///< vector of dimensions)
     InferenceBackend m_backend;             ///< Target backend for backend-specific shapes
     bool m_universal = false;  ///< Whether this shape configuration is universal (backend-agnostic)
+    TensorLayout m_layout = CHANNELS_FIRST;  ///< Layout the backend expects the tensors in
 
     /**
      * @brief Default constructor is deleted to prevent uninitialized instances
@@ -234,11 +240,18 @@ struct ANIRA_API TensorShape {
      * @param input_shape List of input tensor shapes, where each shape is a vector of dimensions
      * @param output_shape List of output tensor shapes, where each shape is a vector of dimensions
      * @param backend The specific inference backend this shape configuration targets
-     */
-    TensorShape(TensorShapeList input_shape, TensorShapeList output_shape, InferenceBackend backend)
+     * @param layout Layout of the tensors of the backend. For CHANNELS_LAST the last two
+     * dimensions of every shape are [samples, channels], e.g. {256, 150, 2} instead of the
+     * {256, 2, 150} of the planar layout.
+     */
+    TensorShape(TensorShapeList input_shape,
+                TensorShapeList output_shape,
+                InferenceBackend backend,
+                TensorLayout layout = CHANNELS_FIRST)
         : m_tensor_input_shape(std::move(std::move(input_shape)))
         , m_tensor_output_shape(std::move(std::move(output_shape)))
-        , m_backend(backend) {
+        , m_backend(backend)
+        , m_layout(layout) {
         assert((m_tensor_input_shape.size() > 0 && "At least one input shape must be provided."));
         assert((m_tensor_output_shape.size() > 0 && "At least one output shape must be provided."));
     }
@@ -264,7 +277,7 @@ struct ANIRA_API TensorShape {
         if (!m_universal && !other.m_universal) {
             return m_tensor_input_shape == other.m_tensor_input_shape &&
                    m_tensor_output_shape == other.m_tensor_output_shape &&
-                   m_backend == other.m_backend;
+                   m_backend == other.m_backend && m_layout == other.m_layout;
         }
         return false;
     }
@@ -292,7 +305,23 @@ struct ANIRA_API TensorShape {
  *   - Have zero preprocess_input_size or postprocess_output_size
  *   - Stored in thread-safe internal storage
  *
- * @see InferenceConfig, TensorShape, PrePostProcessor
+ * @par Model Sample Rate:
+ * Models trained at a fixed sample rate set m_model_sample_rate. If the host runs at another
+ * rate, the streamable tensors are resampled from the host rate before the send buffers and back
+ * to it after the receive buffers, and all sizes and latencies of the spec count samples at the
+ * model rate. The latency reported by the InferenceHandler includes the delay of the resampling.
+ *
+ * @par Spectral Stage:
+ * Spectral models set m_input_spectral_spec and m_output_spectral_spec. The inference threads
+ * then compute the short-time spectra of a streamable input tensor before the inference and
+ * overlap-add the complex spectra of a streamable output tensor after it, so the PrePostProcessor
+ * keeps exchanging samples: (frames - 1) * hop + fft_size samples per channel and inference, the
+ * new samples preceded by the overlap with the previous inference. The tensor shape declares the
+ * features, e.g. [channels, frames, bins, 2] for complex spectra, and preprocess_input_size and
+ * postprocess_output_size are frames * hop. The overlap-add delays the output by fft_size - hop
+ * samples, which is added to the latency.
+ *
+ * @see InferenceConfig, TensorShape, PrePostProcessor, Resampler, SpectralSpec
  */
 struct ANIRA_API ProcessingSpec {
     std::vector<size_t> m_preprocess_input_channels;    ///< Number of input channels for each input
@@ -305,6 +334,14 @@ struct ANIRA_API ProcessingSpec {
                                                     ///< each output tensor (0 = non-streamable)
     std::vector<size_t> m_internal_model_latency;   ///< Internal latency in samples for each output
                                                     ///< tensor
+    float m_model_sample_rate = 0.f;  ///< Sample rate the model runs at in Hz, the streamable
+                                      ///< tensors are resampled from and to the host sample rate
+                                      ///< if it differs (0 = host sample rate)
+    ResamplerQuality m_resampler_quality = MEDIUM_QUALITY;  ///< Quality of the resampling
+    std::vector<SpectralSpec> m_input_spectral_spec;   ///< Spectral stage of each input tensor
+                                                       ///< (disabled by default)
+    std::vector<SpectralSpec> m_output_spectral_spec;  ///< Spectral stage of each output tensor
+                                                       ///< (disabled by default)
     std::vector<size_t> m_tensor_input_size;        ///< Total size (elements) of each input tensor
                                                     ///< (computed from shape)
     std::vector<size_t> m_tensor_output_size;       ///< Total size (elements) of each output tensor
@@ -388,7 +425,11 @@ struct ANIRA_API ProcessingSpec {
                m_postprocess_output_channels == other.m_postprocess_output_channels &&
                m_preprocess_input_size == other.m_preprocess_input_size &&
                m_postprocess_output_size == other.m_postprocess_output_size &&
-               m_internal_model_latency == other.m_internal_model_latency;
+               m_internal_model_latency == other.m_internal_model_latency &&
+               std::abs(m_model_sample_rate - other.m_model_sample_rate) < 1e-6 &&
+               m_resampler_quality == other.m_resampler_quality &&
+               m_input_spectral_spec == other.m_input_spectral_spec &&
+               m_output_spectral_spec == other.m_output_spectral_spec;
     }
 
     /**
@@ -577,6 +618,13 @@ public:
      */
     const TensorShapeList& get_tensor_output_shape(InferenceBackend backend) const;
 
+    /**
+     * @brief Gets the layout a specific backend expects the tensors in
+     * @param backend The target inference backend
+     * @return Layout of the tensor shape of the backend, CHANNELS_FIRST for universal shapes
+     */
+    TensorLayout get_tensor_layout(InferenceBackend backend) const;
+
     // ========================================
     // Processing Specification Access Methods
     // ========================================
@@ -623,6 +671,30 @@ public:
      */
     const std::vector<size_t>& get_internal_model_latency() const;
 
+    /**
+     * @brief Gets the sample rate the model runs at
+     * @return Sample rate in Hz, 0 if the model runs at the host sample rate
+     */
+    float get_model_sample_rate() const;
+
+    /**
+     * @brief Gets the quality of the resampling between the host and the model sample rate
+     * @return Quality of the resampler
+     */
+    ResamplerQuality get_resampler_quality() const;
+
+    /**
+     * @brief Gets the spectral stage of each input tensor
+     * @return Vector of spectral specifications
+     */
+    const std::vector<SpectralSpec>& get_input_spectral_spec() const;
+
+    /**
+     * @brief Gets the spectral stage of each output tensor
+     * @return Vector of spectral specifications
+     */
+    const std::vector<SpectralSpec>& get_output_spectral_spec() const;
+
     // ========================================
     // Configuration Modification Methods
     // ========================================
@@ -684,6 +756,30 @@ public:
      */
     void set_internal_model_latency(const std::vector<size_t>& internal_model_latency);
 
+    /**
+     * @brief Sets the sample rate the model runs at
+     * @param model_sample_rate Sample rate in Hz, 0 to run the model at the host sample rate
+     */
+    void set_model_sample_rate(float model_sample_rate);
+
+    /**
+     * @brief Sets the quality of the resampling between the host and the model sample rate
+     * @param quality New quality of the resampler
+     */
+    void set_resampler_quality(ResamplerQuality quality);
+
+    /**
+     * @brief Sets the spectral stage of each input tensor
+     * @param input_spectral_spec New spectral specifications
+     */
+    void set_input_spectral_spec(const std::vector<SpectralSpec>& input_spectral_spec);
+
+    /**
+     * @brief Sets the spectral stage of each output tensor
+     * @param output_spectral_spec New spectral specifications
+     */
+    void set_output_spectral_spec(const std::vector<SpectralSpec>& output_spectral_spec);
+
     /**
      * @brief Sets model path for a specific backend
      * @param model_path New model file path
@@ -97,6 +97,66 @@ public:
      */
     InferenceBackend get_inference_backend();
 
+    /**
+     * @brief Enables or disables the calibration of the max inference time in prepare()
+     *
+     * When enabled, the following prepare() calls measure the inference times of the backend
+     * selected at that time, or read them from the cache file, and calculate the latency from
+     * their percentile plus margin instead of the configured max inference time. Select the
+     * backend before calling prepare(), since a backend changed later keeps the calibrated time.
+     *
+     * @param calibration Options of the calibration, see InferenceTimeCalibration
+     */
+    void set_inference_time_calibration(const InferenceTimeCalibration& calibration);
+
+    /**
+     * @brief Gets the max inference time the current latency is based on
+     *
+     * @return Calibrated max inference time in ms if calibration is enabled, otherwise the
+     *         configured one
+     */
+    float get_max_inference_time() const;
+
+    /**
+     * @brief Enables or disables placing all buffers of the session in one slab
+     *
+     * When enabled, the following prepare() calls size a single allocation up front from the
+     * ring buffer sizes, the number of inference structures and the tensor sizes, and place all
+     * of them in it. Preparing is then one allocation and the scheduler data of the session
+     * sits together in memory. Backends that swap the tensor memory with their own (LibTorch,
+     * TensorFlow Lite) copy the tensors instead, since the slab memory cannot change owner.
+     *
+     * @param enabled Whether the session buffers are allocated from a single Arena
+     */
+    void set_arena_enabled(bool enabled);
+
+    /**
+     * @brief Sets the number of recently seen inputs whose outputs are reused
+     *
+     * When greater than 0, the following prepare() calls allocate an InferenceCache. Before an
+     * inference is submitted, its pre-processed inputs are compared with the cached ones, and on
+     * a match the cached outputs are used instead of running the model. Models that only take
+     * non-streamable parameter tensors then only run when a parameter changes. The number of
+     * skipped inferences is reported in InferenceStatistics::m_memoized_inferences.
+     *
+     * @param num_entries Number of inputs and outputs to keep, 0 (default) disables memoization
+     *
+     * @warning Only enable for models whose outputs depend on nothing but their inputs. Sessions
+     * with a session-exclusive processor are never memoized, since it may carry state.
+     */
+    void set_memoization_cache_size(size_t num_entries);
+
+    /**
+     * @brief Gets the result of locking the memory of the session in the last prepare() call
+     *
+     * With ContextConfig::m_lock_memory set, prepare() prefaults and locks the ring buffers and
+     * inference structures of the session and the model memory of its processors. Memory that
+     * exceeds the limits of the system is only prefaulted and reported here.
+     *
+     * @return Locked bytes and failures, empty if ContextConfig::m_lock_memory is not set
+     */
+    MemoryLockStatus get_memory_lock_status() const;
+
     /**
      * @brief Prepares the inference handler for processing with new audio configuration
      *
@@ -187,6 +247,10 @@ public:
      * @param num_output_samples Array of maximum output sample counts for each tensor
      * @return Array of actual output sample counts for each tensor
      *
+     * Non-streamable tensors with a sample count > 0 are published with
+     * PrePostProcessor::try_set_input_tensor(). The values are dropped while another thread
+     * publishes the same tensor, pass them again with the next call.
+     *
      * @note This method is real-time safe and does not allocate memory. If the blocking_ratio
      * in the inference configuration is > 0 (not default), this method introduces a controlled
      * blocking operation to wait for processed data (semaphore.try_acquire_until()) in order to
@@ -294,6 +358,47 @@ public:
                      size_t* num_output_samples,
                      std::chrono::steady_clock::time_point wait_until);
 
+    /**
+     * @brief Renders a whole file or large span for a specific tensor offline
+     *
+     * Offline counterpart to process() for bouncing and batch processing. The span is split into
+     * as many preprocessing windows as possible and dispatched across all parallel processors,
+     * without the real-time latency padding. The returned samples are aligned with the input,
+     * i.e. no latency compensation is needed by the caller.
+     *
+     * @param input_data Input audio data organized as data[channel][sample]
+     * @param num_input_samples Number of input samples in the span
+     * @param output_data Output buffer organized as data[channel][sample]
+     * @param num_output_samples Number of output samples to render
+     * @param tensor_index Index of the tensor to process (default: 0)
+     * @return Number of output samples actually written
+     *
+     * @note This method blocks until the span is rendered and is not real-time safe. The
+     * handler must be prepared before, and is re-prepared with the same host configuration
+     * afterwards, so any pending real-time state is discarded.
+     */
+    size_t render(const float* const* input_data,
+                  size_t num_input_samples,
+                  float* const* output_data,
+                  size_t num_output_samples,
+                  size_t tensor_index = 0);
+
+    /**
+     * @brief Renders whole files or large spans for multiple tensors offline
+     *
+     * @param input_data Input data organized as data[tensor_index][channel][sample]
+     * @param num_input_samples Array of input sample counts for each tensor
+     * @param output_data Output data buffers organized as data[tensor_index][channel][sample]
+     * @param num_output_samples Array of output sample counts to render for each tensor
+     * @return Array of actual output sample counts for each tensor
+     *
+     * @note This method blocks until the spans are rendered and is not real-time safe.
+     */
+    size_t* render(const float* const* const* input_data,
+                   size_t* num_input_samples,
+                   float* const* const* output_data,
+                   size_t* num_output_samples);
+
     /**
      * @brief Gets the processing latency for a specific tensor
      *
@@ -312,6 +417,40 @@ public:
      */
     std::vector<unsigned int> get_latency_vector() const;
 
+    /**
+     * @brief Gets a snapshot of the timing statistics of this handler's session
+     *
+     * The snapshot contains histograms of the queue wait and inference time per backend, the
+     * pre- and post-processing time, the completion time relative to the audio deadline and
+     * the number of zero-filled output samples. Hosts can use it to display the scheduler's
+     * behaviour or to detect drift in the high percentiles.
+     *
+     * @return Snapshot of the session's statistics, durations are given in nanoseconds
+     *
+     * @note This method allocates and must not be called from the audio thread.
+     */
+    InferenceStatistics get_statistics() const;
+
+    /**
+     * @brief Resets the timing statistics of this handler's session
+     */
+    void reset_statistics();
+
+    /**
+     * @brief Gets the memory held by this handler's session
+     *
+     * The footprint lists the bytes of the send and receive ring buffers, the input and output
+     * tensors of all structures in the inference queue and the processors of every backend the
+     * session uses, with their instance tensors and model weights. Processors can be shared with
+     * other sessions, use Context::get_memory_footprint() to count them only once.
+     *
+     * @return Footprint of the session broken down by category
+     *
+     * @note This method allocates and must not be called from the audio thread or concurrently
+     *       with prepare().
+     */
+    MemoryFootprint get_memory_footprint() const;
+
     /**
      * @brief Gets the number of samples received for a specific tensor and channel
      *
@@ -1,13 +1,13 @@
 #ifndef ANIRA_PREPOSTPROCESSOR_H
 #define ANIRA_PREPOSTPROCESSOR_H
 
-#include <atomic>
 #include <cassert>
 #include <vector>
 
 #include "InferenceConfig.h"
 #include "anira/system/AniraWinExports.h"
 #include "utils/InferenceBackend.h"
+#include "utils/ParameterBlock.h"
 #include "utils/RingBuffer.h"
 
 namespace anira {
@@ -25,7 +25,8 @@ namespace anira {
  * storage
  *
  * @par Key Features:
- * - Thread-safe handling of non-streamable tensor data using atomic operations
+ * - Thread-safe handling of non-streamable tensor data, published and read as consistent
+ *   snapshots of whole tensors
  * - Helper methods for efficient buffer manipulation
  * - Support for multiple input/output tensors with different characteristics
  * - Real-time safe operations suitable for processing
@@ -69,8 +70,12 @@ public:
      * @brief Transforms input data from ring buffers to inference tensors
      *
      * This method is called before neural network inference to prepare input data.
-     * For streamable tensors, it extracts samples from ring buffers.
-     * For non-streamable tensors, it retrieves values from internal storage.
+     * For streamable tensors, it extracts samples from ring buffers, preceded by the samples the
+     * first frame of a spectral tensor shares with the previous inference.
+     * For non-streamable tensors, it copies the latest snapshot from internal storage. If a writer
+     * is preempted inside its write section, the snapshot may mix two writes after
+     * ParameterBlock::k_max_read_attempts copies. It is used anyway, since waiting for the writer
+     * is not real-time safe, and the next inference copies the tensor again.
      *
      * @param input Vector of input ring buffers containing data from the host application
      * @param output Vector of output tensors that will be fed to the inference engine
@@ -78,7 +83,7 @@ public:
      * processing)
      *
      * @note This method is called from the audio thread and must be real-time safe
-     * @see pop_samples_from_buffer(), get_input()
+     * @see pop_samples_from_buffer(), get_input_tensor()
      */
     virtual void pre_process(std::vector<RingBuffer>& input,
                              std::vector<BufferF>& output,
@@ -88,8 +93,9 @@ public:
      * @brief Transforms inference results to output ring buffers
      *
      * This method is called after neural network inference to process the results.
-     * For streamable tensors, it pushes samples to ring buffers.
-     * For non-streamable tensors, it stores values in internal storage.
+     * For streamable tensors, it pushes samples to ring buffers, spectral tensors are already
+     * synthesized into samples.
+     * For non-streamable tensors, it publishes them to internal storage as a whole.
      *
      * @param input Vector of input tensors containing inference results
      * @param output Vector of output ring buffers that will be read by the host application
@@ -97,7 +103,7 @@ public:
      * processing)
      *
      * @note This method is called from the audio thread and must be real-time safe
-     * @see push_samples_to_buffer(), set_output()
+     * @see push_samples_to_buffer(), set_output_tensor()
      */
     virtual void post_process(std::vector<BufferF>& input,
                               std::vector<RingBuffer>& output,
@@ -107,7 +113,8 @@ public:
      * @brief Sets a non-streamable input value in thread-safe storage
      *
      * Used to store control parameters or static values that don't change sample-by-sample.
-     * The data is stored using atomic operations for thread safety.
+     * The value is stored without waiting for other threads. To update several values of a
+     * tensor at once, use set_input_tensor().
      *
      * @param input The value to store
      * @param i Tensor index (which input tensor)
@@ -118,11 +125,45 @@ public:
      */
     void set_input(const float& input, size_t i, size_t j);
 
+    /**
+     * @brief Publishes the values of a non-streamable input tensor at once
+     *
+     * Used for large conditioning tensors such as latents or embeddings. pre_process() either
+     * sees all values of one call or none of them, never a mix of two calls.
+     *
+     * @param input Values to publish
+     * @param i Tensor index (which input tensor)
+     * @param num_samples Number of values from the start of the tensor, at most its size
+     *
+     * @note Real-time safe. Calls from different threads wait for each other, publish a tensor
+     * from one thread only.
+     * @warning Only use for tensors where preprocess_input_size == 0
+     * @see get_input_tensor()
+     */
+    void set_input_tensor(const float* input, size_t i, size_t num_samples);
+
+    /**
+     * @brief Publishes the values of a non-streamable input tensor unless another thread does
+     *
+     * Like set_input_tensor(), but drops the values instead of waiting while another thread
+     * publishes the tensor. Used by InferenceHandler::process() on the audio thread.
+     *
+     * @param input Values to publish
+     * @param i Tensor index (which input tensor)
+     * @param num_samples Number of values from the start of the tensor, at most its size
+     * @return Whether the values were published
+     *
+     * @note Real-time safe, never waits for other writers
+     * @warning Only use for tensors where preprocess_input_size == 0
+     * @see ParameterBlock::try_write()
+     */
+    bool try_set_input_tensor(const float* input, size_t i, size_t num_samples);
+
     /**
      * @brief Sets a non-streamable output value in thread-safe storage
      *
      * Used to store control parameters or static values from inference results.
-     * The data is stored using atomic operations for thread safety.
+     * The value is stored without waiting for other threads.
      *
      * @param output The value to store
      * @param i Tensor index (which output tensor)
@@ -133,6 +174,19 @@ public:
      */
     void set_output(const float& output, size_t i, size_t j);
 
+    /**
+     * @brief Publishes the values of a non-streamable output tensor at once
+     *
+     * @param output Values to publish
+     * @param i Tensor index (which output tensor)
+     * @param num_samples Number of values from the start of the tensor, at most its size
+     *
+     * @note Real-time safe. Calls from different threads wait for each other.
+     * @warning Only use for tensors where postprocess_output_size == 0
+     * @see get_output_tensor()
+     */
+    void set_output_tensor(const float* output, size_t i, size_t num_samples);
+
     /**
      * @brief Retrieves a non-streamable input value from thread-safe storage
      *
@@ -147,6 +201,20 @@ public:
      */
     float get_input(size_t i, size_t j);
 
+    /**
+     * @brief Copies a consistent snapshot of a non-streamable input tensor
+     *
+     * @param input Destination of the values
+     * @param i Tensor index (which input tensor)
+     * @param num_samples Number of values from the start of the tensor, at most its size
+     * @return Whether the copy is consistent, see ParameterBlock::read()
+     *
+     * @note Real-time safe, never waits for writers
+     * @warning Only use for tensors where preprocess_input_size == 0
+     * @see set_input_tensor()
+     */
+    bool get_input_tensor(float* input, size_t i, size_t num_samples);
+
     /**
      * @brief Retrieves a non-streamable output value from thread-safe storage
      *
@@ -161,6 +229,20 @@ public:
      */
     float get_output(size_t i, size_t j);
 
+    /**
+     * @brief Copies a consistent snapshot of a non-streamable output tensor
+     *
+     * @param output Destination of the values
+     * @param i Tensor index (which output tensor)
+     * @param num_samples Number of values from the start of the tensor, at most its size
+     * @return Whether the copy is consistent, see ParameterBlock::read()
+     *
+     * @note Real-time safe, never waits for writers
+     * @warning Only use for tensors where postprocess_output_size == 0
+     * @see set_output_tensor()
+     */
+    bool get_output_tensor(float* output, size_t i, size_t num_samples);
+
     /**
      * @brief Extracts samples from a ring buffer to an output tensor
      *
@@ -206,7 +288,8 @@ public:
      * @param output Destination tensor buffer
      * @param num_new_samples Number of new samples to extract per channel
      * @param num_old_samples Number of samples to retain from previous extraction
-     * @param offset Starting position in the output buffer for writing samples
+     * @param offset Starting position in the output buffer for writing samples, the window of
+     * channel i starts at offset + i * (num_old_samples + num_new_samples)
      *
      * @note Real-time safe operation
      */
@@ -216,6 +299,30 @@ public:
                                  size_t num_old_samples,
                                  size_t offset);
 
+    /**
+     * @brief Extracts a batch of overlapping windows from a ring buffer in one pass
+     *
+     * Fills a tensor of shape [num_windows, channels, window_size], where each window advances
+     * by hop_size new samples, e.g. for models with a large receptive field that predict a few
+     * samples per window. Produces the same tensor as calling pop_samples_from_buffer() with
+     * hop_size new samples for every window, but copies each window with at most two memcpy
+     * calls and resolves the read position once per channel.
+     *
+     * @param input Source ring buffer
+     * @param output Destination tensor buffer
+     * @param num_windows Number of windows (batch size)
+     * @param window_size Number of samples per window and channel
+     * @param hop_size Number of new samples per window
+     *
+     * @note Real-time safe operation
+     * @see RingBuffer::pop_windows()
+     */
+    void pop_windows_from_buffer(RingBuffer& input,
+                                 BufferF& output,
+                                 size_t num_windows,
+                                 size_t window_size,
+                                 size_t hop_size);
+
     /**
      * @brief Writes samples from a tensor to a ring buffer
      *
@@ -244,23 +351,23 @@ private:
     /**
      * @brief Thread-safe storage for non-streamable input tensors
      *
-     * Vector of atomic float arrays for storing input parameters that don't change
-     * sample-by-sample (e.g., control parameters, static values).
+     * One parameter block per input tensor for storing input parameters that don't change
+     * sample-by-sample (e.g., control parameters, static values). Empty for streamable tensors.
      */
-    std::vector<MemoryBlock<std::atomic<float>>> m_inputs;
+    std::vector<ParameterBlock> m_inputs;
 
     /**
      * @brief Thread-safe storage for non-streamable output tensors
      *
-     * Vector of atomic float arrays for storing output parameters that don't change
-     * sample-by-sample (e.g., peak values, analysis results).
+     * One parameter block per output tensor for storing output parameters that don't change
+     * sample-by-sample (e.g., peak values, analysis results). Empty for streamable tensors.
      */
-    std::vector<MemoryBlock<std::atomic<float>>> m_outputs;
+    std::vector<ParameterBlock> m_outputs;
 
 #if DOXYGEN
     // Placeholder for Doxygen documentation
     // Since Doxygen does not find classes structures nested in std::vectors
-    MemoryBlock<std::atomic<float>>* __doxygen_force_0;  ///< Placeholder for Doxygen documentation
+    ParameterBlock* __doxygen_force_0;  ///< Placeholder for Doxygen documentation
 #endif
 };
 
@@ -9,15 +9,36 @@
 #include "backends/OnnxRuntimeProcessor.h"
 #include "backends/TFLiteProcessor.h"
 #include "scheduler/Context.h"
+#include "scheduler/InferenceCache.h"
 #include "scheduler/InferenceManager.h"
 #include "scheduler/InferenceThread.h"
+#include "scheduler/MemoryFootprint.h"
+#include "scheduler/SchedulerSimulator.h"
 #include "scheduler/SessionElement.h"
+#include "scheduler/SessionStatistics.h"
 #include "system/HighPriorityThread.h"
+#include "utils/AlignedAllocator.h"
+#include "utils/Arena.h"
 #include "utils/Buffer.h"
+#include "utils/FFT.h"
+#include "utils/Histogram.h"
 #include "utils/HostConfig.h"
 #include "utils/InferenceBackend.h"
+#include "utils/InferenceTimeCalibration.h"
+#include "utils/InputRecorder.h"
 #include "utils/JsonConfigLoader.h"
+#include "utils/LayoutTransform.h"
+#include "utils/MemoryLock.h"
+#include "utils/MirroredRingBuffer.h"
+#include "utils/ParameterBlock.h"
+#include "utils/RealtimeLogger.h"
+#include "utils/Resampler.h"
+#include "utils/ResamplerQuality.h"
 #include "utils/RingBuffer.h"
 #include "utils/Semaphore.h"
+#include "utils/SpectralSpec.h"
+#include "utils/SpectralTransform.h"
+#include "utils/TensorLayout.h"
+#include "utils/Tracer.h"
 
 #endif  // ANIRA_H
\ No newline at end of file
@@ -4,8 +4,11 @@
 #include <memory>
 
 #include "../InferenceConfig.h"
+#include "../scheduler/MemoryFootprint.h"
 #include "../system/AniraWinExports.h"
 #include "../utils/Buffer.h"
+#include "../utils/InferenceBackend.h"
+#include "../utils/MemoryLock.h"
 
 namespace anira {
 
@@ -84,10 +87,66 @@ public:
                          std::vector<BufferF>& output,
                          [[maybe_unused]] std::shared_ptr<SessionElement> session);
 
+    /**
+     * @brief Gets the memory held by this processor
+     *
+     * The base implementation reports no memory, since the allocations of a custom backend are
+     * unknown. The backend processors report their instances, the tensors of every instance and
+     * the model weights. m_num_sessions is filled in by the caller.
+     *
+     * @return Memory footprint of the processor
+     * @note Must not be called concurrently with prepare()
+     */
+    virtual BackendMemoryFootprint get_memory_footprint() const;
+
+    /**
+     * @brief Prefaults and locks the model memory of this processor in physical memory
+     *
+     * Called after a session using the processor is prepared if ContextConfig::m_lock_memory is
+     * set. The base implementation locks nothing, since the allocations of a custom backend are
+     * unknown. The backend processors lock the tensors of their instances and the model weights
+     * or the binary model data, as far as the runtime exposes them. Locking is not nested, so
+     * processors shared by several sessions may be locked repeatedly.
+     *
+     * @return Locked bytes and failures
+     * @note Must not be called concurrently with prepare()
+     */
+    virtual MemoryLockStatus lock_memory();
+
     InferenceConfig m_inference_config;  ///< Owned copy of the inference configuration containing
                                          ///< model and processing parameters. Owned (not a
                                          ///< reference) so a pooled processor shared across
                                          ///< sessions never outlives the config it reads.
+
+protected:
+    /**
+     * @brief Estimates the footprint of a processor whose instances each hold a copy of the model
+     *
+     * Counts the input and output tensors of the config once per instance and uses the size of
+     * the serialized model (the binary data or the model file) for the weights of each instance.
+     *
+     * @param backend Backend whose model data is used
+     * @param num_instances Number of parallel instances of the processor
+     * @return Estimated memory footprint of the processor
+     */
+    BackendMemoryFootprint estimate_memory_footprint(InferenceBackend backend,
+                                                     size_t num_instances) const;
+
+    /**
+     * @brief Gets the size of the serialized model for a backend
+     *
+     * @param backend Backend whose model data is used
+     * @return Size of the binary model data or the model file in bytes, 0 if it is unknown
+     */
+    size_t get_serialized_model_size(InferenceBackend backend) const;
+
+    /**
+     * @brief Locks the binary model data of a backend, if the model is not loaded from a file
+     *
+     * @param backend Backend whose model data is used
+     * @param status Receives the locked or failed bytes
+     */
+    void lock_binary_model_data(InferenceBackend backend, MemoryLockStatus& status) const;
 };
 
 }  // namespace anira
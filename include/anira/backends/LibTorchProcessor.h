@@ -101,6 +101,24 @@ public:
                  std::vector<BufferF>& output,
                  std::shared_ptr<SessionElement> session) override;
 
+    /**
+     * @brief Gets the memory held by the LibTorch instances
+     *
+     * The model weights are the parameters and buffers of the loaded TorchScript modules.
+     *
+     * @return Memory footprint of the processor
+     */
+    BackendMemoryFootprint get_memory_footprint() const override;
+
+    /**
+     * @brief Prefaults and locks the model memory in physical memory
+     *
+     * Locks the weights and buffers of the TorchScript modules of all instances.
+     *
+     * @return Locked bytes and failures
+     */
+    MemoryLockStatus lock_memory() override;
+
 private:
     /**
      * @brief Internal processing instance for thread-safe LibTorch operations
@@ -66,6 +66,26 @@ public:
                  std::vector<BufferF>& output,
                  std::shared_ptr<SessionElement> session) override;
 
+    /**
+     * @brief Gets the memory held by the LiteRT instances
+     *
+     * LiteRT does not expose the size of the loaded weights, they are estimated from the size
+     * of the serialized model.
+     *
+     * @return Memory footprint of the processor
+     */
+    BackendMemoryFootprint get_memory_footprint() const override;
+
+    /**
+     * @brief Prefaults and locks the model memory in physical memory
+     *
+     * Locks the binary model data. The weights and tensors are held inside the LiteRT runtime
+     * and not exposed.
+     *
+     * @return Locked bytes and failures
+     */
+    MemoryLockStatus lock_memory() override;
+
 private:
     /**
      * @brief Internal processing instance for thread-safe LiteRT operations
@@ -65,6 +65,26 @@ public:
                  std::vector<BufferF>& output,
                  std::shared_ptr<SessionElement> session) override;
 
+    /**
+     * @brief Gets the memory held by the ONNX Runtime instances
+     *
+     * ONNX Runtime does not expose the size of the loaded weights, they are estimated from the size
+     * of the serialized model.
+     *
+     * @return Memory footprint of the processor
+     */
+    BackendMemoryFootprint get_memory_footprint() const override;
+
+    /**
+     * @brief Prefaults and locks the model memory in physical memory
+     *
+     * Locks the input tensors of all instances and the binary model data. The weights are held
+     * inside the ONNX Runtime session and not exposed.
+     *
+     * @return Locked bytes and failures
+     */
+    MemoryLockStatus lock_memory() override;
+
 private:
     /**
      * @brief Internal processing instance for thread-safe ONNX Runtime operations
@@ -1,7 +1,9 @@
 #ifndef ANIRA_BENCHMARK_H
 #define ANIRA_BENCHMARK_H
 
+#include "benchmark/BenchmarkReporter.h"
 #include "benchmark/ProcessBlockFixture.h"
+#include "benchmark/RealtimeHarness.h"
 #include "utils/helperFunctions.h"
 
 #endif  // ANIRA_BENCHMARK_H
\ No newline at end of file
@@ -0,0 +1,169 @@
+#ifndef ANIRA_BENCHMARK_BENCHMARKREPORTER_H
+#define ANIRA_BENCHMARK_BENCHMARKREPORTER_H
+
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "../system/AniraWinExports.h"
+
+namespace anira::benchmark {
+
+/**
+ * @brief Descriptive statistics of the samples of one benchmark
+ */
+struct ANIRA_API BenchmarkSummary {
+    std::string m_name;         ///< Name of the benchmark
+    size_t m_num_samples = 0;   ///< Number of samples
+    double m_mean = 0.;         ///< Arithmetic mean
+    double m_std_dev = 0.;      ///< Sample standard deviation
+    double m_min = 0.;          ///< Smallest sample
+    double m_max = 0.;          ///< Largest sample
+    double m_p50 = 0.;          ///< Median
+    double m_p90 = 0.;          ///< 90th percentile
+    double m_p99 = 0.;          ///< 99th percentile
+    double m_p999 = 0.;         ///< 99.9th percentile
+    double m_jitter = 0.;       ///< Mean absolute difference of consecutive samples
+    size_t m_num_outliers = 0;  ///< Samples outside of the Tukey fences (1.5 IQR beyond the
+                                ///< quartiles)
+};
+
+/**
+ * @brief Result of comparing one benchmark against its baseline
+ */
+struct ANIRA_API BenchmarkComparison {
+    std::string m_name;              ///< Name of the benchmark
+    double m_baseline_median = 0.;   ///< Median of the baseline samples
+    double m_median = 0.;            ///< Median of the current samples
+    double m_relative_change = 0.;   ///< Relative change of the median, positive is slower
+    double m_p_value = 1.;           ///< One-sided Mann-Whitney U p-value of the change
+    bool m_regression = false;       ///< Significantly slower than the baseline
+    bool m_improvement = false;      ///< Significantly faster than the baseline
+};
+
+/**
+ * @brief Collects benchmark samples and reports them as statistics, JSON and baseline comparisons
+ *
+ * The ProcessBlockFixture adds the runtime of every iteration to its reporter, so the results
+ * can be evaluated without post-processing the console output. Samples are kept per benchmark
+ * name, the summary contains percentiles, jitter and the number of outliers.
+ *
+ * write_json() stores the raw samples together with their summary. A file written this way can
+ * be loaded as baseline, compare() then flags the benchmarks whose samples are significantly
+ * slower according to a one-sided Mann-Whitney U test and whose median changed by more than a
+ * minimum relative amount. The rank test makes no assumption about the distribution of the
+ * samples, which are typically skewed towards long runtimes.
+ */
+class ANIRA_API BenchmarkReporter {
+public:
+    /**
+     * @brief Adds a sample to a benchmark
+     *
+     * @param name Name of the benchmark
+     * @param value Sample value, the fixture uses milliseconds
+     */
+    void add_sample(const std::string& name, double value);
+
+    /**
+     * @brief Removes all samples
+     */
+    void clear();
+
+    /**
+     * @brief Gets the samples of all benchmarks, ordered by name
+     */
+    const std::map<std::string, std::vector<double>>& get_samples() const;
+
+    /**
+     * @brief Summarizes the samples of every benchmark
+     *
+     * @return One summary per benchmark, ordered by name
+     */
+    std::vector<BenchmarkSummary> summarize() const;
+
+    /**
+     * @brief Summarizes a set of samples
+     *
+     * @param name Name stored in the summary
+     * @param samples Samples in the order they were taken
+     * @return Summary of the samples
+     */
+    static BenchmarkSummary summarize(const std::string& name, const std::vector<double>& samples);
+
+    /**
+     * @brief Prints a table of the summaries
+     *
+     * @param stream Stream to print to
+     */
+    void print_summary(std::ostream& stream) const;
+
+    /**
+     * @brief Writes the samples and summaries as JSON
+     *
+     * @param file_path Path of the JSON file
+     * @return Whether the file was written
+     */
+    bool write_json(const std::string& file_path) const;
+
+    /**
+     * @brief Replaces the samples with the ones stored in a JSON file written by write_json()
+     *
+     * @param file_path Path of the JSON file
+     * @return Whether the file was read
+     */
+    bool read_json(const std::string& file_path);
+
+    /**
+     * @brief Compares every benchmark that is also part of the baseline
+     *
+     * @param baseline Reporter holding the baseline samples
+     * @param alpha Significance level of the one-sided tests
+     * @param min_relative_change Smallest relative change of the median that is flagged
+     * @return One comparison per benchmark present in both reporters, ordered by name
+     */
+    std::vector<BenchmarkComparison> compare(const BenchmarkReporter& baseline,
+                                             double alpha = 0.01,
+                                             double min_relative_change = 0.05) const;
+
+    /**
+     * @brief Prints a table of the comparisons
+     *
+     * @param stream Stream to print to
+     * @param comparisons Result of compare()
+     */
+    static void print_comparison(std::ostream& stream,
+                                 const std::vector<BenchmarkComparison>& comparisons);
+
+    /**
+     * @brief Writes and compares the results as requested through environment variables
+     *
+     * Prints the summary, writes the JSON file given in ANIRA_BENCHMARK_OUTPUT and compares
+     * against the JSON file given in ANIRA_BENCHMARK_BASELINE. The thresholds can be set with
+     * ANIRA_BENCHMARK_ALPHA and ANIRA_BENCHMARK_MIN_CHANGE.
+     *
+     * @param stream Stream to print to
+     * @return False if a file could not be accessed or a regression was found
+     */
+    bool report_from_environment(std::ostream& stream) const;
+
+    /**
+     * @brief Probability that the samples are not larger than the baseline samples
+     *
+     * One-sided Mann-Whitney U test with normal approximation, tie and continuity correction.
+     *
+     * @param samples Current samples
+     * @param baseline Baseline samples
+     * @return p-value of the hypothesis that the samples tend to be larger
+     */
+    static double mann_whitney_p_value(const std::vector<double>& samples,
+                                       const std::vector<double>& baseline);
+
+private:
+    std::map<std::string, std::vector<double>> m_samples;  ///< Samples per benchmark name
+};
+
+}  // namespace anira::benchmark
+
+#endif  // ANIRA_BENCHMARK_BENCHMARKREPORTER_H
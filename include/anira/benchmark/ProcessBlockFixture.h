@@ -3,10 +3,14 @@
 
 #include <benchmark/benchmark.h>
 
+#include <chrono>
 #include <iomanip>
+#include <memory>
+#include <vector>
 
 #include "../anira.h"
 #include "../utils/helperFunctions.h"
+#include "BenchmarkReporter.h"
 
 namespace anira::benchmark {
 
@@ -49,8 +53,8 @@ public:
      * @brief Initializes the current benchmark iteration
      *
      * Prepares the benchmark for a new iteration by capturing the current state
-     * of processed samples. This method should be called at the beginning of each
-     * benchmark iteration to establish a baseline for measuring progress.
+     * of processed samples for every streamable output tensor. This method should be called at the
+     * beginning of each benchmark iteration to establish a baseline for measuring progress.
      */
     void initialize_iteration();
 
@@ -76,12 +80,42 @@ public:
      * @brief Checks if the current audio buffer has been fully processed
      *
      * Determines whether the inference handler has processed all samples that were
-     * pushed since the last iteration initialization.
+     * pushed since the last iteration initialization. All streamable output tensors must have
+     * received their samples, the time at which each tensor completed is recorded and reported in
+     * interation_step().
      *
      * @return True if the buffer has been processed, false otherwise
      */
     bool buffer_processed();
 
+    /**
+     * @brief Allocates one buffer per input and output tensor of the inference configuration
+     *
+     * Streamable tensors get their channel count from the processing spec and a buffer size
+     * relative to the host buffer size. Non-streamable tensors get a single channel that holds
+     * the complete tensor.
+     *
+     * @param inference_config Inference configuration describing the tensors
+     * @param host_config Audio host configuration with the buffer size of the benchmark
+     */
+    void allocate_tensor_buffers(const InferenceConfig& inference_config,
+                                 const HostConfig& host_config);
+
+    /**
+     * @brief Fills every input tensor buffer with random data
+     *
+     * Requires allocate_tensor_buffers() to be called first.
+     */
+    void push_random_samples_in_tensor_buffers();
+
+    /**
+     * @brief Processes all tensor buffers with the multi-tensor process method of the handler
+     *
+     * Streamable inputs are pushed and streamable outputs popped, non-streamable inputs are set
+     * as parameters and non-streamable outputs are read back.
+     */
+    void process_tensor_buffers();
+
     /**
      * @brief Fills the audio buffer with random sample data
      *
@@ -146,6 +180,16 @@ public:
      */
     inline static std::unique_ptr<anira::Buffer<float>> m_buffer = nullptr;
 
+    /**
+     * @brief Reporter that collects the runtime of every iteration in milliseconds
+     *
+     * The samples are stored per benchmark, model and backend. Call
+     * BenchmarkReporter::report_from_environment() or the reporting methods after
+     * ::benchmark::RunSpecifiedBenchmarks() to get percentiles, jitter, outliers, JSON output and
+     * baseline comparisons.
+     */
+    inline static BenchmarkReporter m_reporter;
+
 private:
     int m_buffer_size = 0;                 ///< Current buffer size being benchmarked
     int m_repetition = 0;                  ///< Current repetition number
@@ -156,6 +200,21 @@ private:
         std::chrono::duration<double, std::milli>(0);  ///< Runtime of the last repetition
     int m_prev_num_received_samples = 0;   ///< Number of samples received at the start of current
                                            ///< iteration
+    std::vector<size_t> m_prev_num_received_samples_per_tensor;  ///< Samples available in every
+                                                                 ///< output tensor at the start
+                                                                 ///< of the current iteration
+    std::vector<std::chrono::steady_clock::time_point>
+        m_tensor_processed_time;  ///< Time at which each output tensor was processed
+    std::vector<bool> m_tensor_processed;  ///< Whether each output tensor has been processed
+    std::vector<double> m_tensor_runtime_sum;  ///< Summed per tensor runtime of the repetition
+    std::vector<std::unique_ptr<Buffer<float>>> m_input_buffers;   ///< One buffer per input
+                                                                   ///< tensor
+    std::vector<std::unique_ptr<Buffer<float>>> m_output_buffers;  ///< One buffer per output
+                                                                   ///< tensor
+    std::vector<const float* const*> m_input_pointers;  ///< Channel pointers of the input buffers
+    std::vector<float* const*> m_output_pointers;  ///< Channel pointers of the output buffers
+    std::vector<size_t> m_num_input_samples;   ///< Samples per input tensor and block
+    std::vector<size_t> m_num_output_samples;  ///< Samples per output tensor and block
     std::string m_model_name;              ///< Name of the model being benchmarked
     std::string m_inference_backend_name;  ///< Name of the inference backend being used
     InferenceBackend m_inference_backend;  ///< Current inference backend configuration
@@ -0,0 +1,160 @@
+#ifndef ANIRA_BENCHMARK_REALTIMEHARNESS_H
+#define ANIRA_BENCHMARK_REALTIMEHARNESS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "../InferenceHandler.h"
+#include "../system/AniraWinExports.h"
+#include "../system/HighPriorityThread.h"
+#include "../utils/Buffer.h"
+#include "../utils/Histogram.h"
+#include "../utils/HostConfig.h"
+
+namespace anira::benchmark {
+
+/**
+ * @brief Outcome of driving an InferenceHandler at a fixed host period for some time
+ */
+struct ANIRA_API RealtimeRunResult {
+    float m_buffer_size = 0.f;          ///< Host buffer size in samples
+    float m_sample_rate = 0.f;          ///< Host sample rate in Hz
+    unsigned int m_latency = 0;         ///< Latency of the first output tensor in samples
+    uint64_t m_num_callbacks = 0;       ///< Number of process calls
+    uint64_t m_underruns = 0;           ///< Zero-filled output blocks, one per process call and
+                                        ///< affected output tensor
+    uint64_t m_missing_samples = 0;     ///< Number of zero-filled output samples
+    uint64_t m_callback_overruns = 0;   ///< Process calls that returned after the next period
+                                        ///< started, where a real host would have dropped out
+    HistogramSnapshot m_callback_time;  ///< Duration of the process calls in ns
+
+    /**
+     * @brief Whether the run neither zero-filled outputs nor overran a period
+     */
+    bool is_safe() const { return m_underruns == 0 && m_callback_overruns == 0; }
+};
+
+/**
+ * @brief Minimum safe latency found for one host configuration
+ */
+struct ANIRA_API LatencySearchResult {
+    float m_buffer_size = 0.f;             ///< Host buffer size in samples
+    float m_sample_rate = 0.f;             ///< Host sample rate in Hz
+    unsigned int m_default_latency = 0;    ///< Latency calculated by anira for this configuration
+    bool m_found = false;                  ///< Whether any tested latency was safe
+    unsigned int m_min_safe_latency = 0;   ///< Smallest tested latency without underruns
+    std::vector<RealtimeRunResult> m_runs;  ///< All runs of the search in the order they were made
+};
+
+/**
+ * @brief Drives an InferenceHandler like an audio host with a fixed callback period
+ *
+ * The benchmark fixtures measure how long an inference takes, which does not tell whether a host
+ * with a fixed callback period would drop out. The RealtimeHarness calls
+ * InferenceHandler::process() on a high priority thread at exact multiples of the host period,
+ * derived from the sample count so the schedule does not drift, and counts the outputs that the
+ * InferenceManager had to zero-fill because the inference was not ready in time.
+ *
+ * Sweeping the latency and the buffer size gives the minimum safe latency and buffer size of a
+ * model and backend on the machine the harness runs on.
+ *
+ * @note The handler must not be used by anyone else while the harness runs, the harness calls
+ *       prepare() with the host configuration and latency of each run.
+ */
+class ANIRA_API RealtimeHarness : public HighPriorityThread {
+public:
+    /**
+     * @brief Creates a harness for the given handler
+     *
+     * @param inference_handler Handler that is prepared and processed by the harness
+     * @param inference_config Configuration the handler was created with
+     */
+    RealtimeHarness(InferenceHandler& inference_handler, InferenceConfig& inference_config);
+
+    ~RealtimeHarness() override;
+
+    /**
+     * @brief Processes random input at the host period for the given duration
+     *
+     * @param host_config Host buffer size and sample rate
+     * @param latency Latency of the first output tensor in samples
+     * @param duration Duration of audio to process, the run takes the same wall time
+     * @return Underruns, overruns and callback timings of the run
+     */
+    RealtimeRunResult measure(const HostConfig& host_config,
+                              unsigned int latency,
+                              std::chrono::milliseconds duration);
+
+    /**
+     * @brief Searches the smallest latency that runs without underruns
+     *
+     * Starts at anira's default latency, doubles it until a run is safe (at most up to
+     * max_latency_factor times the default) and then bisects down to the given resolution.
+     *
+     * @param host_config Host buffer size and sample rate
+     * @param duration Duration of every run
+     * @param resolution Resolution of the search in samples
+     * @param max_latency_factor Largest tested latency as a multiple of the default latency
+     * @return Result of the search including all runs
+     */
+    LatencySearchResult find_min_safe_latency(const HostConfig& host_config,
+                                              std::chrono::milliseconds duration,
+                                              unsigned int resolution = 32,
+                                              unsigned int max_latency_factor = 8);
+
+    /**
+     * @brief Searches the minimum safe latency for several buffer sizes
+     *
+     * @param sample_rate Host sample rate in Hz
+     * @param buffer_sizes Host buffer sizes to test
+     * @param duration Duration of every run
+     * @param resolution Resolution of the latency search in samples
+     * @return One search result per buffer size
+     */
+    std::vector<LatencySearchResult> sweep(float sample_rate,
+                                           const std::vector<float>& buffer_sizes,
+                                           std::chrono::milliseconds duration,
+                                           unsigned int resolution = 32);
+
+    /**
+     * @brief Gets the smallest buffer size that was safe at anira's default latency
+     *
+     * @param results Results of sweep()
+     * @return Smallest safe buffer size, or 0 if none was safe
+     */
+    static float get_min_safe_buffer_size(const std::vector<LatencySearchResult>& results);
+
+    /**
+     * @brief Prints a table of the sweep results
+     *
+     * @param stream Stream to print to
+     * @param results Results of sweep()
+     */
+    static void print_results(std::ostream& stream,
+                              const std::vector<LatencySearchResult>& results);
+
+    /**
+     * @brief Callback loop of the high priority thread
+     */
+    void run() override;
+
+private:
+    InferenceHandler& m_inference_handler;
+    InferenceConfig& m_inference_config;
+
+    HostConfig m_host_config;           ///< Host configuration of the current run
+    uint64_t m_num_callbacks = 0;       ///< Number of callbacks of the current run
+    Buffer<float> m_input;              ///< Random input of the first input tensor
+    Buffer<float> m_output;             ///< Output of the first output tensor
+    Histogram m_callback_time;          ///< Process call durations of the current run
+    std::atomic<uint64_t> m_callback_overruns{0};  ///< Overruns of the current run
+    std::atomic<bool> m_finished{false};  ///< Set by the callback thread when the run is done
+};
+
+}  // namespace anira::benchmark
+
+#endif  // ANIRA_BENCHMARK_REALTIMEHARNESS_H
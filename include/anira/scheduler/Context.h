@@ -5,12 +5,15 @@
 
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "../ContextConfig.h"
 #include "../PrePostProcessor.h"
 #include "../utils/HostConfig.h"
+#include "../utils/MemoryLock.h"
 #include "InferenceThread.h"
+#include "MemoryFootprint.h"
 #include "SessionElement.h"
 
 #ifdef USE_LIBTORCH
@@ -57,6 +60,12 @@ namespace anira {
  */
 class ANIRA_API Context {
 public:
+    static constexpr size_t k_min_capacity_inference_queue = 10000;  ///< Minimum pre-allocated
+                                                                     ///< capacity of the inference
+                                                                     ///< queue
+    static constexpr size_t k_max_num_instances = 1000;  ///< Maximum number of explicit producers
+                                                         ///< for the inference queue
+
     /**
      * @brief Constructor that initializes the context with specified configuration
      *
@@ -72,9 +81,10 @@ public:
      * @brief Destructor that cleans up all context resources
      *
      * Properly shuts down the thread pool, releases all backend processors,
-     * and cleans up any remaining sessions or inference data.
+     * and cleans up any remaining sessions or inference data. Pending messages of the
+     * RealtimeLogger are drained.
      */
-    ~Context() = default;
+    ~Context();
     /**
      * @brief Gets or creates the singleton context instance
      *
@@ -159,6 +169,16 @@ public:
      */
     static int get_num_sessions();
 
+    /**
+     * @brief Gets the number of sessions whose inferences run on a processor
+     *
+     * @param processor Pooled or custom processor to count the sessions of
+     * @return Number of sessions that use the processor
+     *
+     * @note Must not be called concurrently with creating or releasing sessions.
+     */
+    static size_t get_num_sessions_using(const BackendBase* processor);
+
     /**
      * @brief Notifies the context that new data has been submitted for a session
      *
@@ -206,6 +226,31 @@ public:
      */
     static std::vector<std::shared_ptr<SessionElement>>& get_sessions();
 
+    /**
+     * @brief Gets the memory held by all sessions and processors of the context
+     *
+     * Every session is listed with its ring buffers, inference queue tensors and the processors
+     * it uses. Processors shared by several sessions are listed once in m_processors, so the
+     * total can be used to size deployments with many plugin instances.
+     *
+     * @return Footprint of the whole context
+     *
+     * @note This method allocates and must not be called concurrently with creating, preparing
+     *       or releasing sessions.
+     */
+    static ContextMemoryFootprint get_memory_footprint();
+
+    /**
+     * @brief Gets the result of locking the stacks of the inference threads in the pool
+     *
+     * Only filled if ContextConfig::m_lock_memory is set. Threads created with
+     * make_inference_thread() report their status via InferenceThread::get_stack_lock_status(),
+     * sessions via InferenceHandler::get_memory_lock_status().
+     *
+     * @return Locked bytes and failures of all threads that have started
+     */
+    static MemoryLockStatus get_memory_lock_status();
+
     /**
      * @brief Resets a session to its initial state
      *
@@ -307,6 +352,7 @@ private:
      *
      * Initializes and starts all threads in the inference thread pool according
      * to the context configuration. This method is called during context initialization.
+     * Sessions may be prepared from different threads, so starting the pool is serialized.
      */
     static void start_thread_pool();
 
@@ -372,6 +418,8 @@ private:
                                                            ///< active sessions
     inline static bool m_thread_pool_should_exit = false;  ///< Flag indicating whether the thread
                                                            ///< pool should shut down
+    inline static std::mutex m_thread_pool_mutex;  ///< Guards starting, resizing and reading
+                                                   ///< the thread pool from several threads
 
     inline static std::vector<std::unique_ptr<InferenceThread>> m_thread_pool;  ///< Vector of
                                                                                 ///< inference
@@ -384,12 +432,6 @@ private:
                                                                  ///< generating unique producer
                                                                  ///< indices
 
-    static constexpr size_t k_min_capacity_inference_queue = 10000;  ///< Minimum pre-allocated
-                                                                     ///< capacity of the inference
-                                                                     ///< queue
-    static constexpr size_t k_max_num_instances = 1000;  ///< Maximum number of explicit producers
-                                                         ///< for the inference queue
-
     /**
      * @brief Thread-safe concurrent queue for inference requests
      *
@@ -0,0 +1,127 @@
+#ifndef ANIRA_INFERENCECACHE_H
+#define ANIRA_INFERENCECACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "../system/AniraWinExports.h"
+#include "../utils/Buffer.h"
+#include "../utils/InferenceBackend.h"
+
+namespace anira {
+
+/**
+ * @brief Cache of the outputs of recently seen inference inputs of one session
+ *
+ * Memoizes the model of a session: before an inference is submitted, the pre-processed input
+ * tensors are hashed and compared with the inputs of the cached entries. On a hit the cached
+ * outputs are copied into the output tensors and the inference is skipped, e.g. for models that
+ * only take parameter tensors which change when the user moves a control. On a miss the least
+ * recently used entry is reserved for the inputs and filled with the outputs once the inference
+ * completes.
+ *
+ * All entries are allocated in prepare(), lookup() and store() are real-time safe. Both are
+ * called from the thread processing the session, so the cache needs no synchronization.
+ *
+ * @warning Only valid for models whose outputs depend on nothing but their inputs. Models with
+ * internal state must not be memoized.
+ *
+ * @see InferenceHandler::set_memoization_cache_size()
+ */
+class ANIRA_API InferenceCache {
+public:
+    /** @brief Entry of a ticket that reserved none */
+    static constexpr size_t k_no_entry = std::numeric_limits<size_t>::max();
+
+    /**
+     * @brief Reservation of an entry for the outputs of a submitted inference
+     */
+    struct Ticket {
+        size_t m_entry = k_no_entry;  ///< Index of the reserved entry
+        uint64_t m_generation = 0;    ///< Generation of the entry when it was reserved
+    };
+
+    /**
+     * @brief Inputs and outputs of one inference
+     */
+    struct Entry {
+        std::vector<BufferF> m_inputs;   ///< Copy of the input tensors
+        std::vector<BufferF> m_outputs;  ///< Copy of the output tensors, valid if m_valid is set
+        uint64_t m_hash = 0;             ///< Hash of the input tensors
+        InferenceBackend m_backend = InferenceBackend::CUSTOM;  ///< Backend that computed the
+                                                                ///< outputs
+        uint64_t m_generation = 0;  ///< Changes whenever the entry is reserved again
+        uint64_t m_last_used = 0;   ///< Lookup count of the last hit or reservation
+        bool m_valid = false;       ///< Whether the outputs have been stored
+    };
+
+    /**
+     * @brief Allocates the entries, discarding all cached outputs
+     *
+     * @param num_entries Number of recently seen inputs to keep, 0 disables the cache
+     * @param tensor_input_size Vector of input tensor sizes
+     * @param tensor_output_size Vector of output tensor sizes
+     */
+    void prepare(size_t num_entries,
+                 const std::vector<size_t>& tensor_input_size,
+                 const std::vector<size_t>& tensor_output_size);
+
+    /**
+     * @brief Discards all cached outputs and reservations
+     */
+    void clear();
+
+    /**
+     * @brief Checks whether the cache has any entries
+     */
+    bool is_enabled() const;
+
+    /**
+     * @brief Looks up the outputs of the given inputs
+     *
+     * @param input Pre-processed input tensors
+     * @param output Output tensors, receive the cached outputs on a hit
+     * @param backend Backend the inference would run on, outputs of other backends do not match
+     * @param ticket Receives the entry reserved for the outputs on a miss
+     * @return Whether the outputs were found and copied
+     */
+    bool lookup(const std::vector<BufferF>& input,
+                std::vector<BufferF>& output,
+                InferenceBackend backend,
+                Ticket& ticket);
+
+    /**
+     * @brief Stores the outputs of a completed inference in the entry reserved by lookup()
+     *
+     * Does nothing if the ticket reserved no entry or the entry was reserved again meanwhile.
+     *
+     * @param ticket Ticket returned by lookup()
+     * @param output Output tensors of the inference
+     */
+    void store(const Ticket& ticket, const std::vector<BufferF>& output);
+
+    /**
+     * @brief Gets all entries, e.g. to account or lock their memory
+     */
+    const std::vector<Entry>& get_entries() const;
+    std::vector<Entry>& get_entries();
+
+    /**
+     * @brief Calculates the hash of a set of tensors
+     *
+     * @param tensors Tensors to hash, the bit patterns of the values are hashed
+     * @return 64-bit FNV-1a hash over the 32-bit patterns of all values
+     */
+    static uint64_t calculate_hash(const std::vector<BufferF>& tensors);
+
+private:
+    std::vector<Entry> m_entries;  ///< Entries of the cache, empty if disabled
+    uint64_t m_clock = 0;          ///< Number of lookups, orders the entries by last use
+    uint64_t m_generation = 0;     ///< Number of reservations
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_INFERENCECACHE_H
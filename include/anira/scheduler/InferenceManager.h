@@ -1,12 +1,18 @@
 #ifndef ANIRA_INFERENCEMANAGER_H
 #define ANIRA_INFERENCEMANAGER_H
 
+#include <chrono>
+
 #include "../ContextConfig.h"
 #include "../InferenceConfig.h"
 #include "../PrePostProcessor.h"
+#include "../utils/Buffer.h"
 #include "../utils/HostConfig.h"
+#include "../utils/InferenceTimeCalibration.h"
+#include "../utils/MemoryLock.h"
 #include "Context.h"
 #include "InferenceThread.h"
+#include "SessionStatistics.h"
 
 namespace anira {
 
@@ -153,6 +159,32 @@ public:
                      size_t* num_output_samples,
                      std::chrono::steady_clock::time_point wait_until);
 
+    /**
+     * @brief Renders complete multi-tensor spans offline with maximum throughput
+     *
+     * Processes a whole file or a large span in one call instead of one host buffer at a
+     * time. The session is temporarily re-prepared for offline rendering: the span is cut
+     * into blocks of as many preprocessing windows as the session has parallel processors,
+     * new blocks are submitted as soon as enough structs are free so that all workers stay
+     * busy, and no real-time latency padding is inserted. The internal model latency is
+     * removed from the output and the tail is flushed with zeros, so output sample n is
+     * aligned with input sample n. After rendering, the session is re-prepared with the
+     * host configuration of the last prepare() call.
+     *
+     * @param input_data Input data organized as data[tensor_index][channel][sample]
+     * @param num_input_samples Array of input sample counts for each tensor
+     * @param output_data Output data buffers organized as data[tensor_index][channel][sample]
+     * @param num_output_samples Array of output sample counts to render for each tensor
+     * @return Array of actual output sample counts for each tensor
+     *
+     * @note This method blocks until the whole span is rendered and is not real-time safe.
+     *       prepare() must have been called before.
+     */
+    size_t* render(const float* const* const* input_data,
+                   size_t* num_input_samples,
+                   float* const* const* output_data,
+                   size_t* num_output_samples);
+
     /**
      * @brief Sets the inference backend to use for neural network processing
      *
@@ -171,6 +203,47 @@ public:
      */
     InferenceBackend get_backend() const;
 
+    /**
+     * @brief Sets the calibration of the max inference time applied by the next prepare() calls
+     *
+     * @param calibration Options of the calibration, disabled calibrations restore the configured
+     *                    max inference time
+     */
+    void set_inference_time_calibration(const InferenceTimeCalibration& calibration);
+
+    /**
+     * @brief Gets the max inference time the latency of the last prepare() call is based on
+     *
+     * @return Calibrated max inference time in ms if calibration is enabled, otherwise the
+     *         configured one
+     */
+    float get_max_inference_time() const;
+
+    /**
+     * @brief Enables or disables placing all buffers of the session in one slab
+     *
+     * Takes effect with the next prepare() call.
+     *
+     * @param enabled Whether the session buffers are allocated from a single Arena
+     */
+    void set_arena_enabled(bool enabled);
+
+    /**
+     * @brief Sets the number of recently seen inputs whose outputs are reused
+     *
+     * Takes effect with the next prepare() call.
+     *
+     * @param num_entries Number of entries of the InferenceCache, 0 disables memoization
+     */
+    void set_memoization_cache_size(size_t num_entries);
+
+    /**
+     * @brief Gets the result of locking the memory of the session in the last prepare() call
+     *
+     * @return Locked bytes and failures, empty if ContextConfig::m_lock_memory is not set
+     */
+    MemoryLockStatus get_memory_lock_status() const;
+
     /**
      * @brief Gets the processing latency for all tensors
      *
@@ -182,6 +255,29 @@ public:
      */
     std::vector<unsigned int> get_latency() const;
 
+    /**
+     * @brief Gets a snapshot of the timing statistics of this session
+     *
+     * @return Snapshot of the session's histograms and counters
+     *
+     * @note This method allocates and must not be called from the audio thread.
+     */
+    InferenceStatistics get_statistics() const;
+
+    /**
+     * @brief Resets the timing statistics of this session
+     */
+    void reset_statistics();
+
+    /**
+     * @brief Gets the memory held by this session and its processors
+     *
+     * @return Footprint of the session broken down by category
+     *
+     * @note This method allocates and must not be called from the audio thread.
+     */
+    MemoryFootprint get_memory_footprint() const;
+
     /**
      * @brief Gets the number of samples received for a specific tensor and channel (for unit
      * testing)
@@ -237,6 +333,47 @@ public:
     void reset();
 
 private:
+    /**
+     * @brief Prepares the session for a host configuration without calibrating
+     *
+     * @param new_config Host configuration to prepare for
+     * @param custom_latency Custom latency per output tensor, -1 to calculate it
+     */
+    void prepare_session(HostConfig new_config, std::vector<long> custom_latency);
+
+    /**
+     * @brief Renders a span of samples at a given sample rate in blocks of whole windows
+     *
+     * @param input_data Input data organized as data[tensor_index][channel][sample]
+     * @param num_input_samples Array of input sample counts for each tensor
+     * @param output_data Output data buffers organized as data[tensor_index][channel][sample]
+     * @param num_output_samples Array of requested output sample counts for each tensor
+     * @param sample_rate Sample rate the session is prepared for while rendering
+     * @return Array of actual output sample counts for each tensor
+     */
+    size_t* render_blocks(const float* const* const* input_data,
+                          size_t* num_input_samples,
+                          float* const* const* output_data,
+                          size_t* num_output_samples,
+                          float sample_rate);
+
+    /**
+     * @brief Renders a span of samples of a model running at another sample rate than the host
+     *
+     * Resamples the whole span to the model sample rate, renders it with render_blocks() and
+     * resamples the result back, removing the delay of both filters.
+     *
+     * @param input_data Input data organized as data[tensor_index][channel][sample]
+     * @param num_input_samples Array of input sample counts for each tensor
+     * @param output_data Output data buffers organized as data[tensor_index][channel][sample]
+     * @param num_output_samples Array of requested output sample counts for each tensor
+     * @return Array of actual output sample counts for each tensor
+     */
+    size_t* render_resampled(const float* const* const* input_data,
+                             size_t* num_input_samples,
+                             float* const* const* output_data,
+                             size_t* num_output_samples);
+
     /**
      * @brief Processes input data through the preprocessing pipeline
      *
@@ -260,6 +397,13 @@ private:
      */
     size_t* process_output(float* const* const* output_data, size_t* num_samples);
 
+    /**
+     * @brief Counts the structs of the session that are ready to receive new input
+     *
+     * @return Number of free thread-safe structs in the session's inference queue
+     */
+    size_t get_num_free_structs() const;
+
     /**
      * @brief Clears audio data buffers
      *
@@ -275,6 +419,14 @@ private:
                     const std::vector<size_t>& num_channels);
 
 private:
+    static constexpr std::chrono::milliseconds k_render_wait_timeout{10};  ///< Longest wait for
+                                                                           ///< an inference while
+                                                                           ///< rendering
+    static constexpr std::chrono::microseconds k_render_poll_interval{50};  ///< Sleep between
+                                                                            ///< checks for done
+                                                                            ///< inferences without
+                                                                            ///< semaphores
+
     std::shared_ptr<Context> m_context;  ///< Shared pointer to the inference context managing
                                          ///< threads and sessions
 
@@ -283,9 +435,17 @@ private:
     PrePostProcessor& m_pp_processor;  ///< Reference to the preprocessing/postprocessing pipeline
     std::shared_ptr<SessionElement> m_session;  ///< Shared pointer to the current inference session
     HostConfig m_host_config;                   ///< Current host audio configuration
+    std::vector<long> m_custom_latency;  ///< Custom latency of the last prepare call, restored
+                                         ///< after offline rendering
+    InferenceTimeCalibration m_calibration;  ///< Calibration of the max inference time applied
+                                             ///< in prepare()
 
     std::vector<size_t> m_missing_samples;  ///< Track missing samples for latency compensation and
                                             ///< buffering
+    std::vector<BufferF> m_resampled_input;   ///< Input of every tensor at the model sample rate
+    std::vector<BufferF> m_resampled_output;  ///< Output of every tensor at the model sample rate
+    std::vector<size_t> m_required_samples;  ///< Model samples each output tensor needs for the
+                                             ///< current block
 
 #if DOXYGEN
     // Since Doxygen does not find classes structures nested in std::shared_ptr
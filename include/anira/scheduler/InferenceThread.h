@@ -11,6 +11,7 @@
 #include <concurrentqueue.h>
 
 #include "../utils/Buffer.h"
+#include "../utils/MemoryLock.h"
 #include "SessionElement.h"
 #ifdef __x86_64__
 #include <immintrin.h>
@@ -53,18 +54,11 @@ public:
      *
      * @param next_inference Reference to a thread-safe concurrent queue containing
      *                      inference data structures to process
+     * @param lock_stack Whether run_loop() prefaults and locks the stack of the thread before
+     *                   processing, see ContextConfig::m_lock_memory
      */
-    /**
-     * @brief Constructor that initializes the inference thread with a task queue
-     *
-     * Creates an inference thread that will process inference requests from the
-     * provided concurrent queue. The thread is not started automatically and
-     * must be explicitly started using the start() method.
-     *
-     * @param next_inference Reference to a thread-safe concurrent queue containing
-     *                      inference data structures to process
-     */
-    InferenceThread(moodycamel::ConcurrentQueue<InferenceData>& next_inference);
+    InferenceThread(moodycamel::ConcurrentQueue<InferenceData>& next_inference,
+                    bool lock_stack = false);
 
     ~InferenceThread()
 #ifndef __EMSCRIPTEN__
@@ -101,6 +95,16 @@ public:
      */
     void run_loop();
 
+    /**
+     * @brief Gets the result of locking the stack of the thread
+     *
+     * The stack is locked once, by the first run_loop() call of the thread.
+     *
+     * @return Locked bytes and failures, empty if locking was not requested or the loop has not
+     *         started yet
+     */
+    MemoryLockStatus get_stack_lock_status() const;
+
 #ifdef __EMSCRIPTEN__
     // Externally driven lifecycle — the JS Worker owns the thread.
     void start();
@@ -138,10 +142,12 @@ private:
      * inference method that directly interfaces with the ML backends.
      *
      * @param session Shared pointer to the SessionElement containing the inference backend
+     * @param backend Backend the inference runs on, the layout of the tensors was chosen for it
      * @param input Vector of input buffers containing the audio data to process
      * @param output Vector of output buffers to receive the processed results
      */
     void inference(const std::shared_ptr<SessionElement>& session,
+                   InferenceBackend backend,
                    std::vector<BufferF>& input,
                    std::vector<BufferF>& output);
 
@@ -166,6 +172,10 @@ private:
     InferenceData m_inference_data;  ///< Current inference data being processed by this thread
     moodycamel::ConsumerToken m_consumer_token;
 
+    bool m_lock_stack;                        ///< Whether run_loop() locks the stack
+    MemoryLockStatus m_stack_lock_status;     ///< Result of locking the stack, written once
+    std::atomic<bool> m_stack_locked{false};  ///< Publishes m_stack_lock_status to other threads
+
 #ifdef __EMSCRIPTEN__
     std::atomic<bool> m_should_exit{false};
     std::atomic<bool> m_is_running{false};
@@ -0,0 +1,73 @@
+#ifndef ANIRA_MEMORYFOOTPRINT_H
+#define ANIRA_MEMORYFOOTPRINT_H
+
+#include <cstddef>
+#include <vector>
+
+#include "../system/AniraWinExports.h"
+#include "../utils/InferenceBackend.h"
+
+namespace anira {
+
+/**
+ * @brief Memory held by one backend processor
+ *
+ * A processor is shared by all sessions with an equal InferenceConfig unless the config requests
+ * a session exclusive processor, m_num_sessions tells how many sessions the bytes are shared by.
+ */
+struct ANIRA_API BackendMemoryFootprint {
+    InferenceBackend m_backend = InferenceBackend::CUSTOM;  ///< Backend of the processor
+    size_t m_num_instances = 0;   ///< Number of parallel instances of the processor
+    size_t m_num_sessions = 0;    ///< Number of sessions using the processor
+    size_t m_tensor_bytes = 0;    ///< Input and output tensors of all instances
+    size_t m_model_bytes = 0;     ///< Model weights of all instances, as exposed by the backend or
+                                  ///< estimated from the size of the serialized model
+
+    /**
+     * @brief Gets the sum of all categories in bytes
+     */
+    size_t get_total_bytes() const;
+};
+
+/**
+ * @brief Memory held by one session, broken down by category
+ *
+ * Returned by InferenceHandler::get_memory_footprint(). The sizes are calculated from the
+ * allocated buffers, allocator overhead and memory held inside the inference runtimes that is
+ * not exposed through their APIs are not included.
+ */
+struct ANIRA_API MemoryFootprint {
+    int m_session_id = -1;              ///< Session the footprint belongs to
+    size_t m_send_buffer_bytes = 0;     ///< Ring buffers from the audio thread to pre-processing
+    size_t m_receive_buffer_bytes = 0;  ///< Ring buffers from post-processing to the audio thread
+    size_t m_num_structs = 0;           ///< Number of structures in the inference queue
+    size_t m_struct_tensor_bytes = 0;   ///< Input and output tensors of all structures
+    size_t m_cache_bytes = 0;           ///< Inputs and outputs held by the inference cache
+    std::vector<BackendMemoryFootprint> m_backends;  ///< Processors used by the session
+
+    /**
+     * @brief Gets the sum of the session buffers and all processors in bytes
+     *
+     * Processors shared with other sessions are counted in full.
+     */
+    size_t get_total_bytes() const;
+};
+
+/**
+ * @brief Memory held by all sessions and processors of the Context
+ *
+ * Returned by Context::get_memory_footprint().
+ */
+struct ANIRA_API ContextMemoryFootprint {
+    std::vector<MemoryFootprint> m_sessions;           ///< Footprint of every session
+    std::vector<BackendMemoryFootprint> m_processors;  ///< Every processor, counted once
+
+    /**
+     * @brief Gets the sum of all session buffers and all processors in bytes
+     */
+    size_t get_total_bytes() const;
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_MEMORYFOOTPRINT_H
@@ -0,0 +1,244 @@
+#ifndef ANIRA_SCHEDULERSIMULATOR_H
+#define ANIRA_SCHEDULERSIMULATOR_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../ContextConfig.h"
+#include "../InferenceConfig.h"
+#include "../system/AniraWinExports.h"
+#include "../utils/Histogram.h"
+#include "../utils/HostConfig.h"
+
+namespace anira {
+
+/**
+ * @brief Distribution of inference times the SchedulerSimulator draws from
+ *
+ * Can be given statistically (constant, normal or log-normal) or from measurements, either as
+ * raw samples, e.g. the m_inference_ns of an InputRecorder recording, or as the inference
+ * histogram of the InferenceStatistics of a running session.
+ */
+class ANIRA_API InferenceTimeDistribution {
+public:
+    /**
+     * @brief Every inference takes the same time
+     *
+     * @param time_ms Inference time in ms
+     */
+    static InferenceTimeDistribution constant(double time_ms);
+
+    /**
+     * @brief Normally distributed inference times, negative draws are clamped to zero
+     *
+     * @param mean_ms Mean inference time in ms
+     * @param std_dev_ms Standard deviation in ms
+     */
+    static InferenceTimeDistribution normal(double mean_ms, double std_dev_ms);
+
+    /**
+     * @brief Log-normally distributed inference times, which model the long tail of real runs
+     *
+     * @param mean_ms Mean inference time in ms
+     * @param std_dev_ms Standard deviation in ms
+     */
+    static InferenceTimeDistribution log_normal(double mean_ms, double std_dev_ms);
+
+    /**
+     * @brief Draws uniformly from measured inference times
+     *
+     * @param samples_ms Measured inference times in ms
+     */
+    static InferenceTimeDistribution empirical(const std::vector<double>& samples_ms);
+
+    /**
+     * @brief Draws from the buckets of a histogram of inference times
+     *
+     * Buckets are chosen according to their counts and the value is drawn uniformly within the
+     * bucket, clamped to the recorded minimum and maximum.
+     *
+     * @param snapshot Histogram of inference times in ns, e.g. the m_inference histogram of a
+     *                 BackendStatisticsSnapshot
+     */
+    static InferenceTimeDistribution from_histogram(const HistogramSnapshot& snapshot);
+
+    /**
+     * @brief Draws an inference time
+     *
+     * @param generator Random number generator of the simulation
+     * @return Inference time in ms
+     */
+    double sample(std::mt19937_64& generator) const;
+
+private:
+    enum Type { CONSTANT, NORMAL, LOG_NORMAL, EMPIRICAL };
+
+    Type m_type = CONSTANT;
+    double m_first = 0.;   ///< Constant time, mean or log-space mean
+    double m_second = 0.;  ///< Standard deviation or log-space standard deviation
+    std::vector<double> m_lower_bounds;         ///< Lower bound of every empirical bin in ms
+    std::vector<double> m_upper_bounds;         ///< Upper bound of every empirical bin in ms
+    std::vector<double> m_cumulative_weights;   ///< Running sum of the bin weights
+};
+
+/**
+ * @brief Predicted behaviour of one simulated session
+ */
+struct ANIRA_API SimulatedSessionResult {
+    unsigned int m_latency = 0;     ///< Latency anira would choose for the session in samples
+    size_t m_num_structs = 0;       ///< Number of inference structs anira would allocate
+    uint64_t m_deadline_ns = 0;     ///< Audio deadline of an inference in ns
+    uint64_t m_num_callbacks = 0;   ///< Number of simulated host callbacks
+    uint64_t m_num_inferences = 0;  ///< Number of completed inferences
+    uint64_t m_deadline_misses = 0;      ///< Inferences that completed after the deadline
+    uint64_t m_dropped_inferences = 0;   ///< Inferences skipped because no struct was free
+    uint64_t m_underruns = 0;            ///< Callbacks whose output had to be zero-filled
+    uint64_t m_missing_samples = 0;      ///< Zero-filled output samples
+    HistogramSnapshot m_completion;      ///< Time from submission until the result was ready
+                                         ///< in ns
+
+    /**
+     * @brief Gets the fraction of inferences that completed after the deadline
+     */
+    double get_deadline_miss_rate() const;
+
+    /**
+     * @brief Gets the fraction of callbacks whose output had to be zero-filled
+     */
+    double get_underrun_rate() const;
+};
+
+/**
+ * @brief Predicted behaviour of a mix of sessions sharing one Context
+ */
+struct ANIRA_API SimulationResult {
+    std::vector<SimulatedSessionResult> m_sessions;  ///< Result of every session in insertion order
+    double m_thread_utilization = 0.;  ///< Fraction of the time the inference threads were busy,
+                                       ///< including time spent waiting for a processor instance
+
+    /**
+     * @brief Gets the fraction of inferences of all sessions that completed after the deadline
+     */
+    double get_deadline_miss_rate() const;
+
+    /**
+     * @brief Gets the fraction of callbacks of all sessions whose output had to be zero-filled
+     */
+    double get_underrun_rate() const;
+};
+
+/**
+ * @brief Discrete-event simulation of the Context scheduler for capacity planning
+ *
+ * Predicts deadline misses and underruns for a mix of sessions without running any model. The
+ * latency and number of inference structs of every session are calculated by a SessionElement
+ * with the same InferenceConfig and HostConfig, so the simulation uses exactly the values anira
+ * would choose. Inference times are drawn from an InferenceTimeDistribution per session.
+ *
+ * The simulation follows the dispatch rules of the Context:
+ * - Every host callback submits an inference for each complete preprocessing window. If no
+ *   struct is free the window is skipped and zeros are pushed to the output.
+ * - Submitted inferences wait in one FIFO queue shared by m_num_threads inference threads. An idle
+ *   thread notices a new inference after up to the 100 us poll interval of the InferenceThread.
+ * - Sessions with equal configs share a processor with m_num_parallel_processors instances, a
+ *   thread whose processor has no free instance waits for one. Sessions with a session exclusive
+ *   processor have at most one inference in the queue and run them in order.
+ * - Results are collected in submission order. With a blocking ratio the callback waits up to
+ *   that fraction of the host period for them. When the output buffer holds fewer samples than
+ *   the callback needs, the output is zero-filled and the missing samples are skipped later.
+ *
+ * Pre- and post-processing, the cost of the callback itself and interference of other processes
+ * are not modelled, so the results are a lower bound for the misses on a real system.
+ *
+ * @code
+ * anira::SchedulerSimulator simulator(anira::ContextConfig(4));
+ * size_t max_sessions = simulator.find_max_sessions(
+ *     inference_config,
+ *     anira::HostConfig(256, 48000),
+ *     anira::InferenceTimeDistribution::log_normal(2., 0.5),
+ *     std::chrono::seconds(10));
+ * @endcode
+ */
+class ANIRA_API SchedulerSimulator {
+public:
+    static constexpr std::chrono::microseconds k_poll_interval{100};  ///< Idle thread poll period
+
+    /**
+     * @brief Creates a simulator for a Context with the given number of inference threads
+     *
+     * @param context_config Config whose m_num_threads is simulated
+     * @param seed Seed of the random number generator, runs with equal seeds are identical
+     */
+    SchedulerSimulator(const ContextConfig& context_config = ContextConfig(), uint64_t seed = 0);
+
+    /**
+     * @brief Destroys the simulator and its sessions
+     */
+    ~SchedulerSimulator();
+
+    SchedulerSimulator(const SchedulerSimulator&) = delete;
+    SchedulerSimulator& operator=(const SchedulerSimulator&) = delete;
+
+    /**
+     * @brief Adds a session to the simulated mix
+     *
+     * @param inference_config Config of the session, copied
+     * @param host_config Host buffer size and sample rate of the session
+     * @param inference_time Distribution of the inference times of the session
+     * @param offset Time of the first callback, sessions of one host usually share 0
+     * @return Index of the session in SimulationResult::m_sessions
+     */
+    size_t add_session(const InferenceConfig& inference_config,
+                       const HostConfig& host_config,
+                       const InferenceTimeDistribution& inference_time,
+                       std::chrono::microseconds offset = std::chrono::microseconds(0));
+
+    /**
+     * @brief Removes all sessions
+     */
+    void clear_sessions();
+
+    /**
+     * @brief Simulates all sessions for the given amount of audio time
+     *
+     * @param duration Simulated time
+     * @return Predicted behaviour of every session
+     */
+    SimulationResult run(std::chrono::milliseconds duration);
+
+    /**
+     * @brief Finds how many identical sessions the simulated Context can run
+     *
+     * Adds one session after the other until the underrun rate of a run exceeds the limit. The
+     * sessions added before are removed.
+     *
+     * @param inference_config Config of every session
+     * @param host_config Host buffer size and sample rate of every session
+     * @param inference_time Distribution of the inference times of every session
+     * @param duration Simulated time of every run
+     * @param max_underrun_rate Highest acceptable fraction of zero-filled callbacks
+     * @param max_sessions Largest number of sessions that is tried
+     * @return Largest number of sessions within the limit, 0 if a single session exceeds it
+     */
+    size_t find_max_sessions(const InferenceConfig& inference_config,
+                             const HostConfig& host_config,
+                             const InferenceTimeDistribution& inference_time,
+                             std::chrono::milliseconds duration,
+                             double max_underrun_rate = 0.,
+                             size_t max_sessions = 64);
+
+private:
+    struct Session;
+
+    unsigned int m_num_threads;
+    uint64_t m_seed;
+    std::vector<std::unique_ptr<Session>> m_sessions;
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_SCHEDULERSIMULATOR_H
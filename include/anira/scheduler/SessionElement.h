@@ -4,16 +4,26 @@
 #include <concurrentqueue.h>
 
 #include <atomic>
+#include <chrono>
 #include <queue>
+#include <utility>
 
 #include "../InferenceConfig.h"
 #include "../PrePostProcessor.h"
 #include "../backends/BackendBase.h"
+#include "../utils/AlignedAllocator.h"
+#include "../utils/Arena.h"
 #include "../utils/Buffer.h"
 #include "../utils/HostConfig.h"
 #include "../utils/InferenceBackend.h"
+#include "../utils/MemoryLock.h"
+#include "../utils/Resampler.h"
 #include "../utils/RingBuffer.h"
 #include "../utils/Semaphore.h"
+#include "../utils/SpectralTransform.h"
+#include "InferenceCache.h"
+#include "MemoryFootprint.h"
+#include "SessionStatistics.h"
 
 namespace anira {
 
@@ -79,6 +89,11 @@ public:
                    PrePostProcessor& pp_processor,
                    InferenceConfig& inference_config);
 
+    /**
+     * @brief Destructor that unlocks the memory locked by lock_memory()
+     */
+    ~SessionElement();
+
     /**
      * @brief Clears all session data and resets to initial state
      *
@@ -158,9 +173,71 @@ public:
      */
     std::vector<size_t> calculate_receive_buffer_sizes(const HostConfig& host_config) const;
 
+    /**
+     * @brief Gets the memory held by this session and its processors
+     *
+     * @return Footprint broken down into ring buffers, inference queue tensors and processors
+     *
+     * @note This method allocates and must not be called concurrently with prepare().
+     */
+    MemoryFootprint get_memory_footprint() const;
+
+    /**
+     * @brief Gets the processor the inferences of a backend run on
+     *
+     * @param backend Backend to get the processor for
+     * @return Processor of the backend, the default processor if the session has none for it
+     */
+    BackendBase& get_processor(InferenceBackend backend);
+
+    /**
+     * @brief Checks whether the inferences of any backend run on a processor
+     *
+     * @param processor Processor to look for
+     * @return True if one of the processors of the session is the given one
+     */
+    bool uses_processor(const BackendBase* processor) const;
+
+    /**
+     * @brief Gets the max inference time the latency and number of structs are calculated with
+     *
+     * @return The calibrated max inference time if there is one, otherwise the configured one
+     */
+    float get_max_inference_time() const;
+
+    /**
+     * @brief Prefaults and locks the buffers of this session and the memory of its processors
+     *
+     * Locks the slab in arena mode, otherwise every ring buffer and tensor of the inference
+     * structures, the entries of the inference cache, and calls BackendBase::lock_memory() of
+     * all processors. The result is stored in
+     * m_memory_lock_status. Called by the Context after prepare() if ContextConfig::m_lock_memory
+     * is set.
+     */
+    void lock_memory();
+
+    /**
+     * @brief Unlocks the buffers locked by lock_memory()
+     *
+     * Must be called before the buffers are freed, i.e. before prepare(). Pages shared with the
+     * locked buffers of other sessions stay locked, see MemoryLock::unlock(). The memory of the
+     * processors stays locked, since it may be shared with other sessions.
+     */
+    void unlock_memory();
+
     std::vector<RingBuffer> m_send_buffer;  ///< Ring buffers for input data streaming to inference
     std::vector<RingBuffer> m_receive_buffer;  ///< Ring buffers for output data streaming from
                                                ///< inference
+    std::vector<Resampler> m_send_resampler;  ///< Resamplers from the host to the model sample
+                                              ///< rate in front of the send buffers
+    std::vector<Resampler> m_receive_resampler;  ///< Resamplers from the model to the host sample
+                                                 ///< rate behind the receive buffers
+    bool m_resampling = false;  ///< Whether the host and the model sample rate differ, the
+                                ///< resamplers are only prepared if set
+    std::vector<SpectralTransform> m_input_transform;   ///< Spectral stage of every input tensor
+    std::vector<SpectralTransform> m_output_transform;  ///< Spectral stage of every output tensor
+    std::vector<BufferF> m_overlap_tail;  ///< Samples of every output tensor still overlapped by
+                                          ///< the frames of the next inference
 
     /**
      * @brief Thread-safe data structure for concurrent inference processing
@@ -174,6 +251,9 @@ public:
      * - Completion notification (m_done_semaphore, m_done_atomic)
      * - Data integrity during concurrent access
      * - Timestamping for latency tracking
+     *
+     * The flags written by the audio thread and the inference threads sit on separate cache
+     * lines, and no two structures share a cache line.
      */
     struct ThreadSafeStruct {
         /**
@@ -188,33 +268,163 @@ public:
         ThreadSafeStruct(const std::vector<size_t>& tensor_input_size,
                          const std::vector<size_t>& tensor_output_size);
 
-        std::atomic<bool> m_free{true};  ///< Atomic flag indicating if this structure is available
-                                         ///< for use
-        anira::Semaphore m_done_semaphore{0};    ///< Semaphore for blocking wait on inference
-                                                 ///< completion
-        std::atomic<bool> m_done_atomic{false};  ///< Atomic flag for non-blocking completion
-                                                 ///< checking
-
-        unsigned long m_time_stamp;                ///< Timestamp for latency tracking and debugging
+        /**
+         * @brief Constructor that places the tensor data in an arena
+         *
+         * @param tensor_input_size Vector of input tensor sizes
+         * @param tensor_output_size Vector of output tensor sizes
+         * @param arena Arena the tensor data is allocated from, must outlive the structure
+         */
+        ThreadSafeStruct(const std::vector<size_t>& tensor_input_size,
+                         const std::vector<size_t>& tensor_output_size,
+                         Arena& arena);
+
+        alignas(k_cache_line_size) std::atomic<bool> m_free{true};  ///< Atomic flag indicating if
+                                                                    ///< this structure is
+                                                                    ///< available for use
+        alignas(k_cache_line_size) std::atomic<bool> m_done_atomic{false};  ///< Atomic flag for
+                                                                            ///< non-blocking
+                                                                            ///< completion checking
+        anira::Semaphore m_done_semaphore{0};  ///< Semaphore for blocking wait on inference
+                                               ///< completion
+
+        alignas(k_cache_line_size) unsigned long m_time_stamp;  ///< Timestamp for latency tracking
+                                                                ///< and debugging
+        std::chrono::steady_clock::time_point m_submit_time;  ///< Time the struct was handed to
+                                                              ///< the inference queue
         std::vector<BufferF> m_tensor_input_data;  ///< Input tensor data buffers
         std::vector<BufferF> m_tensor_output_data;  ///< Output tensor data buffers
+        InferenceCache::Ticket m_cache_ticket;  ///< Cache entry reserved for the outputs of the
+                                                ///< submitted inference
+        std::vector<BufferF> m_layout_input_scratch;   ///< Tensors the channels-last inputs
+                                                       ///< are transposed into, empty for
+                                                       ///< tensors no backend transposes
+        std::vector<BufferF> m_layout_output_scratch;  ///< Tensors the channels-last outputs
+                                                       ///< are transposed into, empty for
+                                                       ///< tensors no backend transposes
+        std::vector<BufferF> m_spectral_input_data;   ///< Features of the spectral inputs, empty
+                                                      ///< for tensors without spectral stage
+        std::vector<BufferF> m_spectral_output_data;  ///< Spectra of the spectral outputs, empty
+                                                      ///< for tensors without spectral stage
+        BufferF m_spectral_work;  ///< Scratch memory of the spectral transforms
+    };
+
+    /**
+     * @brief Slab holding all buffers of a session prepared in arena mode
+     *
+     * Holds the send and receive buffers, the thread-safe structures and their tensors in one
+     * Arena. The structures in m_inference_queue share the ownership of the slab, so it outlives
+     * inferences that still hold a structure while the session is prepared again.
+     */
+    struct SessionArena {
+        /**
+         * @brief Constructor that allocates the slab
+         *
+         * @param capacity Size of the slab in bytes
+         */
+        SessionArena(size_t capacity);
+
+        /**
+         * @brief Destructor that destroys the structures constructed in the slab
+         */
+        ~SessionArena();
+
+        Arena m_arena;                          ///< Slab all buffers are allocated from
+        ThreadSafeStruct* m_structs = nullptr;  ///< Structures constructed in the slab
+        size_t m_num_structs = 0;               ///< Number of constructed structures
     };
 
     std::vector<std::shared_ptr<ThreadSafeStruct>> m_inference_queue;  ///< Pool of thread-safe
                                                                        ///< structures for
                                                                        ///< concurrent processing
+    bool m_use_arena = false;  ///< Whether prepare() places all buffers in one slab
+    std::shared_ptr<SessionArena> m_arena;  ///< Slab of the buffers in arena mode, nullptr
+                                            ///< otherwise
+    size_t m_memoization_cache_size = 0;  ///< Number of inputs prepare() allocates the cache
+                                          ///< for, 0 disables memoization
+    InferenceCache m_inference_cache;  ///< Outputs of recently seen inputs, only accessed by the
+                                       ///< thread processing the session
+
+    /**
+     * @brief Transposes the input tensors of a structure into the layout of a backend
+     *
+     * Does nothing unless the tensor shape of the backend declares CHANNELS_LAST. Every block of
+     * the last two dimensions of a channels-last input tensor is transposed from the planar
+     * layout written by the pre-processing, using the scratch tensors of the structure. Called by
+     * the inference thread right before the inference.
+     *
+     * @param thread_safe_struct Structure whose input tensors are passed to the backend
+     * @param backend Backend the inference runs on
+     */
+    void transform_input_layout(ThreadSafeStruct& thread_safe_struct, InferenceBackend backend);
 
-    std::atomic<InferenceBackend> m_current_backend{CUSTOM};  ///< Currently active inference
-                                                              ///< backend for this session
-    unsigned long m_current_queue = 0;         ///< Current position in the inference queue
+    /**
+     * @brief Transposes the output tensors of a structure back into the planar layout
+     *
+     * Counterpart of transform_input_layout(), called by the inference thread right after the
+     * inference, so the post-processing always reads planar tensors.
+     *
+     * @param thread_safe_struct Structure whose output tensors were written by the backend
+     * @param backend Backend the inference ran on
+     */
+    void transform_output_layout(ThreadSafeStruct& thread_safe_struct, InferenceBackend backend);
+
+    /**
+     * @brief Computes the features of the spectral input tensors of a structure
+     *
+     * The pre-processing writes the samples of a spectral tensor. Called by the inference thread
+     * before transform_input_layout(), this method analyzes them into the features and exchanges
+     * the tensors of all spectral inputs and outputs with the ones shaped like the model tensors.
+     *
+     * @param thread_safe_struct Structure whose input tensors are passed to the backend
+     */
+    void analyze_input_spectra(ThreadSafeStruct& thread_safe_struct);
+
+    /**
+     * @brief Synthesizes the samples of the spectral output tensors of a structure
+     *
+     * Counterpart of analyze_input_spectra(), called by the inference thread after
+     * transform_output_layout(). Restores the sample tensors of all spectral inputs and outputs.
+     *
+     * @param thread_safe_struct Structure whose output tensors were written by the backend
+     */
+    void synthesize_output_spectra(ThreadSafeStruct& thread_safe_struct);
+
+    /**
+     * @brief Overlap-adds the synthesized output tensors with the tails of the previous inference
+     *
+     * Called by the thread that post-processes the session, in the order of the inferences, right
+     * before the post-processing.
+     *
+     * @param thread_safe_struct Structure whose output tensors are post-processed next
+     */
+    void overlap_add_output_spectra(ThreadSafeStruct& thread_safe_struct);
+
+    /**
+     * @brief Gets the latency of an output tensor caused by the model and its spectral stage
+     *
+     * @param tensor_index Index of the output tensor
+     * @return The internal model latency plus the overlap of the spectral stage in samples
+     */
+    size_t get_internal_latency(size_t tensor_index) const;
+
+    // The atomics below are read or written on every inference by different threads, so each
+    // group sits on its own cache line
+    alignas(k_cache_line_size) std::atomic<InferenceBackend> m_current_backend{
+        CUSTOM};  ///< Currently active inference backend for this session
+    alignas(k_cache_line_size) unsigned long m_current_queue = 0;  ///< Current position in the
+                                                                   ///< inference queue
     std::vector<unsigned long> m_time_stamps;  ///< Vector of timestamps for performance monitoring
 
     const int m_session_id;  ///< Unique identifier for this session (immutable)
 
-    std::atomic<bool> m_initialized{false};   ///< Atomic flag indicating if the session is fully
-                                              ///< initialized
-    std::atomic<int> m_active_inferences{0};  ///< Atomic counter of currently active inference
-                                              ///< operations
+    alignas(k_cache_line_size) std::atomic<bool> m_initialized{false};  ///< Atomic flag
+                                                                        ///< indicating if the
+                                                                        ///< session is fully
+                                                                        ///< initialized
+    alignas(k_cache_line_size) std::atomic<int> m_active_inferences{0};  ///< Atomic counter of
+                                                                         ///< currently active
+                                                                         ///< inference operations
 
     // --- Stateful in-order dispatch ---
     // For stateful models, only ONE of this session's tasks may be in the global
@@ -222,8 +432,8 @@ public:
     // in submission order and are released one at a time as each completes, which
     // guarantees in-order, mutually-exclusive execution without spinning. Other
     // sessions are unaffected and keep using the shared thread pool in parallel.
-    std::atomic<bool> m_stateful_dispatch_busy{false};  ///< True while a stateful task of this
-                                                        ///< session is queued or running
+    alignas(k_cache_line_size) std::atomic<bool> m_stateful_dispatch_busy{
+        false};  ///< True while a stateful task of this session is queued or running
     moodycamel::ConcurrentQueue<std::shared_ptr<ThreadSafeStruct>>
         m_dispatch_pending;  ///< Prepared-but-not-yet-dispatched
                              ///< stateful
@@ -249,11 +459,27 @@ public:
     bool m_is_non_real_time = false;  ///< Flag indicating non-real-time processing mode
 
     std::vector<unsigned int> m_latency;  ///< Calculated latency values for each tensor in samples
+                                          ///< at the model sample rate
+    std::vector<unsigned int> m_host_latency;  ///< Latency of each tensor in samples at the host
+                                               ///< sample rate, including the resampling
     size_t m_num_structs = 0;  ///< Number of allocated thread-safe structures (for testing access)
     std::vector<size_t> m_send_buffer_size;  ///< Calculated send buffer sizes (for testing access)
     std::vector<size_t> m_receive_buffer_size;  ///< Calculated receive buffer sizes (for testing
                                                 ///< access)
 
+    alignas(k_cache_line_size) SessionStatistics m_statistics;  ///< Lock-free timing histograms
+                                                                ///< of this session
+    alignas(k_cache_line_size) std::atomic<uint64_t> m_deadline_ns{0};  ///< Time in ns an
+                                                                        ///< inference may take
+                                                                        ///< before its output is
+                                                                        ///< missing in the
+                                                                        ///< receive buffer
+    MemoryLockStatus m_memory_lock_status;  ///< Result of the last lock_memory() call
+    std::vector<std::pair<const void*, size_t>> m_locked_memory;  ///< Ranges locked by
+                                                                  ///< lock_memory()
+    float m_calibrated_max_inference_time = 0.f;  ///< Measured max inference time in ms replacing
+                                                  ///< the configured one, 0 if not calibrated
+
 #ifdef USE_LIBTORCH
     std::shared_ptr<LibtorchProcessor> m_libtorch_processor = nullptr;  ///< Shared pointer to
                                                                         ///< LibTorch backend
@@ -299,6 +525,82 @@ private:
      */
     float max_num_inferences(const HostConfig& host_config) const;
 
+    /**
+     * @brief Calculates the audio deadline of a single inference
+     *
+     * The deadline is the duration covered by the latency padding of the tightest streamable
+     * output tensor. An inference that takes longer than this leaves the receive buffer empty.
+     *
+     * @param host_config Host configuration to calculate for
+     * @return Deadline in nanoseconds, or 0 if the session has no latency
+     */
+    uint64_t calculate_deadline_ns(const HostConfig& host_config) const;
+
+    /**
+     * @brief Calculates the size of the slab holding all buffers in arena mode
+     *
+     * Uses the send and receive buffer sizes and the number of structures, so it must be called
+     * after they are calculated.
+     *
+     * @param tensor_input_size Vector of input tensor sizes
+     * @param tensor_output_size Vector of output tensor sizes
+     * @return Size of the slab in bytes
+     */
+    size_t calculate_arena_size(const std::vector<size_t>& tensor_input_size,
+                                const std::vector<size_t>& tensor_output_size) const;
+
+    /**
+     * @brief Calculates the sizes of the scratch tensors used to transpose channels-last tensors
+     *
+     * @param input Whether to calculate the sizes for the input or the output tensors
+     * @return Size of the scratch tensor of every tensor, 0 if no backend transposes the tensor
+     */
+    std::vector<size_t> calculate_layout_scratch_size(bool input) const;
+
+    /**
+     * @brief Calculates the sizes of the tensors the pre- and post-processing exchange
+     *
+     * @param input Whether to calculate the sizes for the input or the output tensors
+     * @return Size of the samples of every spectral tensor, the model tensor size otherwise
+     */
+    std::vector<size_t> calculate_signal_size(bool input) const;
+
+    /**
+     * @brief Calculates the sizes of the features of the spectral tensors
+     *
+     * @param input Whether to calculate the sizes for the input or the output tensors
+     * @return Size of the model tensor of every spectral tensor, 0 otherwise
+     */
+    std::vector<size_t> calculate_spectral_size(bool input) const;
+
+    /**
+     * @brief Prepares the spectral transforms and the overlap tails of all tensors
+     *
+     * @param host_config Configuration the ring buffers run at
+     */
+    void prepare_spectral_transforms(const HostConfig& host_config);
+
+    /**
+     * @brief Gets the configuration the ring buffers run at when the session resamples
+     *
+     * @param host_config Host configuration of the session
+     * @return Configuration at the model sample rate, the number of samples per block varies by
+     * one, so smaller buffers are allowed
+     */
+    HostConfig calculate_model_config(const HostConfig& host_config) const;
+
+    /**
+     * @brief Prepares the resamplers and folds their delay into the latency
+     *
+     * Pads the latency at the model sample rate so that the resampling never runs dry and the
+     * latency at the host sample rate is a whole number of samples, which the phase offset of the
+     * receive resamplers makes exact. Custom latencies are taken as host samples.
+     *
+     * @param host_config Host configuration of the session
+     * @param custom_latency Custom latency of each tensor in host samples, -1 to calculate it
+     */
+    void prepare_resampling(const HostConfig& host_config, const std::vector<long>& custom_latency);
+
     /**
      * @brief Calculates buffer size adaptation factor
      *
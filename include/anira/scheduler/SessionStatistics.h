@@ -0,0 +1,132 @@
+#ifndef ANIRA_SESSIONSTATISTICS_H
+#define ANIRA_SESSIONSTATISTICS_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../system/AniraWinExports.h"
+#include "../utils/Histogram.h"
+#include "../utils/InferenceBackend.h"
+
+namespace anira {
+
+/**
+ * @brief Timing snapshot of a single inference backend within a session
+ */
+struct ANIRA_API BackendStatisticsSnapshot {
+    InferenceBackend m_backend;        ///< Backend the timings were recorded for
+    HistogramSnapshot m_queue_wait;    ///< Time between submission and start of inference in ns
+    HistogramSnapshot m_inference;     ///< Time spent in the backend's process call in ns
+};
+
+/**
+ * @brief Snapshot of all statistics recorded for one session
+ *
+ * Returned by InferenceHandler::get_statistics(). All durations are given in nanoseconds.
+ * Backends that have not processed any data are omitted from m_backends.
+ */
+struct ANIRA_API InferenceStatistics {
+    int m_session_id = -1;                            ///< Session the statistics belong to
+    std::vector<BackendStatisticsSnapshot> m_backends;  ///< Per-backend queue wait and inference
+                                                        ///< time
+    HistogramSnapshot m_pre_process;   ///< Time spent in the pre-processor in ns
+    HistogramSnapshot m_post_process;  ///< Time spent in the post-processor in ns
+    HistogramSnapshot m_completion;    ///< Time from submission until the result was ready, in
+                                       ///< percent of the audio deadline
+    HistogramSnapshot m_missing_samples;  ///< Samples per process call and output tensor that had
+                                          ///< to be zero-filled because no result was available
+    uint64_t m_deadline_misses = 0;  ///< Number of inferences that completed after the deadline
+    uint64_t m_memoized_inferences = 0;  ///< Number of inferences skipped because the inference
+                                         ///< cache held their outputs
+    uint64_t m_deadline_ns = 0;      ///< Audio deadline used for m_completion in ns (0 if the
+                                     ///< session has no latency)
+};
+
+/**
+ * @brief Lock-free collection of timing histograms for one session
+ *
+ * SessionStatistics is owned by a SessionElement and written by the audio thread (pre/post
+ * processing and missing samples) and the inference threads (queue wait, inference time and
+ * completion). All recording methods are real-time safe.
+ *
+ * @see Histogram, InferenceStatistics
+ */
+class ANIRA_API SessionStatistics {
+public:
+    /** @brief Number of backend slots, one for each value of InferenceBackend */
+    static constexpr size_t k_num_backends = static_cast<size_t>(InferenceBackend::CUSTOM) + 1;
+
+    /**
+     * @brief Records the timings of one finished inference
+     *
+     * @param backend Backend that processed the inference
+     * @param queue_wait_ns Time between submission and start of the inference
+     * @param inference_ns Time spent in the backend
+     * @param deadline_ns Audio deadline of the session, completion is not recorded if 0
+     */
+    void record_inference(InferenceBackend backend,
+                          uint64_t queue_wait_ns,
+                          uint64_t inference_ns,
+                          uint64_t deadline_ns) ANIRA_REALTIME;
+
+    /**
+     * @brief Records the time spent in the pre-processor
+     *
+     * @param duration_ns Duration in nanoseconds
+     */
+    void record_pre_process(uint64_t duration_ns) ANIRA_REALTIME;
+
+    /**
+     * @brief Records the time spent in the post-processor
+     *
+     * @param duration_ns Duration in nanoseconds
+     */
+    void record_post_process(uint64_t duration_ns) ANIRA_REALTIME;
+
+    /**
+     * @brief Records a process call that could not be served completely from the receive buffer
+     *
+     * @param num_samples Number of samples that were zero-filled
+     */
+    void record_missing_samples(uint64_t num_samples) ANIRA_REALTIME;
+
+    /**
+     * @brief Records an inference whose outputs were taken from the inference cache
+     */
+    void record_memoized_inference() ANIRA_REALTIME;
+
+    /**
+     * @brief Copies all histograms into a snapshot
+     *
+     * @param session_id Session id stored in the snapshot
+     * @param deadline_ns Audio deadline stored in the snapshot
+     * @return Snapshot of the current statistics
+     */
+    InferenceStatistics snapshot(int session_id, uint64_t deadline_ns) const;
+
+    /**
+     * @brief Resets all histograms and counters
+     */
+    void reset();
+
+private:
+    struct BackendStatistics {
+        Histogram m_queue_wait;
+        Histogram m_inference;
+    };
+
+    std::array<BackendStatistics, k_num_backends> m_backends;  ///< Timings per backend
+    Histogram m_pre_process;         ///< Pre-processing durations
+    Histogram m_post_process;        ///< Post-processing durations
+    Histogram m_completion;          ///< Completion time in percent of the deadline
+    Histogram m_missing_samples;     ///< Zero-filled samples per affected process call
+    std::atomic<uint64_t> m_deadline_misses{0};  ///< Completions beyond the deadline
+    std::atomic<uint64_t> m_memoized_inferences{0};  ///< Inferences served by the cache
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_SESSIONSTATISTICS_H
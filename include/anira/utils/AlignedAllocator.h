@@ -0,0 +1,75 @@
+#ifndef ANIRA_ALIGNEDALLOCATOR_H
+#define ANIRA_ALIGNEDALLOCATOR_H
+
+#include <cstddef>
+
+#include "../system/AniraWinExports.h"
+
+namespace anira {
+
+/**
+ * @brief Size of a cache line in bytes
+ *
+ * Used as default alignment of MemoryBlock and to keep atomics written by different threads on
+ * separate cache lines. Apple silicon uses 128 byte cache lines, other targets 64 bytes.
+ */
+#if defined(__APPLE__) && defined(__aarch64__)
+inline constexpr std::size_t k_cache_line_size = 128;
+#else
+inline constexpr std::size_t k_cache_line_size = 64;
+#endif
+
+/**
+ * @brief Aligned allocation of the memory behind MemoryBlock
+ *
+ * Aligned memory lets the backends and vectorized code (e.g. AVX-512) load whole cache lines
+ * and hand the tensors to zero-copy paths. Optionally, large allocations are aligned to huge
+ * pages and marked for transparent huge pages on Linux, which reduces TLB misses when the
+ * tensors of large models are streamed through.
+ *
+ * Memory returned by allocate() must be released with deallocate(), not with free(), since
+ * Windows uses a separate aligned heap.
+ */
+class ANIRA_API AlignedAllocator {
+public:
+    static constexpr std::size_t k_huge_page_size = 2 * 1024 * 1024;  ///< Size of a huge page and
+                                                                     ///< smallest allocation that
+                                                                     ///< uses them
+
+    /**
+     * @brief Allocates aligned memory
+     *
+     * @param bytes Number of bytes, 0 returns nullptr
+     * @param alignment Alignment in bytes, a power of two, raised to at least the alignment of
+     *                  std::max_align_t
+     * @return Pointer to the uninitialized memory, nullptr if the allocation failed
+     */
+    static void* allocate(std::size_t bytes, std::size_t alignment);
+
+    /**
+     * @brief Releases memory returned by allocate()
+     *
+     * @param data Pointer returned by allocate() or nullptr
+     */
+    static void deallocate(void* data) noexcept;
+
+    /**
+     * @brief Enables transparent huge pages for allocations of at least k_huge_page_size
+     *
+     * Only effective on Linux with transparent huge pages set to "madvise" or "always". Applies
+     * to allocations made after the call, i.e. to sessions prepared afterwards. Disabled by
+     * default, since memory is then handed out in steps of huge pages.
+     *
+     * @param enabled Whether large allocations use huge pages
+     */
+    static void set_huge_pages_enabled(bool enabled);
+
+    /**
+     * @brief Checks whether large allocations use transparent huge pages
+     */
+    static bool is_huge_pages_enabled();
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_ALIGNEDALLOCATOR_H
@@ -0,0 +1,110 @@
+#ifndef ANIRA_ARENA_H
+#define ANIRA_ARENA_H
+
+#include <cstddef>
+
+#include "../system/AniraWinExports.h"
+#include "AlignedAllocator.h"
+#include "MemoryBlock.h"
+
+namespace anira {
+
+/**
+ * @brief Bump allocator handing out cache-line aligned parts of one contiguous slab
+ *
+ * The slab is allocated once with the capacity calculated up front, e.g. from the sizes of all
+ * buffers of a session, so that preparing them is a single allocation and their data sits
+ * together in memory. Parts are never freed individually, the whole slab is released with the
+ * Arena. Objects constructed in the slab must be destroyed by their owner before.
+ *
+ * @code
+ * size_t const capacity = anira::Arena::get_aligned_size(512 * sizeof(float)) * 2;
+ * anira::Arena arena(capacity);
+ * anira::BufferF input(1, 512, arena.allocate<float>(512));
+ * anira::BufferF output(1, 512, arena.allocate<float>(512));
+ * @endcode
+ *
+ * @see MemoryBlock, SessionElement
+ */
+class ANIRA_API Arena {
+public:
+    /**
+     * @brief Constructor that allocates the slab
+     *
+     * @param capacity Size of the slab in bytes, the sum of get_aligned_size() of all parts
+     */
+    Arena(size_t capacity = 0);
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * @brief Gets the number of bytes a part of the given size takes up in the slab
+     *
+     * @param bytes Size of the part in bytes
+     * @return Size rounded up to a multiple of the cache line size
+     */
+    static constexpr size_t get_aligned_size(size_t bytes) {
+        return (bytes + k_cache_line_size - 1) / k_cache_line_size * k_cache_line_size;
+    }
+
+    /**
+     * @brief Hands out the next part of the slab
+     *
+     * The memory is uninitialized, objects have to be constructed with placement new.
+     *
+     * @tparam T Type of the elements, aligned to at most a cache line
+     * @param count Number of elements
+     * @return Pointer to the cache-line aligned memory, nullptr if count is 0 or the slab is
+     *         exhausted
+     */
+    template <typename T>
+    T* allocate(size_t count) {
+        static_assert(alignof(T) <= k_cache_line_size, "T must fit the alignment of the arena.");
+        return static_cast<T*>(allocate_bytes(count * sizeof(T)));
+    }
+
+    /**
+     * @brief Makes the whole slab available again, invalidating all parts handed out
+     */
+    void reset();
+
+    /**
+     * @brief Gets a pointer to the start of the slab
+     */
+    const std::byte* data() const;
+    std::byte* data();
+
+    /**
+     * @brief Gets the size of the slab in bytes
+     */
+    size_t get_capacity() const;
+
+    /**
+     * @brief Gets the number of bytes handed out, including the alignment padding
+     */
+    size_t get_used() const;
+
+    /**
+     * @brief Checks whether memory lies within the slab
+     *
+     * @param data Pointer to check
+     */
+    bool contains(const void* data) const;
+
+private:
+    /**
+     * @brief Hands out the next cache-line aligned part of the slab
+     *
+     * @param bytes Size of the part in bytes
+     * @return Pointer to the part, nullptr if bytes is 0 or the slab is exhausted
+     */
+    void* allocate_bytes(size_t bytes);
+
+    MemoryBlock<std::byte> m_memory;  ///< The slab all parts are handed out from
+    size_t m_used = 0;                ///< Bytes handed out so far
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_ARENA_H
@@ -61,6 +61,24 @@ public:
         clear();
     }
 
+    /**
+     * @brief Constructor that creates a buffer in memory owned elsewhere
+     *
+     * The buffer uses the given memory instead of allocating its own, e.g. a part of an Arena,
+     * and clears it. The owner must keep the memory alive as long as the buffer uses it.
+     *
+     * @param num_channels Number of audio channels
+     * @param size Number of samples per channel
+     * @param memory Memory of num_channels * size elements, aligned to a cache line
+     *
+     * @see MemoryBlock::MemoryBlock(T*, std::size_t)
+     */
+    Buffer(size_t num_channels, size_t size, T* memory)
+        : m_num_channels(num_channels), m_size(size), m_data(memory, num_channels * size) {
+        malloc_channels();
+        clear();
+    }
+
     /**
      * @brief Copy constructor that creates a deep copy of another buffer
      *
@@ -175,6 +193,24 @@ public:
         malloc_channels();
     }
 
+    /**
+     * @brief Resizes the buffer to new dimensions in memory owned elsewhere
+     *
+     * Like resize(size_t, size_t), but the buffer uses the given memory instead of allocating
+     * its own. The owner must keep the memory alive as long as the buffer uses it.
+     *
+     * @param num_channels New number of audio channels
+     * @param size New number of samples per channel
+     * @param memory Memory of num_channels * size elements, aligned to a cache line
+     */
+    void resize(size_t num_channels, size_t size, T* memory) {
+        m_num_channels = num_channels;
+        m_size = size;
+        m_data = MemoryBlock<T>(memory, num_channels * size);
+        free(static_cast<void*>(m_channels));
+        malloc_channels();
+    }
+
     /**
      * @brief Gets the number of channels in the buffer
      *
@@ -271,6 +307,13 @@ public:
      */
     T* data() { return m_data.data(); }
 
+    /**
+     * @brief Gets a read-only pointer to the raw contiguous data block
+     *
+     * @return Pointer to the raw data block
+     */
+    const T* data() const { return m_data.data(); }
+
     /**
      * @brief Gets a reference to the underlying memory block
      *
@@ -295,10 +338,11 @@ public:
     void swap_data(Buffer& other) {
         if (this != &other) {
             if (m_num_channels == other.m_num_channels && m_size == other.m_size) {
+                // Buffers in memory owned elsewhere exchange their elements instead of the memory,
+                // so the channel pointers are recalculated rather than swapped
                 m_data.swap_data(other.m_data);
-                T** temp_channels = m_channels;
-                m_channels = other.m_channels;
-                other.m_channels = temp_channels;
+                reset_channel_ptr();
+                other.reset_channel_ptr();
             } else {
                 LOG_ERROR << "Cannot swap data, buffers have different number of channels or sizes!"
                           << '\n';
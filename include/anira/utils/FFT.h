@@ -0,0 +1,86 @@
+#ifndef ANIRA_FFT_H
+#define ANIRA_FFT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../system/AniraWinExports.h"
+
+namespace anira {
+
+/**
+ * @brief Fast Fourier transform of real signals with a power-of-two length
+ *
+ * A real signal of N samples is packed into a complex signal of N / 2 samples, transformed by an
+ * iterative radix-2 FFT on split real and imaginary arrays and unpacked into the N / 2 + 1 bins of
+ * the real spectrum. The butterflies of all stages with at least four butterflies per group are
+ * computed four at a time with SSE on x86-64 and NEON on ARM, the twiddle factors of every stage
+ * are stored contiguously for that.
+ *
+ * The transforms are const and work in the arrays passed to them, so one prepared FFT can be used
+ * by several threads at once.
+ *
+ * @note prepare() allocates, the transforms are real-time safe.
+ * @see SpectralTransform
+ */
+class ANIRA_API FFT {
+public:
+    /**
+     * @brief Default constructor that creates an unprepared FFT
+     */
+    FFT() = default;
+
+    /**
+     * @brief Calculates the tables of a transform length
+     *
+     * @param size Number of samples, a power of two of at least 4
+     */
+    void prepare(size_t size);
+
+    /**
+     * @brief Gets the number of samples of the transform
+     */
+    size_t get_size() const;
+
+    /**
+     * @brief Transforms a real signal into its spectrum
+     *
+     * @param input The get_size() samples of the signal
+     * @param real Receives the real parts of the get_size() / 2 + 1 bins
+     * @param imag Receives the imaginary parts of the get_size() / 2 + 1 bins
+     */
+    void forward(const float* input, float* real, float* imag) const;
+
+    /**
+     * @brief Transforms a spectrum back into the real signal, scaled by 1 / get_size()
+     *
+     * @param real Real parts of the get_size() / 2 + 1 bins, overwritten
+     * @param imag Imaginary parts of the get_size() / 2 + 1 bins, overwritten
+     * @param output Receives the get_size() samples of the signal
+     */
+    void inverse(float* real, float* imag, float* output) const;
+
+    /**
+     * @brief Gets the bytes held by the tables
+     */
+    size_t get_memory_size() const;
+
+private:
+    /**
+     * @brief Transforms the complex signal of get_size() / 2 samples in bit-reversed order in place
+     */
+    void transform(float* real, float* imag) const;
+
+    size_t m_size = 0;                   ///< Number of real samples N
+    std::vector<uint32_t> m_bit_reverse;  ///< Bit-reversed index of each of the N / 2 samples
+    std::vector<float> m_twiddle_real;   ///< Cosines of the twiddle factors of every stage
+    std::vector<float> m_twiddle_imag;   ///< Negative sines of the twiddle factors of every stage
+    std::vector<float> m_pack_real;      ///< Cosines of the twiddle factors packing the real signal
+    std::vector<float> m_pack_imag;      ///< Negative sines of the twiddle factors packing the real
+                                         ///< signal
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_FFT_H
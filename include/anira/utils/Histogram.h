@@ -0,0 +1,119 @@
+#ifndef ANIRA_HISTOGRAM_H
+#define ANIRA_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "../system/AniraWinExports.h"
+#include "RealtimeSanitizer.h"
+
+namespace anira {
+
+struct HistogramSnapshot;
+
+/**
+ * @brief Lock-free histogram with fixed logarithmic buckets
+ *
+ * The Histogram class records unsigned integer values (e.g. durations in nanoseconds or sample
+ * counts) into a fixed set of buckets without locks or allocations, so it can be written from the
+ * audio thread and the inference threads concurrently. Each power of two is split into four
+ * linear sub-buckets, which bounds the relative quantization error to 25% over the whole range.
+ *
+ * Reading is done through snapshot(), which copies the bucket counts into a plain
+ * HistogramSnapshot. The snapshot is not atomic with respect to concurrent writers, but every
+ * recorded value is eventually visible and the counters never go backwards.
+ *
+ * @see HistogramSnapshot, SessionStatistics
+ */
+class ANIRA_API Histogram {
+public:
+    static constexpr size_t k_num_sub_buckets = 4;  ///< Linear sub-buckets per power of two
+    static constexpr size_t k_num_buckets = 128;    ///< Total number of buckets, values beyond the
+                                                    ///< last bucket are clamped into it
+
+    /**
+     * @brief Records a single value
+     *
+     * @param value Value to record, in the unit chosen by the owner of the histogram
+     *
+     * @note This method is real-time safe, lock-free and does not allocate memory.
+     */
+    void record(uint64_t value) ANIRA_REALTIME;
+
+    /**
+     * @brief Resets all buckets and summary values
+     *
+     * @note Values recorded concurrently with a reset may be partially lost.
+     */
+    void reset();
+
+    /**
+     * @brief Copies the current state of the histogram
+     *
+     * @return Snapshot containing bucket counts and summary values
+     */
+    HistogramSnapshot snapshot() const;
+
+    /**
+     * @brief Maps a value to its bucket index
+     *
+     * @param value Value to map
+     * @return Index of the bucket the value is recorded in
+     */
+    static size_t bucket_index(uint64_t value);
+
+    /**
+     * @brief Gets the largest value that is recorded in a bucket
+     *
+     * @param index Bucket index
+     * @return Inclusive upper bound of the bucket
+     */
+    static uint64_t bucket_upper_bound(size_t index);
+
+private:
+    std::array<std::atomic<uint64_t>, k_num_buckets> m_buckets{};  ///< Number of recorded values
+                                                                   ///< per bucket
+    std::atomic<uint64_t> m_sum{0};             ///< Sum of all recorded values
+    std::atomic<uint64_t> m_min{UINT64_MAX};    ///< Smallest recorded value
+    std::atomic<uint64_t> m_max{0};             ///< Largest recorded value
+};
+
+/**
+ * @brief Plain copy of a Histogram for evaluation outside of the real-time context
+ */
+struct ANIRA_API HistogramSnapshot {
+    std::array<uint64_t, Histogram::k_num_buckets> m_buckets{};  ///< Recorded values per bucket
+    uint64_t m_count = 0;  ///< Total number of recorded values
+    uint64_t m_sum = 0;    ///< Sum of all recorded values
+    uint64_t m_min = 0;    ///< Smallest recorded value (0 if empty)
+    uint64_t m_max = 0;    ///< Largest recorded value (0 if empty)
+
+    /**
+     * @brief Gets the mean of all recorded values
+     *
+     * @return Mean value, or 0 if the histogram is empty
+     */
+    double get_mean() const;
+
+    /**
+     * @brief Gets an upper bound for the given percentile
+     *
+     * @param percentile Percentile in the range [0, 100]
+     * @return Upper bound of the bucket containing the percentile, clamped to the maximum
+     */
+    uint64_t get_percentile(double percentile) const;
+
+    /**
+     * @brief Adds the values of another snapshot, e.g. to combine the statistics of several
+     * sessions
+     *
+     * @param other Snapshot whose values are added to this one
+     */
+    void merge(const HistogramSnapshot& other);
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_HISTOGRAM_H
@@ -0,0 +1,147 @@
+#ifndef ANIRA_INFERENCETIMECALIBRATION_H
+#define ANIRA_INFERENCETIMECALIBRATION_H
+
+#include <string>
+#include <vector>
+
+#include "../system/AniraWinExports.h"
+#include "InferenceBackend.h"
+
+namespace anira {
+
+class BackendBase;  // Forward declaration, the calibration only needs the process interface
+
+/**
+ * @brief Options for measuring the max inference time instead of using the configured one
+ *
+ * The m_max_inference_time of the InferenceConfig determines the latency and the number of
+ * inference structs of a session. A hand-entered value is either too pessimistic, which adds
+ * latency, or too optimistic on slower machines, which causes dropouts. When enabled, prepare()
+ * runs m_num_inferences inferences on the backend selected at that time and replaces the
+ * configured max inference time with the given percentile of the measured times plus a margin.
+ *
+ * The measured times are stored per machine and model in a JSON file, so later prepare() calls,
+ * also in other processes, reuse them instead of measuring again.
+ *
+ * @code
+ * inference_handler.set_inference_backend(anira::InferenceBackend::ONNX);
+ * inference_handler.set_inference_time_calibration({.m_enabled = true, .m_percentile = 99.9});
+ * inference_handler.prepare(anira::HostConfig(512, 48000));
+ * @endcode
+ */
+struct ANIRA_API InferenceTimeCalibration {
+    bool m_enabled = false;  ///< Whether prepare() calibrates the max inference time
+    double m_percentile = 99.;  ///< Percentile of the measured times in percent
+    float m_margin = 0.25f;  ///< Margin added to the percentile, relative to it
+    unsigned int m_num_inferences = 64;  ///< Number of measured inferences
+    std::string m_cache_path = get_default_cache_path();  ///< File the measured times are stored
+                                                          ///< in, empty to always measure
+    bool m_recalibrate = false;  ///< Measures again and replaces the stored times
+
+    /**
+     * @brief Gets the per-user cache file the measured times are stored in by default
+     *
+     * This is anira/inference_times.json in %LOCALAPPDATA% on Windows, ~/Library/Caches on macOS
+     * and $XDG_CACHE_HOME or ~/.cache elsewhere, falling back to the temporary directory.
+     */
+    static std::string get_default_cache_path();
+};
+
+/**
+ * @brief Measures inference times and stores them per machine and model
+ */
+class ANIRA_API InferenceTimeCalibrator {
+public:
+    static constexpr unsigned int k_version = 1;  ///< Version of the cache file format
+
+    /**
+     * @brief Calibrates the max inference time of a backend processor
+     *
+     * Uses the times stored for the machine and model in the cache file if there are any,
+     * otherwise measures them and stores them.
+     *
+     * @param calibration Options of the calibration
+     * @param processor Prepared processor of the model
+     * @param backend Backend of the processor, part of the cache key
+     * @return Percentile plus margin in ms, 0 if no time could be measured
+     *
+     * @note The processors shipped with anira may be shared with other sessions, so the
+     *       inferences run on a private instance of the same type. Custom processors cannot be
+     *       copied and are measured directly, they must allow process() calls without a session.
+     */
+    static float calibrate(const InferenceTimeCalibration& calibration,
+                           BackendBase& processor,
+                           InferenceBackend backend);
+
+    /**
+     * @brief Runs inferences with random inputs and measures their duration
+     *
+     * One additional inference is run before the measurement and discarded.
+     *
+     * @param processor Prepared processor the inferences are run on
+     * @param num_inferences Number of measured inferences
+     * @return Duration of every measured inference in ms
+     */
+    static std::vector<double> measure(BackendBase& processor, unsigned int num_inferences);
+
+    /**
+     * @brief Gets a percentile of measured times
+     *
+     * @param samples_ms Measured times in ms
+     * @param percentile Percentile in percent
+     * @return Smallest sample that at least the given percentage of samples does not exceed,
+     *         0 if there are no samples
+     */
+    static double get_percentile(std::vector<double> samples_ms, double percentile);
+
+    /**
+     * @brief Gets an identifier of the machine, made of the CPU model and the number of threads
+     */
+    static std::string get_machine_id();
+
+    /**
+     * @brief Gets an identifier of the model a processor runs
+     *
+     * Made of the backend, the model path with the size and modification time of the file or a
+     * hash of the binary model data, the input tensor shapes and the type of the processor, which
+     * tells custom processors apart.
+     *
+     * @param processor Processor running the model
+     * @param backend Backend of the processor
+     */
+    static std::string get_model_id(const BackendBase& processor, InferenceBackend backend);
+
+    /**
+     * @brief Reads the times stored for a machine and model
+     *
+     * @param path Cache file
+     * @param machine_id Identifier returned by get_machine_id()
+     * @param model_id Identifier returned by get_model_id()
+     * @param samples_ms Receives the stored times in ms
+     * @return Whether times were found
+     */
+    static bool load(const std::string& path,
+                     const std::string& machine_id,
+                     const std::string& model_id,
+                     std::vector<double>& samples_ms);
+
+    /**
+     * @brief Stores the times of a machine and model, keeping all other entries of the file
+     *
+     * The file is replaced atomically, so concurrent readers see either the old or the new one.
+     *
+     * @param path Cache file, missing directories are created
+     * @param machine_id Identifier returned by get_machine_id()
+     * @param model_id Identifier returned by get_model_id()
+     * @param samples_ms Times in ms
+     * @return Whether the file could be written
+     */
+    static bool store(const std::string& path,
+                      const std::string& machine_id,
+                      const std::string& model_id,
+                      const std::vector<double>& samples_ms);
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_INFERENCETIMECALIBRATION_H
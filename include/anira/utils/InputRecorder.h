@@ -0,0 +1,157 @@
+#ifndef ANIRA_INPUTRECORDER_H
+#define ANIRA_INPUTRECORDER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../system/AniraWinExports.h"
+#include "Buffer.h"
+#include "InferenceBackend.h"
+#include "RealtimeSanitizer.h"
+
+namespace anira {
+
+class BackendBase;  // Forward declaration, the replay only needs the process interface
+
+/**
+ * @brief Input tensors of one inference together with the backend and timing it ran with
+ *
+ * Used as preallocated slot while recording and as the result of reading a recording.
+ */
+struct ANIRA_API RecordedInference {
+    int m_session_id = -1;                                  ///< Session of the inference
+    InferenceBackend m_backend = InferenceBackend::CUSTOM;  ///< Backend the inference ran on
+    uint64_t m_sequence = 0;        ///< Sequence number (time stamp) of the ThreadSafeStruct
+    uint64_t m_time_ns = 0;         ///< Time the inference finished, in ns since start()
+    int64_t m_queue_wait_ns = 0;    ///< Time from the submission to the start of the inference
+    int64_t m_inference_ns = 0;     ///< Duration of the backend's process call
+    std::vector<BufferF> m_inputs;  ///< Copy of the input tensors handed to the backend
+};
+
+/**
+ * @brief Optional recorder that captures the tensors handed to the backends for offline replay
+ *
+ * When a model is slow on a user's machine, the exact tensor stream that caused it is usually
+ * not reproducible. Between start() and stop() every inference thread copies the input tensors
+ * of each ThreadSafeStruct into one of k_num_slots preallocated slots before calling the
+ * backend, and fills in the backend, the session, the sequence number, the queue wait and the
+ * inference time afterwards. A background thread writes the finished slots to a compact binary
+ * file. Inferences are dropped when all slots are in use. A slot only allocates when it first
+ * sees a tensor shape, so after the first few inferences recording does not allocate.
+ *
+ * The recording can be read back with read() and fed straight into a BackendBase implementation
+ * with replay(), bypassing the scheduler, to separate the cost of the backend from the overhead
+ * of anira. The anira-replay example does this for a JSON config.
+ *
+ * The file starts with the magic "ANIRAREC" and a uint32 version, followed by the records. Every
+ * record holds the session id (int32), the backend (uint32, see read()), the sequence number,
+ * the finish time (uint64), the queue wait and inference time (int64), the number of tensors
+ * (uint32) and for every tensor its number of channels and samples (uint32) followed by the
+ * float samples. All values are stored in the native byte order. Within one flush the records
+ * are ordered by their finish time.
+ *
+ * @code
+ * anira::InputRecorder::start("anira_inputs.bin");
+ * // ... process audio ...
+ * anira::InputRecorder::stop();
+ * @endcode
+ */
+class ANIRA_API InputRecorder {
+public:
+    static constexpr size_t k_num_slots = 128;  ///< Number of inferences that can be in flight
+    static constexpr uint32_t k_version = 1;    ///< Version of the file format
+    static constexpr std::chrono::milliseconds k_flush_interval{10};  ///< Background flush period
+
+    /**
+     * @brief Starts recording inferences and streaming them to a file
+     *
+     * @param file_path Path of the binary recording to write
+     * @return True if recording was started, false if it is already running or the file could
+     *         not be opened
+     */
+    static bool start(const std::string& file_path);
+
+    /**
+     * @brief Stops recording, writes all finished records and closes the file
+     */
+    static void stop();
+
+    /**
+     * @brief Checks whether inferences are currently recorded
+     *
+     * @return True between start() and stop()
+     */
+    static bool is_running() ANIRA_REALTIME;
+
+    /**
+     * @brief Claims a free slot and copies the input tensors of an inference into it
+     *
+     * Called by the inference threads before the backend is invoked, since backends may modify
+     * their inputs.
+     *
+     * @param inputs Input tensors of the ThreadSafeStruct
+     * @return The claimed slot, or nullptr if recording is not running or all slots are in use
+     */
+    static RecordedInference* capture(const std::vector<BufferF>& inputs) ANIRA_REALTIME;
+
+    /**
+     * @brief Completes a slot claimed with capture() and hands it to the background thread
+     *
+     * @param record Slot returned by capture(), nullptr is ignored
+     * @param session_id Session the inference belongs to
+     * @param backend Backend the inference ran on
+     * @param sequence Sequence number of the ThreadSafeStruct
+     * @param queue_wait_ns Time between the submission and the start of the inference
+     * @param inference_ns Duration of the backend's process call
+     */
+    static void commit(RecordedInference* record,
+                       int session_id,
+                       InferenceBackend backend,
+                       uint64_t sequence,
+                       int64_t queue_wait_ns,
+                       int64_t inference_ns) ANIRA_REALTIME;
+
+    /**
+     * @brief Gets the number of inferences that were dropped since start()
+     *
+     * @return Number of dropped inferences
+     */
+    static uint64_t get_dropped_records();
+
+    /**
+     * @brief Reads a recording written between start() and stop()
+     *
+     * Backends that are not available in this build are read as InferenceBackend::CUSTOM.
+     *
+     * @param file_path Path of the binary recording
+     * @param records Receives the records in file order
+     * @return False if the file could not be opened or is not a valid recording, records then
+     *         holds the records read before the error
+     */
+    static bool read(const std::string& file_path, std::vector<RecordedInference>& records);
+
+    /**
+     * @brief Feeds the recorded inputs straight into a backend and measures every process call
+     *
+     * The output tensors are sized from the backend's InferenceConfig. Records whose inputs do
+     * not match the tensor sizes of the config are skipped and measured as -1. The backend must
+     * have been prepared and is called without a session.
+     *
+     * @param backend Backend to replay the inputs on
+     * @param records Records returned by read()
+     * @return Duration of every process call in ns, in the order of the records
+     */
+    static std::vector<int64_t> replay(BackendBase& backend,
+                                       const std::vector<RecordedInference>& records);
+
+private:
+    static void flush();
+    static void flush_loop();
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_INPUTRECORDER_H
@@ -45,6 +45,9 @@ private:
         bool& config_required);
     static std::vector<size_t> parse_size_t_json_shape(const nlohmann::json& shape_node,
                                                        const std::string& json_key_name);
+    static std::vector<anira::SpectralSpec> parse_spectral_spec(
+        const nlohmann::json& spec_node,
+        const std::string& json_key_name);
     static SingleParameterStruct create_single_parameters_from_config(
         const nlohmann::basic_json<>& config,
         bool& necessary_parameter_set);
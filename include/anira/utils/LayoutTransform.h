@@ -0,0 +1,79 @@
+#ifndef ANIRA_LAYOUTTRANSFORM_H
+#define ANIRA_LAYOUTTRANSFORM_H
+
+#include <cstddef>
+
+#include "../system/AniraWinExports.h"
+
+namespace anira {
+
+/**
+ * @brief Kernels converting between planar and interleaved sample layouts
+ *
+ * Converts audio and tensor data between the planar layout of anira's buffers (one contiguous
+ * block per channel) and interleaved layouts (the channels of one sample next to each other), as
+ * needed for channels-last tensors and interleaved host buffers. The kernels work on 4x4 tiles
+ * transposed in SIMD registers (SSE on x86-64, NEON on ARM) and fall back to scalar code for the
+ * remaining rows and columns and on other platforms.
+ *
+ * All kernels are real-time safe, they neither allocate nor lock. Source and destination must
+ * not overlap.
+ *
+ * @see TensorLayout
+ */
+class ANIRA_API LayoutTransform {
+public:
+    /**
+     * @brief Transposes a row-major matrix
+     *
+     * @param source Matrix of num_rows rows of num_columns values each
+     * @param destination Receives the num_columns x num_rows transposed matrix
+     * @param num_rows Number of rows of the source matrix
+     * @param num_columns Number of columns of the source matrix
+     */
+    static void transpose(const float* source,
+                          float* destination,
+                          size_t num_rows,
+                          size_t num_columns);
+
+    /**
+     * @brief Interleaves planar channels
+     *
+     * @param source Pointers to the num_samples samples of each channel
+     * @param destination Receives num_samples frames of num_channels values each
+     * @param num_channels Number of channels
+     * @param num_samples Number of samples per channel
+     */
+    static void interleave(const float* const* source,
+                           float* destination,
+                           size_t num_channels,
+                           size_t num_samples);
+
+    /**
+     * @brief Deinterleaves frames into planar channels
+     *
+     * @param source num_samples frames of num_channels values each
+     * @param destination Pointers to the channels receiving num_samples samples each
+     * @param num_channels Number of channels
+     * @param num_samples Number of samples per channel
+     */
+    static void deinterleave(const float* source,
+                             float* const* destination,
+                             size_t num_channels,
+                             size_t num_samples);
+
+private:
+    static constexpr size_t k_tile_size = 4;  ///< Rows and columns of a SIMD tile
+
+    /**
+     * @brief Transposes a 4x4 tile given by the pointers to its rows
+     *
+     * @param source Rows of the source tile, four values each
+     * @param destination Rows of the destination tile, receive one column of the source each
+     */
+    static void transpose_tile(const float* const* source, float* const* destination);
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_LAYOUTTRANSFORM_H
@@ -3,6 +3,8 @@
 
 #include <iostream>
 
+#include "RealtimeLogger.h"
+
 inline bool is_logging_enabled() {
 #ifdef ENABLE_LOGGING
     return true;
@@ -16,4 +18,18 @@ inline bool is_logging_enabled() {
 #define LOG_ERROR \
     if (is_logging_enabled()) (std::cerr)
 
+// Real-time safe variants for the audio and inference threads. They take a printf-style format,
+// are formatted into anira::RealtimeLogger's lock-free ring and are printed from its background
+// thread. Every call site is rate limited on its own.
+#define ANIRA_LOG_RT(level, ...)                                                           \
+    do {                                                                                   \
+        if (is_logging_enabled()) {                                                        \
+            static constinit anira::LogRateLimiter anira_log_rate_limiter;                 \
+            anira::RealtimeLogger::log(level, &anira_log_rate_limiter, __VA_ARGS__);       \
+        }                                                                                  \
+    } while (false)
+#define LOG_RT_INFO(...) ANIRA_LOG_RT(anira::LogLevel::Info, __VA_ARGS__)
+#define LOG_RT_WARNING(...) ANIRA_LOG_RT(anira::LogLevel::Warning, __VA_ARGS__)
+#define LOG_RT_ERROR(...) ANIRA_LOG_RT(anira::LogLevel::Error, __VA_ARGS__)
+
 #endif  // ANIRA_LOGGER_H
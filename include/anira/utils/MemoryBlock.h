@@ -1,10 +1,15 @@
 #ifndef ANIRA_MEMORYBLOCK_H
 #define ANIRA_MEMORYBLOCK_H
 
+#include <anira/utils/AlignedAllocator.h>
 #include <anira/utils/Logger.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <cstring>
 #include <iostream>
+#include <memory>
 #include <type_traits>
 
 namespace anira {
@@ -23,19 +28,25 @@ namespace anira {
  * - Direct memory access with array-style indexing
  * - Resize capabilities with memory reallocation
  * - Template-based design supporting any data type
+ * - Cache-line aligned memory by default, optionally on transparent huge pages
+ * - Views of memory owned elsewhere, e.g. by an Arena
  *
  * This class is designed for performance-critical applications where direct memory
  * control is needed while maintaining memory safety.
  *
  * @tparam T The data type to store in the memory block
+ * @tparam Alignment Alignment of the memory in bytes, a power of two (default: one cache line)
  *
- * @note This class uses malloc/free for memory management to allow for efficient
- *       reallocation operations and to avoid constructor/destructor calls for POD types.
+ * @note This class uses AlignedAllocator instead of new/delete to avoid constructor/destructor
+ *       calls for POD types.
  *
- * @see Buffer
+ * @see Buffer, AlignedAllocator
  */
-template <typename T>
+template <typename T, std::size_t Alignment = k_cache_line_size>
 class MemoryBlock {
+    static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two.");
+    static_assert(Alignment >= alignof(T), "Alignment must satisfy the alignment of T.");
+
 public:
     /**
      * @brief Constructor that allocates a memory block of specified size
@@ -48,24 +59,27 @@ public:
      * @note Memory is allocated but not initialized. For non-POD types, consider
      *       using appropriate initialization after construction.
      */
-    MemoryBlock(std::size_t size = 0) : m_size(size) {
-        // A size of 0 is a valid empty block; malloc(0) is intentional here.
-        // NOLINTNEXTLINE(clang-analyzer-optin.portability.UnixAPI)
-        void* data = malloc(sizeof(T) * m_size);
-        if (data != nullptr) {
-            m_data = (T*)data;
-        } else {
-            LOG_ERROR << "Failed to allocate memory!" << '\n';
-        }
-    }
+    MemoryBlock(std::size_t size = 0) : m_size(size) { m_data = allocate(m_size); }
+
+    /**
+     * @brief Constructor that creates a view of memory owned elsewhere
+     *
+     * The block neither allocates nor frees the memory, the owner must keep it alive as long as
+     * the block uses it. Copies of the block own their memory, resizing replaces the view with
+     * owned memory.
+     *
+     * @param data Memory of at least size elements, aligned to at least Alignment
+     * @param size Number of elements
+     */
+    MemoryBlock(T* data, std::size_t size) : m_data(data), m_size(size), m_owned(false) {}
 
     /**
      * @brief Destructor that automatically frees allocated memory
      *
-     * Safely deallocates the memory block using free(). Marked noexcept to
-     * guarantee no exceptions during destruction, which is essential for RAII.
+     * Safely deallocates the memory block. Marked noexcept to guarantee no
+     * exceptions during destruction, which is essential for RAII.
      */
-    ~MemoryBlock() noexcept { free(m_data); }
+    ~MemoryBlock() noexcept { release(); }
 
     /**
      * @brief Copy constructor that creates a deep copy of another memory block
@@ -76,13 +90,8 @@ public:
      * @param other The source memory block to copy from
      */
     MemoryBlock(const MemoryBlock& other) : m_size(other.m_size) {
-        void* data = malloc(sizeof(T) * m_size);
-        if (data != nullptr) {
-            m_data = (T*)data;
-            std::memcpy(m_data, other.m_data, sizeof(T) * m_size);
-        } else {
-            LOG_ERROR << "Failed to allocate memory!" << '\n';
-        }
+        m_data = allocate(m_size);
+        if (m_data != nullptr) { copy_elements(m_data, other.m_data, m_size); }
     }
 
     /**
@@ -96,15 +105,11 @@ public:
      */
     MemoryBlock& operator=(const MemoryBlock& other) {
         if (this != &other) {
-            free(m_data);
+            release();
             m_size = other.m_size;
-            void* data = malloc(sizeof(T) * m_size);
-            if (data != nullptr) {
-                m_data = (T*)data;
-                std::memcpy(m_data, other.m_data, sizeof(T) * m_size);
-            } else {
-                LOG_ERROR << "Failed to allocate memory!" << '\n';
-            }
+            m_data = allocate(m_size);
+            m_owned = true;
+            if (m_data != nullptr) { copy_elements(m_data, other.m_data, m_size); }
         }
         return *this;
     }
@@ -119,9 +124,11 @@ public:
      *
      * @note Marked noexcept to guarantee no exceptions, essential for move semantics
      */
-    MemoryBlock(MemoryBlock&& other) noexcept : m_size(other.m_size), m_data(other.m_data) {
+    MemoryBlock(MemoryBlock&& other) noexcept
+        : m_data(other.m_data), m_size(other.m_size), m_owned(other.m_owned) {
         other.m_size = 0;
         other.m_data = nullptr;
+        other.m_owned = true;
     }
 
     /**
@@ -137,11 +144,13 @@ public:
      */
     MemoryBlock& operator=(MemoryBlock&& other) noexcept {
         if (this != &other) {
-            free(m_data);
+            release();
             m_size = other.m_size;
             m_data = other.m_data;
+            m_owned = other.m_owned;
             other.m_size = 0;
             other.m_data = nullptr;
+            other.m_owned = true;
         }
         return *this;
     }
@@ -185,6 +194,13 @@ public:
      */
     T* data() { return m_data; }
 
+    /**
+     * @brief Gets a const pointer to the raw memory data
+     *
+     * @return Const pointer to the first element in the memory block
+     */
+    const T* data() const { return m_data; }
+
     /**
      * @brief Gets the number of elements in the memory block
      *
@@ -192,6 +208,11 @@ public:
      */
     size_t size() const { return m_size; }
 
+    /**
+     * @brief Checks whether the block frees its memory or is a view of memory owned elsewhere
+     */
+    bool is_owned() const { return m_owned; }
+
     /**
      * @brief Resizes the memory block to a new size
      *
@@ -201,26 +222,21 @@ public:
      *
      * @param size New number of elements to allocate
      *
-     * @note This operation may invalidate existing pointers to the data.
-     *       For performance, realloc is used when possible to avoid unnecessary copying.
+     * @note This operation invalidates existing pointers to the data. Aligned memory cannot be
+     *       reallocated in place, so the kept elements are copied to the new memory. A view is
+     *       always replaced with owned memory.
      */
     void resize(size_t size) {
-        m_size = size;
-        void* data;
-        if (m_size > 0) {
-            data = realloc(m_data, sizeof(T) * size);
-        } else {
-            free(m_data);
-            // A size of 0 is a valid empty block; malloc(0) is intentional here.
-            // NOLINTNEXTLINE(clang-analyzer-optin.portability.UnixAPI)
-            data = malloc(sizeof(T) * size);
-        }
-
-        if (data != nullptr) {
-            m_data = (T*)data;
-        } else {
-            LOG_ERROR << "Failed to reallocate memory!" << '\n';
+        if (size == m_size && m_owned) { return; }
+        T* data = allocate(size);
+        if (data == nullptr && size > 0) { return; }
+        if (m_data != nullptr && data != nullptr) {
+            copy_elements(data, m_data, std::min(size, m_size));
         }
+        release();
+        m_data = data;
+        m_size = size;
+        m_owned = true;
     }
 
     /**
@@ -252,7 +268,9 @@ public:
      * @param other The memory block to swap data with
      *
      * @note Both blocks must have identical sizes for the swap to succeed.
-     *       This function is only available for trivially copyable types.
+     *       This function is only available for trivially copyable types. If one of the blocks is
+     *       a view, the elements are exchanged instead, so no block ends up with memory it does
+     *       not own.
      */
     template <typename U = T>
     void swap_data(MemoryBlock& other)
@@ -260,7 +278,11 @@ public:
     {
         if (this != &other) {
             if (m_size == other.m_size) {
-                std::swap(m_data, other.m_data);
+                if (m_owned && other.m_owned) {
+                    std::swap(m_data, other.m_data);
+                } else {
+                    std::swap_ranges(m_data, m_data + m_size, other.m_data);
+                }
             } else {
                 LOG_ERROR << "Cannot swap data with different sizes!" << '\n';
             }
@@ -276,20 +298,70 @@ public:
      * @param data Reference to the raw memory pointer to swap with
      * @param size Size of the raw memory in number of elements
      *
-     * @note The provided memory size must match this block's current size.
-     *       After the swap, the caller assumes ownership of this block's original memory.
+     * @note The provided memory size must match this block's current size and the memory must be
+     *       allocated with AlignedAllocator::allocate() and at least the block's Alignment.
+     *       After the swap, the caller assumes ownership of this block's original memory. A view
+     *       exchanges the elements instead and keeps its memory.
      */
     void swap_data(T*& data, size_t size) {
         if (m_size == size) {
-            std::swap(m_data, data);
+            if (m_owned) {
+                std::swap(m_data, data);
+            } else {
+                std::swap_ranges(m_data, m_data + m_size, data);
+            }
         } else {
             LOG_ERROR << "Cannot swap data with different sizes!" << '\n';
         }
     }
 
 private:
+    /**
+     * @brief Frees the memory unless the block is a view
+     */
+    void release() noexcept {
+        if (m_owned) { AlignedAllocator::deallocate(m_data); }
+    }
+
+    /**
+     * @brief Copies elements into uninitialized memory
+     *
+     * Atomics cannot be copied, their values are loaded and stored one by one. They are checked
+     * first, since some compilers report them as trivially copyable. Other trivially copyable
+     * elements are copied bytewise, the rest are copy constructed.
+     *
+     * @param destination Uninitialized memory of at least size elements
+     * @param source Elements to copy
+     * @param size Number of elements
+     */
+    static void copy_elements(T* destination, const T* source, size_t size) {
+        if constexpr (!std::is_copy_constructible_v<T>) {
+            for (size_t i = 0; i < size; ++i) {
+                std::construct_at(destination + i, source[i].load(std::memory_order_relaxed));
+            }
+        } else if constexpr (std::is_trivially_copyable_v<T>) {
+            std::memcpy(destination, source, sizeof(T) * size);
+        } else {
+            std::uninitialized_copy_n(source, size, destination);
+        }
+    }
+
+    /**
+     * @brief Allocates memory for the given number of elements with the block's alignment
+     *
+     * @param size Number of elements, 0 returns nullptr
+     * @return Pointer to the uninitialized memory, nullptr if empty or the allocation failed
+     */
+    static T* allocate(size_t size) {
+        if (size == 0) { return nullptr; }
+        void* data = AlignedAllocator::allocate(sizeof(T) * size, Alignment);
+        if (data == nullptr) { LOG_ERROR << "Failed to allocate memory!" << '\n'; }
+        return static_cast<T*>(data);
+    }
+
     T* m_data = nullptr;  ///< Pointer to the allocated memory block
     size_t m_size;        ///< Number of elements in the memory block
+    bool m_owned = true;  ///< Whether the block frees the memory, false for views
 };
 
 }  // namespace anira
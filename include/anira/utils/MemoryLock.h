@@ -0,0 +1,111 @@
+#ifndef ANIRA_MEMORYLOCK_H
+#define ANIRA_MEMORYLOCK_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "../system/AniraWinExports.h"
+
+namespace anira {
+
+/**
+ * @brief Result of locking memory in physical memory
+ *
+ * Returned by InferenceHandler::get_memory_lock_status() for the buffers and models of a session
+ * and by Context::get_memory_lock_status() for the stacks of the inference threads.
+ */
+struct ANIRA_API MemoryLockStatus {
+    size_t m_locked_bytes = 0;          ///< Bytes locked in physical memory
+    size_t m_failed_bytes = 0;          ///< Bytes that were prefaulted but could not be locked
+    std::vector<std::string> m_errors;  ///< Reason of every failed lock, e.g. exceeding the
+                                        ///< RLIMIT_MEMLOCK resource limit
+
+    /**
+     * @brief Checks whether all memory could be locked
+     */
+    bool is_ok() const;
+
+    /**
+     * @brief Adds the bytes and errors of another status to this one
+     *
+     * @param other Status to add
+     */
+    void merge(const MemoryLockStatus& other);
+};
+
+/**
+ * @brief Prefaults memory and locks it in physical memory
+ *
+ * Page faults on the first touch of a buffer, or after the buffer was swapped out under memory
+ * pressure, stall the thread touching it. Locked memory is faulted in once and never paged out.
+ * Uses mlock() on POSIX systems and VirtualLock() on Windows, whose limits (RLIMIT_MEMLOCK,
+ * the working set size) may be too low for large models. Memory that cannot be locked is still
+ * prefaulted. The operating system locks whole pages and does not nest locks, so the locked
+ * ranges touching every page are counted and unlock() only unlocks the pages no other locked range
+ * touches. Buffers of different sessions sharing a page therefore stay locked independently.
+ */
+class ANIRA_API MemoryLock {
+public:
+    static constexpr size_t k_stack_size = 256 * 1024;  ///< Bytes of the stack locked by
+                                                        ///< lock_stack()
+
+    /**
+     * @brief Prefaults and locks a writable memory range
+     *
+     * @param data Start of the range, nullptr is ignored
+     * @param bytes Size of the range in bytes
+     * @param status Receives the locked or failed bytes and the reason of a failure
+     * @return Whether the range was locked
+     */
+    static bool lock(void* data, size_t bytes, MemoryLockStatus& status);
+
+    /**
+     * @brief Unlocks a memory range locked with lock()
+     *
+     * Pages the range shares with other ranges locked with lock() stay locked.
+     *
+     * @param data Start of the range, nullptr is ignored
+     * @param bytes Size of the range in bytes
+     */
+    static void unlock(const void* data, size_t bytes);
+
+    /**
+     * @brief Faults in every page of a writable memory range by writing it
+     *
+     * Reading would only map the shared zero page for untouched anonymous memory, and the first
+     * write would still fault. Every page is written without changing its values, also when other
+     * threads write the range concurrently.
+     *
+     * @param data Start of the range, nullptr is ignored
+     * @param bytes Size of the range in bytes
+     */
+    static void prefault(void* data, size_t bytes);
+
+    /**
+     * @brief Checks whether the page containing an address is locked by a range locked with lock()
+     *
+     * @param data Address within the page
+     */
+    static bool is_locked(const void* data);
+
+    /**
+     * @brief Prefaults and locks k_stack_size bytes of the calling thread's stack
+     *
+     * The locked pages lie below the caller's frame, where the functions called later place
+     * theirs. Call it early in the thread, at a shallow call depth.
+     *
+     * @param status Receives the locked or failed bytes and the reason of a failure
+     * @return Whether the stack was locked
+     */
+    static bool lock_stack(MemoryLockStatus& status);
+
+    /**
+     * @brief Gets the size of a memory page in bytes
+     */
+    static size_t get_page_size();
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_MEMORYLOCK_H
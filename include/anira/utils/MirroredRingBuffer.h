@@ -0,0 +1,175 @@
+#ifndef ANIRA_MIRROREDRINGBUFFER_H
+#define ANIRA_MIRROREDRINGBUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../system/AniraWinExports.h"
+
+namespace anira {
+
+/**
+ * @brief Ring buffer whose windows are contiguous in memory
+ *
+ * Alternative to RingBuffer for code that reads whole windows, e.g. a custom pre_process() or
+ * backend that feeds a model straight from the ring. The capacity of every channel is a power of
+ * two, so positions are free-running counters wrapped with a mask instead of a compare and branch.
+ * Each channel is followed by a mirror of itself, so any window of up to the capacity starts at a
+ * single pointer and can be read in place without copying it out.
+ *
+ * On Linux the mirror is a second virtual mapping of the same memfd pages, writes land in both
+ * halves for free and the capacity is rounded up to whole pages. Elsewhere, or if the mapping
+ * fails, both halves are allocated and every write is stored twice.
+ *
+ * @code
+ * anira::MirroredRingBuffer ring;
+ * ring.initialize(1, 4096);
+ * ring.push_samples(0, block, 256);
+ * const float* window = ring.get_window(0, 256, 1024);  // 1024 past and 256 new samples
+ * model_input.assign(window, window + 1280);
+ * ring.advance(0, 256);
+ * @endcode
+ *
+ * @note initialize() allocates, all other methods are real-time safe.
+ * @see RingBuffer
+ */
+class ANIRA_API MirroredRingBuffer {
+public:
+    /**
+     * @brief Default constructor that creates an empty ring buffer
+     */
+    MirroredRingBuffer() = default;
+
+    /**
+     * @brief Destructor that releases the memory of all channels
+     */
+    ~MirroredRingBuffer();
+
+    MirroredRingBuffer(const MirroredRingBuffer&) = delete;
+    MirroredRingBuffer& operator=(const MirroredRingBuffer&) = delete;
+
+    /**
+     * @brief Allocates the channels and clears them
+     *
+     * @param num_channels Number of channels
+     * @param min_num_samples Minimum capacity per channel, rounded up to a power of two and, for
+     *                        mirrored mappings, to whole pages
+     */
+    void initialize(size_t num_channels, size_t min_num_samples);
+
+    /**
+     * @brief Sets all samples to zero and resets the positions
+     */
+    void clear();
+
+    /**
+     * @brief Gets the number of channels
+     */
+    size_t get_num_channels() const;
+
+    /**
+     * @brief Gets the capacity of every channel in samples, always a power of two
+     */
+    size_t get_capacity() const;
+
+    /**
+     * @brief Checks whether the mirror is a virtual memory mapping instead of a second copy
+     */
+    bool is_mirrored() const;
+
+    /**
+     * @brief Pushes a sample into a channel
+     *
+     * Overwrites the oldest unread sample if the channel is full.
+     *
+     * @param channel The channel index to write to (0-based)
+     * @param sample The sample value to write
+     */
+    void push_sample(size_t channel, float sample);
+
+    /**
+     * @brief Pushes a block of samples into a channel
+     *
+     * Overwrites the oldest unread samples if the channel overflows.
+     *
+     * @param channel The channel index to write to (0-based)
+     * @param data Samples to write
+     * @param num_samples Number of samples to write
+     */
+    void push_samples(size_t channel, const float* data, size_t num_samples);
+
+    /**
+     * @brief Pops a sample from a channel
+     *
+     * @param channel The channel index to read from (0-based)
+     * @return The sample, or silence (0.0f) if the channel is empty
+     */
+    float pop_sample(size_t channel);
+
+    /**
+     * @brief Gets a window of past and new samples without copying it
+     *
+     * The window holds the num_old_samples already read samples before the read position
+     * followed by the next num_new_samples unread samples. The read position is not changed, call
+     * advance() once the window is consumed.
+     *
+     * @param channel The channel index to read from (0-based)
+     * @param num_new_samples Number of unread samples in the window
+     * @param num_old_samples Number of already read samples preceding them
+     * @return Pointer to num_old_samples + num_new_samples contiguous samples, valid until the
+     *         next write, or nullptr if not enough samples are available
+     */
+    const float* get_window(size_t channel, size_t num_new_samples, size_t num_old_samples) const;
+
+    /**
+     * @brief Advances the read position of a channel
+     *
+     * @param channel The channel index (0-based)
+     * @param num_samples Number of samples to consume, at most the available samples
+     */
+    void advance(size_t channel, size_t num_samples);
+
+    /**
+     * @brief Gets the number of unread samples of a channel
+     */
+    size_t get_available_samples(size_t channel) const;
+
+    /**
+     * @brief Gets the number of already read samples of a channel that a window can include
+     */
+    size_t get_available_past_samples(size_t channel) const;
+
+private:
+    /**
+     * @brief Memory and positions of one channel
+     */
+    struct Channel {
+        float* m_data = nullptr;    ///< First half of the channel, the mirror follows it
+        void* m_mapping = nullptr;  ///< Start of the double mapping, nullptr if allocated
+        uint64_t m_read = 0;        ///< Number of samples read so far
+        uint64_t m_write = 0;       ///< Number of samples written so far
+    };
+
+    /**
+     * @brief Releases the memory of all channels
+     */
+    void release();
+
+    /**
+     * @brief Maps the same pages twice in a row
+     *
+     * @param channel Channel receiving the mapping
+     * @return Whether the mapping succeeded, false on platforms without memfd
+     */
+    bool map_mirrored(Channel& channel) const;
+
+    std::vector<Channel> m_channels;  ///< Memory and positions of every channel
+    size_t m_capacity = 0;            ///< Samples per channel, a power of two
+    size_t m_mask = 0;                ///< m_capacity - 1, wraps positions into the channel
+    bool m_mirrored = false;          ///< Whether the mirrors are virtual memory mappings
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_MIRROREDRINGBUFFER_H
@@ -0,0 +1,132 @@
+#ifndef ANIRA_PARAMETERBLOCK_H
+#define ANIRA_PARAMETERBLOCK_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "../system/AniraWinExports.h"
+#include "MemoryBlock.h"
+
+namespace anira {
+
+/**
+ * @brief Thread-safe storage for a non-streamable tensor that is published and read as a whole
+ *
+ * Holds the values of a parameter tensor (e.g. control values, latents or embeddings) behind a
+ * sequence lock. A writer publishes the whole tensor in one write section and readers copy a
+ * consistent snapshot of it, retrying when a write overlapped the copy. Neither side allocates,
+ * and the values are accessed with relaxed atomic operations, so a copy costs about as much as a
+ * memcpy instead of one sequentially consistent atomic operation per value.
+ *
+ * Single values can still be set and read on their own. Setting a value never waits, it only
+ * makes overlapping readers retry. Whole-tensor writes from different threads wait for each
+ * other in write(). A real-time thread publishes with try_write() instead, which gives up while
+ * another thread is in its write section.
+ *
+ * @code
+ * anira::ParameterBlock block(512);
+ * block.write(latents.data(), 512);     // Writer thread
+ * block.read(tensor.data(), 512);       // Reader thread, a snapshot of one write
+ * @endcode
+ *
+ * @see PrePostProcessor::set_input_tensor(), PrePostProcessor::get_output_tensor()
+ */
+class ANIRA_API ParameterBlock {
+public:
+    static constexpr size_t k_max_read_attempts = 64;  ///< Copies read() tries before it
+                                                       ///< returns a possibly torn snapshot
+
+    /**
+     * @brief Constructor that allocates the storage, all values are zero
+     *
+     * @param size Number of values in the tensor
+     */
+    ParameterBlock(size_t size = 0);
+
+    ParameterBlock(const ParameterBlock&) = delete;
+    ParameterBlock& operator=(const ParameterBlock&) = delete;
+
+    /**
+     * @brief Reallocates the storage and sets all values to zero
+     *
+     * @param size Number of values in the tensor
+     *
+     * @warning Not thread-safe, must not be called while the block is written or read
+     */
+    void resize(size_t size);
+
+    /**
+     * @brief Gets the number of values in the tensor
+     */
+    size_t size() const;
+
+    /**
+     * @brief Publishes a range of values in one write section
+     *
+     * Waits for whole-tensor writes of other threads to leave their write sections.
+     *
+     * @param data Values to publish
+     * @param num_values Number of values
+     * @param offset Index of the first value in the tensor
+     */
+    void write(const float* data, size_t num_values, size_t offset = 0);
+
+    /**
+     * @brief Publishes a range of values unless another whole-tensor write is in progress
+     *
+     * Never waits for other writers, so it can be called from a real-time thread that shares the
+     * block with other writers. The values are dropped if another thread is in its write section.
+     *
+     * @param data Values to publish
+     * @param num_values Number of values
+     * @param offset Index of the first value in the tensor
+     * @return Whether the values were published
+     */
+    bool try_write(const float* data, size_t num_values, size_t offset = 0);
+
+    /**
+     * @brief Copies a consistent snapshot of a range of values
+     *
+     * Retries the copy while a write overlaps it. If a writer is preempted during its write
+     * section, the last copy is kept after k_max_read_attempts, so the reader never blocks.
+     *
+     * @param data Destination of the values
+     * @param num_values Number of values
+     * @param offset Index of the first value in the tensor
+     * @return Whether the copy is a consistent snapshot
+     */
+    bool read(float* data, size_t num_values, size_t offset = 0) const;
+
+    /**
+     * @brief Sets a single value without waiting for other writers
+     *
+     * @param index Index of the value in the tensor
+     * @param value The value to store
+     */
+    void set(size_t index, float value);
+
+    /**
+     * @brief Gets a single value
+     *
+     * @param index Index of the value in the tensor
+     */
+    float get(size_t index) const;
+
+    /**
+     * @brief Gets the sequence number, which changes with every write
+     *
+     * The number is odd while a whole-tensor write is in progress. Comparing it with an earlier
+     * one tells whether the tensor may have changed since.
+     */
+    uint32_t get_sequence() const;
+
+private:
+    MemoryBlock<std::atomic<float>> m_data;  ///< Values of the tensor
+    std::atomic<uint32_t> m_sequence{0};     ///< Odd during a whole-tensor write, advanced by two
+                                             ///< by every single-value write
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_PARAMETERBLOCK_H
@@ -0,0 +1,153 @@
+#ifndef ANIRA_REALTIMELOGGER_H
+#define ANIRA_REALTIMELOGGER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "../system/AniraWinExports.h"
+#include "RealtimeSanitizer.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define ANIRA_PRINTF_FORMAT(format_index, first_arg_index) \
+    __attribute__((format(printf, format_index, first_arg_index)))
+#else
+#define ANIRA_PRINTF_FORMAT(format_index, first_arg_index)
+#endif
+
+namespace anira {
+
+/**
+ * @brief Severity of a log message
+ */
+enum class LogLevel : uint8_t {
+    Info = 0,
+    Warning = 1,
+    Error = 2,
+    None = 3  ///< Only valid as filter level, suppresses all messages
+};
+
+/**
+ * @brief Per call site limiter that lets a burst of messages through per time window
+ *
+ * A LogRateLimiter is created as a constant-initialized static at every LOG_RT_* call site, so
+ * a message that fires on every audio callback is printed at most k_burst times per window. The
+ * number of suppressed messages is reported with the next message that passes.
+ */
+class ANIRA_API LogRateLimiter {
+public:
+    static constexpr uint32_t k_burst = 5;                   ///< Messages allowed per window
+    static constexpr int64_t k_window_ns = 1'000'000'000;    ///< Window length in nanoseconds
+
+    constexpr LogRateLimiter() = default;
+
+    /**
+     * @brief Decides whether a message from this call site may be logged
+     *
+     * @param now_ns Current time in nanoseconds
+     * @param suppressed Set to the number of messages suppressed since the last allowed one
+     * @return True if the message should be logged
+     */
+    bool allow(int64_t now_ns, uint32_t& suppressed) ANIRA_REALTIME;
+
+private:
+    std::atomic<int64_t> m_window_start_ns{0};
+    std::atomic<uint32_t> m_count{0};
+    std::atomic<uint32_t> m_suppressed{0};
+};
+
+/**
+ * @brief Lock-free logger that can be called from the audio and inference threads
+ *
+ * Messages are formatted with vsnprintf into a fixed-size slot of a preallocated multi-producer
+ * ring on the calling thread, so logging neither locks nor allocates. A background thread,
+ * running while an anira Context exists, drains the ring and hands the messages to the sink
+ * (std::cout for info and warnings, std::cerr for errors by default).
+ *
+ * Messages below the configured level are discarded before formatting. If the ring is full the
+ * message is dropped and the number of dropped messages is reported on the next drain.
+ *
+ * Use the LOG_RT_INFO, LOG_RT_WARNING and LOG_RT_ERROR macros from Logger.h instead of calling
+ * log() directly, they respect ANIRA_WITH_LOGGING and add per call site rate limiting.
+ */
+class ANIRA_API RealtimeLogger {
+public:
+    static constexpr size_t k_capacity = 256;       ///< Number of message slots in the ring
+    static constexpr size_t k_message_size = 256;   ///< Maximum message length including the
+                                                    ///< terminating null character
+
+    using Sink = std::function<void(LogLevel level, const char* message)>;
+
+    /**
+     * @brief Formats a message into the ring
+     *
+     * @param level Severity of the message
+     * @param rate_limiter Limiter of the call site, or nullptr to log unconditionally
+     * @param format printf-style format string
+     *
+     * @note Real-time safe as long as the format only uses integer, string and pointer
+     *       conversions, which is the case for all messages in anira.
+     */
+    static void log(LogLevel level, LogRateLimiter* rate_limiter, const char* format, ...)
+        ANIRA_REALTIME ANIRA_PRINTF_FORMAT(3, 4);
+
+    /**
+     * @brief Sets the minimum severity of messages that are logged
+     *
+     * @param level Minimum level, LogLevel::None disables all messages
+     */
+    static void set_level(LogLevel level);
+
+    /**
+     * @brief Gets the minimum severity of messages that are logged
+     *
+     * @return Current filter level
+     */
+    static LogLevel get_level();
+
+    /**
+     * @brief Enables or disables the per call site rate limiting
+     *
+     * Rate limiting is enabled by default. Disabling it is mainly useful in tests and when
+     * debugging, where every message is needed.
+     *
+     * @param enabled True to apply the call site rate limiters
+     */
+    static void set_rate_limiting(bool enabled);
+
+    /**
+     * @brief Replaces the function that receives drained messages
+     *
+     * @param sink New sink, or an empty function to restore the default console output
+     *
+     * @note The sink is called from the background thread or from flush().
+     */
+    static void set_sink(Sink sink);
+
+    /**
+     * @brief Starts the background drain thread, or increases its reference count
+     */
+    static void start();
+
+    /**
+     * @brief Decreases the reference count and stops the drain thread when it reaches zero
+     *
+     * Pending messages are drained before the thread stops.
+     */
+    static void stop();
+
+    /**
+     * @brief Drains all pending messages on the calling thread
+     *
+     * @note Must not be called from a real-time thread.
+     */
+    static void flush();
+
+private:
+    static void drain_loop();
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_REALTIMELOGGER_H
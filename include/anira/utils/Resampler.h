@@ -0,0 +1,171 @@
+#ifndef ANIRA_RESAMPLER_H
+#define ANIRA_RESAMPLER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../system/AniraWinExports.h"
+#include "ResamplerQuality.h"
+
+namespace anira {
+
+/**
+ * @brief Streaming polyphase resampler for a rational ratio of two sample rates
+ *
+ * Converts multichannel audio from a source to a target sample rate. The ratio of the rates is
+ * reduced to L/M, the signal is conceptually upsampled by L, low-pass filtered by a Kaiser-windowed
+ * sinc and decimated by M. Only the L phases of the filter that produce output samples are
+ * evaluated, each one a dot product of a few dozen taps with contiguous input samples computed with
+ * SSE on x86-64, NEON on ARM and scalar code elsewhere. Ratios whose L exceeds k_max_num_phases use
+ * the nearest of k_max_num_phases phases.
+ *
+ * The resampler is used in two ways:
+ * - Push: every call consumes all input samples and returns the output samples they complete.
+ * - Pull: get_num_input_samples() tells how many input samples complete a given number of output
+ *   samples, process() is called with exactly these and the number of output samples as limit.
+ *
+ * The group delay of the filter is get_latency() target samples. set_phase_offset() advances the
+ * sampling instants of all output samples by a fraction of a source sample, which shortens the
+ * delay and lets SessionElement make the total latency of a resampled session a whole number of
+ * host samples.
+ *
+ * @note prepare() allocates, all other methods are real-time safe.
+ * @see ResamplerQuality, ProcessingSpec
+ */
+class ANIRA_API Resampler {
+public:
+    /** @brief Maximum number of filter phases, bounds the size of the coefficient table */
+    static constexpr uint64_t k_max_num_phases = 1024;
+
+    /**
+     * @brief Default constructor that creates an unprepared resampler
+     */
+    Resampler() = default;
+
+    /**
+     * @brief Designs the filter and allocates the history of all channels
+     *
+     * @param num_channels Number of channels
+     * @param source_sample_rate Sample rate of the input in Hz, rounded to whole Hz
+     * @param target_sample_rate Sample rate of the output in Hz, rounded to whole Hz
+     * @param quality Quality of the filter
+     * @param max_num_input_samples Largest number of input samples passed to one process() call
+     */
+    void prepare(size_t num_channels,
+                 double source_sample_rate,
+                 double target_sample_rate,
+                 ResamplerQuality quality,
+                 size_t max_num_input_samples);
+
+    /**
+     * @brief Clears the history and returns to the first output sample
+     */
+    void reset();
+
+    /**
+     * @brief Advances the sampling instants of all output samples and resets the resampler
+     *
+     * @param phase_offset Offset in units of 1/L source samples, shortens the latency by
+     * phase_offset / M target samples
+     */
+    void set_phase_offset(uint64_t phase_offset);
+
+    /**
+     * @brief Resamples a block of samples
+     *
+     * @param input Input samples of every channel
+     * @param num_input_samples Number of input samples per channel, all of them are consumed
+     * @param output Receives the output samples of every channel
+     * @param max_num_output_samples Capacity of the output per channel, output samples beyond it
+     * stay pending for the next call
+     * @return Number of output samples written per channel
+     */
+    size_t process(const float* const* input,
+                   size_t num_input_samples,
+                   float* const* output,
+                   size_t max_num_output_samples);
+
+    /**
+     * @brief Gets the number of output samples the next process() call completes
+     *
+     * @param num_input_samples Number of input samples passed to the call
+     */
+    size_t get_num_output_samples(size_t num_input_samples) const;
+
+    /**
+     * @brief Gets the number of input samples the next process() call needs for an output
+     *
+     * @param num_output_samples Number of output samples to complete
+     */
+    size_t get_num_input_samples(size_t num_output_samples) const;
+
+    /**
+     * @brief Gets an upper bound of the output samples of one process() call
+     *
+     * @param num_input_samples Number of input samples passed to the call
+     */
+    size_t get_max_num_output_samples(size_t num_input_samples) const;
+
+    /**
+     * @brief Gets the group delay of the filter minus the phase offset in target samples
+     */
+    double get_latency() const;
+
+    /**
+     * @brief Gets the upsampling factor L of the reduced ratio
+     */
+    uint64_t get_interpolation_factor() const;
+
+    /**
+     * @brief Gets the downsampling factor M of the reduced ratio
+     */
+    uint64_t get_decimation_factor() const;
+
+    /**
+     * @brief Gets the number of taps per phase of the prepared filter
+     */
+    size_t get_num_taps() const;
+
+    /**
+     * @brief Gets the largest number of input samples one process() call accepts
+     */
+    size_t get_max_num_input_samples() const;
+
+    /**
+     * @brief Gets the bytes held by the history and the coefficient table
+     */
+    size_t get_memory_size() const;
+
+    /**
+     * @brief Gets the number of taps per phase of a quality when upsampling
+     *
+     * Downsampling filters grow by the ratio of the rates, rounded up to a multiple of eight.
+     *
+     * @param quality Quality of the filter
+     */
+    static size_t get_num_taps(ResamplerQuality quality);
+
+private:
+    /**
+     * @brief Fills the coefficient table with the phases of a Kaiser-windowed sinc
+     */
+    void design_filter(ResamplerQuality quality);
+
+    std::vector<std::vector<float>> m_history;  ///< Past and new input samples of every channel
+    std::vector<float> m_coefficients;  ///< Taps of every phase, reversed to run forward over the
+                                        ///< history
+    size_t m_num_taps = 0;              ///< Taps per phase
+    size_t m_num_history = 0;           ///< Samples in the history of every channel
+    size_t m_max_num_input_samples = 0;  ///< Input samples one process() call accepts
+    uint64_t m_interpolation = 1;       ///< Upsampling factor L
+    uint64_t m_decimation = 1;          ///< Downsampling factor M
+    uint64_t m_num_phases = 1;          ///< Rows of the coefficient table, L up to k_max_num_phases
+    uint64_t m_phase_offset = 0;        ///< Offset of the first output in units of 1/L samples
+    uint64_t m_time = 0;  ///< Position of the next output in units of 1/L samples from the start
+                          ///< of the history
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_RESAMPLER_H
@@ -0,0 +1,33 @@
+#ifndef ANIRA_RESAMPLERQUALITY_H
+#define ANIRA_RESAMPLERQUALITY_H
+
+namespace anira {
+
+/**
+ * @brief Enumeration of the quality settings of the built-in resampler
+ *
+ * When a ProcessingSpec declares a model sample rate that differs from the sample rate of the
+ * host, anira resamples the streamable tensors between the host and the ring buffers of the
+ * session. The quality trades the length of the polyphase filters, and thereby the latency and
+ * the cost per sample, against the stopband attenuation and the width of the passband.
+ *
+ * @see ProcessingSpec, Resampler
+ */
+enum ResamplerQuality {
+    /**
+     * @brief 32 taps per phase, about 60 dB stopband attenuation, passband up to 76 % of Nyquist
+     */
+    LOW_QUALITY,
+    /**
+     * @brief 64 taps per phase, about 80 dB stopband attenuation, passband up to 84 % of Nyquist
+     */
+    MEDIUM_QUALITY,
+    /**
+     * @brief 128 taps per phase, about 100 dB stopband attenuation, passband up to 90 % of Nyquist
+     */
+    HIGH_QUALITY
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_RESAMPLERQUALITY_H
@@ -2,6 +2,7 @@
 #define ANIRA_RINGBUFFER_H
 
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
 #include "Buffer.h"
@@ -50,10 +51,14 @@ public:
      *
      * @param num_channels Number of audio channels to allocate
      * @param num_samples Number of samples per channel (buffer size)
+     * @param memory Memory owned elsewhere the buffer uses instead of allocating its own, e.g. a
+     *               part of an Arena, nullptr to allocate
      *
      * @note This method involves memory allocation and should not be called in real-time contexts
      */
-    void initialize_with_positions(size_t num_channels, size_t num_samples);
+    void initialize_with_positions(size_t num_channels,
+                                   size_t num_samples,
+                                   float* memory = nullptr);
 
     /**
      * @brief Clears the buffer content and resets all position counters
@@ -122,6 +127,56 @@ public:
      */
     float get_past_sample(size_t channel, size_t offset);
 
+    /**
+     * @brief Copies a window of past and new samples and advances the read position
+     *
+     * Copies the num_old_samples samples before the read position followed by the next
+     * num_new_samples samples, then advances the read position past the new samples. Equivalent to
+     * popping the new samples and fetching the old ones with get_past_sample(), but the window is
+     * copied with at most two memcpy calls, one on each side of the wrap-around.
+     *
+     * @param channel The channel index to read from (0-based)
+     * @param destination Receives num_old_samples + num_new_samples samples
+     * @param num_new_samples Number of samples to pop
+     * @param num_old_samples Number of already read samples preceding the new ones
+     * @return Whether enough new and past samples were available. Missing past samples are
+     *         silence. If new samples are missing, the window is silence and the available new
+     *         samples are skipped
+     *
+     * @note This method is real-time safe
+     */
+    bool pop_window(size_t channel,
+                    float* destination,
+                    size_t num_new_samples,
+                    size_t num_old_samples);
+
+    /**
+     * @brief Copies overlapping windows advancing by a hop of new samples each in one pass
+     *
+     * Window k ends (k + 1) * hop_size samples after the read position, so the result is the same
+     * as num_windows calls of pop_window(channel, destination + k * destination_stride, hop_size,
+     * window_size - hop_size). The wrap-around is resolved once per window instead of once per
+     * sample, and the read position is advanced once by num_windows * hop_size samples.
+     *
+     * @param channel The channel index to read from (0-based)
+     * @param destination Receives the first window, window k starts at k * destination_stride
+     * @param num_windows Number of windows to copy
+     * @param window_size Number of samples per window
+     * @param hop_size Number of new samples per window
+     * @param destination_stride Distance between the starts of two windows in destination
+     * @return Whether enough new and past samples were available. Missing past samples, the
+     *         oldest samples of the first windows, are silence. If new samples are missing, all
+     *         windows are silence and the available new samples are skipped
+     *
+     * @note This method is real-time safe
+     */
+    bool pop_windows(size_t channel,
+                     float* destination,
+                     size_t num_windows,
+                     size_t window_size,
+                     size_t hop_size,
+                     size_t destination_stride);
+
     /**
      * @brief Gets the number of samples available for reading from a channel
      *
@@ -0,0 +1,144 @@
+#ifndef ANIRA_SPECTRALSPEC_H
+#define ANIRA_SPECTRALSPEC_H
+
+#include <cstddef>
+
+#include "../system/AniraWinExports.h"
+
+namespace anira {
+
+/**
+ * @brief Enumeration of the features the built-in spectral stage passes to and from a model
+ *
+ * Every frame is a periodic Hann window of m_fft_size samples, frames are m_hop_size samples
+ * apart and have m_fft_size / 2 + 1 frequency bins. The tensors are planar, with the frames of
+ * the first channel followed by the frames of the next one.
+ *
+ * @see SpectralSpec, SpectralTransform
+ */
+enum SpectralFeature {
+    /**
+     * @brief The tensor holds samples, the spectral stage is not used
+     */
+    NO_SPECTRAL_FEATURE,
+    /**
+     * @brief Complex spectrum, shape [channels, frames, bins, 2] with the real and the imaginary
+     * part of every bin
+     *
+     * The only feature output tensors support, they are synthesized by overlap-add.
+     */
+    COMPLEX_SPECTRUM,
+    /**
+     * @brief Magnitude spectrum, shape [channels, frames, bins]
+     */
+    MAGNITUDE_SPECTRUM,
+    /**
+     * @brief Natural logarithm of the power spectrum weighted by triangular mel filters, shape
+     * [channels, frames, mels]
+     */
+    LOG_MEL_SPECTRUM
+};
+
+/**
+ * @brief Specification of the built-in spectral stage of one tensor
+ *
+ * Declared per tensor in ProcessingSpec. An input tensor receives the features of the frames that
+ * end within the preprocess_input_size new samples of an inference, an output tensor delivers the
+ * complex spectra of the frames that are overlap-added into the postprocess_output_size new
+ * samples. The sizes must be multiples of m_hop_size.
+ *
+ * @see ProcessingSpec, SpectralFeature, SpectralTransform
+ */
+struct ANIRA_API SpectralSpec {
+    SpectralFeature m_feature = NO_SPECTRAL_FEATURE;  ///< Feature passed to or from the model
+    size_t m_fft_size = 0;        ///< Samples per frame, a power of two
+    size_t m_hop_size = 0;        ///< Samples between the starts of consecutive frames
+    size_t m_num_mels = 0;        ///< Mel bands of LOG_MEL_SPECTRUM features
+    float m_min_frequency = 0.f;  ///< Lower edge of the lowest mel band in Hz
+    float m_max_frequency = 0.f;  ///< Upper edge of the highest mel band in Hz, 0 = Nyquist
+
+    /**
+     * @brief Default constructor that disables the spectral stage
+     */
+    SpectralSpec() = default;
+
+    /**
+     * @brief Constructs a specification of a spectral stage
+     *
+     * @param feature Feature passed to or from the model
+     * @param fft_size Samples per frame, a power of two
+     * @param hop_size Samples between the starts of consecutive frames
+     * @param num_mels Mel bands of LOG_MEL_SPECTRUM features
+     * @param min_frequency Lower edge of the lowest mel band in Hz
+     * @param max_frequency Upper edge of the highest mel band in Hz, 0 = Nyquist
+     */
+    SpectralSpec(SpectralFeature feature,
+                 size_t fft_size,
+                 size_t hop_size,
+                 size_t num_mels = 0,
+                 float min_frequency = 0.f,
+                 float max_frequency = 0.f)
+        : m_feature(feature)
+        , m_fft_size(fft_size)
+        , m_hop_size(hop_size)
+        , m_num_mels(num_mels)
+        , m_min_frequency(min_frequency)
+        , m_max_frequency(max_frequency) {}
+
+    /**
+     * @brief Checks whether the spectral stage is used
+     */
+    bool is_enabled() const { return m_feature != NO_SPECTRAL_FEATURE; }
+
+    /**
+     * @brief Gets the number of frequency bins of a frame
+     */
+    size_t get_num_bins() const { return m_fft_size / 2 + 1; }
+
+    /**
+     * @brief Gets the number of values of one frame of one channel in the model tensor
+     */
+    size_t get_frame_size() const {
+        switch (m_feature) {
+            case COMPLEX_SPECTRUM:
+                return 2 * get_num_bins();
+            case MAGNITUDE_SPECTRUM:
+                return get_num_bins();
+            case LOG_MEL_SPECTRUM:
+                return m_num_mels;
+            case NO_SPECTRAL_FEATURE:
+            default:
+                return 0;
+        }
+    }
+
+    /**
+     * @brief Gets the number of past samples every frame overlaps with the previous hop
+     */
+    size_t get_overlap() const { return m_fft_size > m_hop_size ? m_fft_size - m_hop_size : 0; }
+
+    /**
+     * @brief Equality comparison operator
+     *
+     * @param other The SpectralSpec instance to compare with
+     * @return true if all members are equal, false otherwise
+     */
+    bool operator==(const SpectralSpec& other) const {
+        return m_feature == other.m_feature && m_fft_size == other.m_fft_size &&
+               m_hop_size == other.m_hop_size && m_num_mels == other.m_num_mels &&
+               m_min_frequency == other.m_min_frequency &&
+               m_max_frequency == other.m_max_frequency;
+    }
+
+    /**
+     * @brief Inequality comparison operator
+     *
+     * @param other The SpectralSpec instance to compare with
+     * @return true if any members are not equal, false otherwise
+     */
+    bool operator!=(const SpectralSpec& other) const { return !(*this == other); }
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_SPECTRALSPEC_H
@@ -0,0 +1,154 @@
+#ifndef ANIRA_SPECTRALTRANSFORM_H
+#define ANIRA_SPECTRALTRANSFORM_H
+
+#include <cstddef>
+#include <vector>
+
+#include "../system/AniraWinExports.h"
+#include "FFT.h"
+#include "SpectralSpec.h"
+
+namespace anira {
+
+/**
+ * @brief Streaming short-time Fourier transform between the samples and the features of a tensor
+ *
+ * Converts the samples one inference receives or delivers for a tensor into the frames described
+ * by a SpectralSpec. Every inference covers get_num_frames() frames that start m_hop_size samples
+ * apart, so its signal spans (get_num_frames() - 1) * m_hop_size + m_fft_size samples per channel:
+ * the get_num_frames() * m_hop_size new samples of the inference and the get_overlap() samples the
+ * first frame shares with the previous inference.
+ *
+ * - analyze() windows every frame of an input signal with a periodic Hann window and computes its
+ *   complex spectrum, magnitude spectrum or log-mel spectrum.
+ * - synthesize() transforms the complex spectra of an output tensor back and overlap-adds the
+ *   frames weighted by a synthesis window that makes the analysis followed by the synthesis an
+ *   identity for hops of at most m_fft_size / 2.
+ * - overlap_add() completes the output signal with the overlapping tail of the previous inference
+ *   in the order of the inferences. The completed samples are delayed by get_overlap() samples.
+ *
+ * SessionElement runs analyze() and synthesize() on the inference threads and overlap_add() on the
+ * thread that post-processes the session.
+ *
+ * @note prepare() allocates, all other methods are real-time safe.
+ * @see SpectralSpec, FFT, ProcessingSpec
+ */
+class ANIRA_API SpectralTransform {
+public:
+    /**
+     * @brief Default constructor that creates a disabled transform
+     */
+    SpectralTransform() = default;
+
+    /**
+     * @brief Calculates the windows, the mel filters and the FFT tables of a tensor
+     *
+     * @param spec Spectral stage of the tensor, disables the transform if it is not enabled
+     * @param num_channels Number of channels of the tensor
+     * @param num_samples New samples per inference, a multiple of the hop size
+     * @param sample_rate Sample rate of the tensor in Hz, used by the mel filters
+     */
+    void prepare(const SpectralSpec& spec,
+                 size_t num_channels,
+                 size_t num_samples,
+                 float sample_rate);
+
+    /**
+     * @brief Checks whether the transform is prepared with an enabled spectral stage
+     */
+    bool is_enabled() const;
+
+    /**
+     * @brief Gets the specification the transform is prepared with
+     */
+    const SpectralSpec& get_spec() const;
+
+    /**
+     * @brief Gets the number of frames per channel and inference
+     */
+    size_t get_num_frames() const;
+
+    /**
+     * @brief Gets the number of samples each frame shares with the previous hop
+     */
+    size_t get_overlap() const;
+
+    /**
+     * @brief Gets the number of samples of the signal of all channels of one inference
+     */
+    size_t get_signal_size() const;
+
+    /**
+     * @brief Gets the number of values of the features of all channels of one inference
+     */
+    size_t get_feature_size() const;
+
+    /**
+     * @brief Gets the number of floats of the work buffer passed to analyze() and synthesize()
+     */
+    size_t get_work_size() const;
+
+    /**
+     * @brief Gets the number of floats of the tail passed to overlap_add()
+     */
+    size_t get_tail_size() const;
+
+    /**
+     * @brief Computes the features of the frames of a signal
+     *
+     * @param signal The get_signal_size() samples, channel after channel
+     * @param features Receives the get_feature_size() values, channel after channel
+     * @param work Scratch memory of get_work_size() floats
+     */
+    void analyze(const float* signal, float* features, float* work) const;
+
+    /**
+     * @brief Overlap-adds the frames of complex spectra into a signal
+     *
+     * @param features The get_feature_size() values of the complex spectra, channel after channel
+     * @param signal Receives the get_signal_size() samples, channel after channel
+     * @param work Scratch memory of get_work_size() floats
+     */
+    void synthesize(const float* features, float* signal, float* work) const;
+
+    /**
+     * @brief Completes a synthesized signal with the tail of the previous inference
+     *
+     * Adds the tail to the first get_overlap() samples of every channel, keeps the samples beyond
+     * the new samples as tail of the next inference and packs the completed new samples of all
+     * channels to the front of the signal, the layout the post-processing reads.
+     *
+     * @param signal Signal written by synthesize(), overwritten
+     * @param tail The get_tail_size() pending samples, updated
+     */
+    void overlap_add(float* signal, float* tail) const;
+
+    /**
+     * @brief Gets the bytes held by the windows, the mel filters and the FFT tables
+     */
+    size_t get_memory_size() const;
+
+private:
+    /**
+     * @brief Designs the triangular filters of the mel bands on the frequency bins
+     *
+     * @param sample_rate Sample rate of the tensor in Hz
+     */
+    void prepare_mel_filters(float sample_rate);
+
+    SpectralSpec m_spec;       ///< Specification the transform is prepared with
+    size_t m_num_channels = 0;  ///< Channels of the tensor
+    size_t m_num_frames = 0;    ///< Frames per channel and inference
+    size_t m_span = 0;          ///< Samples per channel and inference
+    FFT m_fft;                  ///< Transform of one frame
+    std::vector<float> m_window;            ///< Periodic Hann analysis window
+    std::vector<float> m_synthesis_window;  ///< Window normalizing the overlap-add of the frames
+    std::vector<size_t> m_mel_first_bin;    ///< First bin weighted by every mel filter
+    std::vector<size_t> m_mel_offset;       ///< Offset of the weights of every mel filter, one more
+                                            ///< than mel filters
+    std::vector<float> m_mel_weights;       ///< Nonzero weights of all mel filters
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_SPECTRALTRANSFORM_H
@@ -0,0 +1,35 @@
+#ifndef ANIRA_TENSORLAYOUT_H
+#define ANIRA_TENSORLAYOUT_H
+
+namespace anira {
+
+/**
+ * @brief Enumeration of the memory layouts of multichannel tensors
+ *
+ * The pre- and post-processing of anira always works on planar tensors, i.e. the samples of one
+ * channel are contiguous (channels-first, NCHW style). Backends whose models expect the channels
+ * as the innermost dimension (channels-last, NHWC style, e.g. many TensorFlow Lite models) declare
+ * CHANNELS_LAST in their TensorShape, and anira transposes the tensors before and after the
+ * inference.
+ *
+ * @see TensorShape, LayoutTransform
+ */
+enum TensorLayout {
+    /**
+     * @brief Planar layout, shape [..., channels, samples]
+     *
+     * The layout the pre- and post-processing works on, tensors are passed to the backend as is.
+     */
+    CHANNELS_FIRST,
+    /**
+     * @brief Interleaved layout, shape [..., samples, channels]
+     *
+     * Every block of the last two dimensions of a tensor is transposed from and to the planar
+     * layout around the inference.
+     */
+    CHANNELS_LAST
+};
+
+}  // namespace anira
+
+#endif  // ANIRA_TENSORLAYOUT_H
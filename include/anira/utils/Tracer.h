@@ -0,0 +1,154 @@
+#ifndef ANIRA_TRACER_H
+#define ANIRA_TRACER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "../system/AniraWinExports.h"
+#include "RealtimeSanitizer.h"
+
+namespace anira {
+
+/**
+ * @brief Single timed event of the scheduler trace
+ */
+struct TraceEvent {
+    const char* m_name = nullptr;  ///< Static event name, must outlive the tracer
+    uint64_t m_begin_ns = 0;       ///< Start time in ns since the tracer was started
+    uint64_t m_end_ns = 0;         ///< End time in ns, equal to m_begin_ns for instant events
+    int m_session_id = -1;         ///< Session the event belongs to
+    uint32_t m_thread_id = 0;      ///< Tracer-assigned id of the recording thread
+    long m_sequence = -1;          ///< Sequence number of the ThreadSafeStruct (-1 if none)
+};
+
+/**
+ * @brief Optional tracer that exports scheduler events as Chrome trace JSON
+ *
+ * When anira is built with ANIRA_WITH_TRACING=ON, the audio callback, pre-processing, queue
+ * dequeue, backend inference and post-processing are recorded as timed events tagged with the
+ * session id and the sequence number of the ThreadSafeStruct they operate on.
+ *
+ * Every thread that records events claims one of k_max_threads preallocated single-producer
+ * buffers on its first event, so recording is lock-free and does not allocate. A background
+ * thread drains the buffers periodically and streams the events into a JSON file in the Chrome
+ * trace event format, which can be opened in Perfetto (ui.perfetto.dev) or chrome://tracing.
+ * Events are dropped when a buffer is full or while more than k_max_threads threads record
+ * events. Threads without a buffer claim one as soon as another thread exits.
+ *
+ * Without ANIRA_WITH_TRACING the ANIRA_TRACE_* macros compile to nothing and start() fails.
+ *
+ * @code
+ * anira::Tracer::start("anira_trace.json");
+ * // ... process audio ...
+ * anira::Tracer::stop();
+ * @endcode
+ */
+class ANIRA_API Tracer {
+public:
+    static constexpr size_t k_max_threads = 32;        ///< Number of per-thread event buffers
+    static constexpr size_t k_buffer_capacity = 8192;  ///< Events per thread buffer
+    static constexpr std::chrono::milliseconds k_flush_interval{10};  ///< Background flush period
+
+    /**
+     * @brief Starts recording events and streaming them to a file
+     *
+     * @param file_path Path of the Chrome trace JSON file to write
+     * @return True if tracing was started, false if it is not compiled in, already running or
+     *         the file could not be opened
+     */
+    static bool start(const std::string& file_path);
+
+    /**
+     * @brief Stops recording, flushes all pending events and closes the file
+     */
+    static void stop();
+
+    /**
+     * @brief Checks whether events are currently recorded
+     *
+     * @return True between start() and stop()
+     */
+    static bool is_running() ANIRA_REALTIME;
+
+    /**
+     * @brief Gets the current time on the tracer's clock
+     *
+     * @return Time in ns since the tracer was started
+     */
+    static uint64_t now() ANIRA_REALTIME;
+
+    /**
+     * @brief Records a complete event spanning a time range
+     *
+     * @param name Static event name
+     * @param begin_ns Start time obtained from now()
+     * @param session_id Session the event belongs to
+     * @param sequence Sequence number of the processed struct, or -1
+     */
+    static void record(const char* name, uint64_t begin_ns, int session_id, long sequence)
+        ANIRA_REALTIME;
+
+    /**
+     * @brief Records an instant event at the current time
+     *
+     * @param name Static event name
+     * @param session_id Session the event belongs to
+     * @param sequence Sequence number of the processed struct, or -1
+     */
+    static void record_instant(const char* name, int session_id, long sequence) ANIRA_REALTIME;
+
+    /**
+     * @brief Gets the number of events that were dropped since start()
+     *
+     * @return Number of dropped events
+     */
+    static uint64_t get_dropped_events();
+
+private:
+    static void flush();
+    static void flush_loop();
+};
+
+/**
+ * @brief RAII helper recording a complete event for the enclosing scope
+ */
+class TraceScope {
+public:
+    TraceScope(const char* name, int session_id, long sequence) ANIRA_REALTIME
+        : m_name(name)
+        , m_session_id(session_id)
+        , m_sequence(sequence)
+        , m_begin_ns(Tracer::is_running() ? Tracer::now() : 0) {}
+
+    ~TraceScope() ANIRA_REALTIME {
+        if (Tracer::is_running()) { Tracer::record(m_name, m_begin_ns, m_session_id, m_sequence); }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* m_name;
+    int m_session_id;
+    long m_sequence;
+    uint64_t m_begin_ns;
+};
+
+}  // namespace anira
+
+#define ANIRA_TRACE_CONCAT_IMPL(a, b) a##b
+#define ANIRA_TRACE_CONCAT(a, b) ANIRA_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef ENABLE_TRACING
+#define ANIRA_TRACE_SCOPE(name, session_id, sequence) \
+    anira::TraceScope const ANIRA_TRACE_CONCAT(anira_trace_scope_, __LINE__)(name, session_id, sequence)
+#define ANIRA_TRACE_INSTANT(name, session_id, sequence) \
+    anira::Tracer::record_instant(name, session_id, sequence)
+#else
+#define ANIRA_TRACE_SCOPE(name, session_id, sequence)
+#define ANIRA_TRACE_INSTANT(name, session_id, sequence)
+#endif
+
+#endif  // ANIRA_TRACER_H
@@ -1,6 +1,9 @@
 #include <anira/InferenceConfig.h>
 #include <anira/utils/InferenceBackend.h>
 #include <anira/utils/Logger.h>
+#include <anira/utils/ResamplerQuality.h>
+#include <anira/utils/SpectralSpec.h>
+#include <anira/utils/TensorLayout.h>
 
 #include <cassert>
 #include <cstdlib>
@@ -12,6 +15,55 @@
 
 namespace anira {
 
+namespace {
+
+void validate_spectral_spec(const SpectralSpec& spec,
+                            size_t index,
+                            bool input,
+                            size_t num_channels,
+                            size_t num_samples,
+                            size_t tensor_size) {
+    if (!spec.is_enabled()) { return; }
+    char const* tensor = input ? "input" : "output";
+    if (spec.m_fft_size < 4 || (spec.m_fft_size & (spec.m_fft_size - 1)) != 0) {
+        LOG_ERROR << "The FFT size " << spec.m_fft_size << " of " << tensor << " tensor " << index
+                  << " is not a power of two of at least 4." << '\n';
+        throw std::invalid_argument("Invalid FFT size of spectral stage.");
+    }
+    // Larger hops of output tensors leave samples no frame reconstructs
+    size_t const max_hop_size = input ? spec.m_fft_size : spec.m_fft_size / 2;
+    if (spec.m_hop_size == 0 || spec.m_hop_size > max_hop_size) {
+        LOG_ERROR << "The hop size " << spec.m_hop_size << " of " << tensor << " tensor " << index
+                  << " must be between 1 and " << max_hop_size << "." << '\n';
+        throw std::invalid_argument("Invalid hop size of spectral stage.");
+    }
+    if (num_samples == 0 || num_samples % spec.m_hop_size != 0) {
+        LOG_ERROR << "The spectral stage of " << tensor << " tensor " << index
+                  << " requires a streamable tensor whose size is a multiple of the hop size."
+                  << '\n';
+        throw std::invalid_argument("Invalid size of tensor with spectral stage.");
+    }
+    if (!input && spec.m_feature != COMPLEX_SPECTRUM) {
+        LOG_ERROR << "Output tensor " << index
+                  << " can only be synthesized from complex spectra." << '\n';
+        throw std::invalid_argument("Invalid feature of output spectral stage.");
+    }
+    if (spec.m_feature == LOG_MEL_SPECTRUM && spec.m_num_mels == 0) {
+        LOG_ERROR << "The log-mel spectrum of input tensor " << index << " has no mel bands."
+                  << '\n';
+        throw std::invalid_argument("Invalid number of mel bands.");
+    }
+    size_t const feature_size = num_channels * (num_samples / spec.m_hop_size) *
+                                spec.get_frame_size();
+    if (feature_size != tensor_size) {
+        LOG_ERROR << "The spectral stage of " << tensor << " tensor " << index << " produces "
+                  << feature_size << " values, but the tensor has " << tensor_size << "." << '\n';
+        throw std::invalid_argument("Tensor size mismatch of spectral stage.");
+    }
+}
+
+}  // namespace
+
 InferenceConfig::InferenceConfig(std::vector<ModelData> model_data,
                                  std::vector<TensorShape> tensor_shape,
                                  ProcessingSpec processing_spec,
@@ -100,6 +152,10 @@ const TensorShapeList& InferenceConfig::get_tensor_output_shape(InferenceBackend
     return get_tensor_shape(backend).m_tensor_output_shape;
 }
 
+TensorLayout InferenceConfig::get_tensor_layout(InferenceBackend backend) const {
+    return get_tensor_shape(backend).m_layout;
+}
+
 const std::vector<size_t>& InferenceConfig::get_tensor_input_size() const {
     return m_processing_spec.m_tensor_input_size;
 }
@@ -128,6 +184,22 @@ const std::vector<size_t>& InferenceConfig::get_internal_model_latency() const {
     return m_processing_spec.m_internal_model_latency;
 }
 
+float InferenceConfig::get_model_sample_rate() const {
+    return m_processing_spec.m_model_sample_rate;
+}
+
+ResamplerQuality InferenceConfig::get_resampler_quality() const {
+    return m_processing_spec.m_resampler_quality;
+}
+
+const std::vector<SpectralSpec>& InferenceConfig::get_input_spectral_spec() const {
+    return m_processing_spec.m_input_spectral_spec;
+}
+
+const std::vector<SpectralSpec>& InferenceConfig::get_output_spectral_spec() const {
+    return m_processing_spec.m_output_spectral_spec;
+}
+
 void InferenceConfig::set_tensor_input_shape(const TensorShapeList& input_shape) {
     for (TensorShape& shape : m_tensor_shape) {
         shape.m_tensor_input_shape = input_shape;
@@ -195,6 +267,28 @@ void InferenceConfig::set_internal_model_latency(
     return;
 }
 
+void InferenceConfig::set_model_sample_rate(float model_sample_rate) {
+    m_processing_spec.m_model_sample_rate = model_sample_rate;
+    return;
+}
+
+void InferenceConfig::set_resampler_quality(ResamplerQuality quality) {
+    m_processing_spec.m_resampler_quality = quality;
+    return;
+}
+
+void InferenceConfig::set_input_spectral_spec(
+    const std::vector<SpectralSpec>& input_spectral_spec) {
+    m_processing_spec.m_input_spectral_spec = input_spectral_spec;
+    return;
+}
+
+void InferenceConfig::set_output_spectral_spec(
+    const std::vector<SpectralSpec>& output_spectral_spec) {
+    m_processing_spec.m_output_spectral_spec = output_spectral_spec;
+    return;
+}
+
 void InferenceConfig::set_model_path(const std::string& model_path, InferenceBackend backend) {
     for (auto& i : m_model_data) {
         if (i.m_backend == backend) {
@@ -212,7 +306,7 @@ void InferenceConfig::set_model_path(const std::string& model_path, InferenceBac
 
 const TensorShape& InferenceConfig::get_tensor_shape(InferenceBackend backend) const {
     for (const TensorShape& shape : m_tensor_shape) {
-        if (shape.m_backend == backend) { return shape; }
+        if (!shape.is_universal() && shape.m_backend == backend) { return shape; }
     }
     for (const TensorShape& shape : m_tensor_shape) {
         if (shape.is_universal()) { return shape; }
@@ -228,6 +322,8 @@ void InferenceConfig::clear_processing_spec() {
     m_processing_spec.m_preprocess_input_size.clear();
     m_processing_spec.m_postprocess_output_size.clear();
     m_processing_spec.m_internal_model_latency.clear();
+    m_processing_spec.m_input_spectral_spec.clear();
+    m_processing_spec.m_output_spectral_spec.clear();
     m_processing_spec.m_tensor_input_size.clear();
     m_processing_spec.m_tensor_output_size.clear();
 }
@@ -348,6 +444,13 @@ void InferenceConfig::update_processing_spec() {
                                                                               // specified
                 }
             }
+            if (m_processing_spec.m_input_spectral_spec.size() != input_size.size()) {
+                m_processing_spec.m_input_spectral_spec.assign(input_size.size(), SpectralSpec());
+            }
+            if (m_processing_spec.m_output_spectral_spec.size() != output_size.size()) {
+                m_processing_spec.m_output_spectral_spec.assign(output_size.size(),
+                                                                SpectralSpec());
+            }
         } else {
             if (m_processing_spec.m_tensor_input_size != input_size) {
                 LOG_ERROR << "Input size mismatch for backend: "
@@ -395,6 +498,22 @@ void InferenceConfig::update_processing_spec() {
                   << '\n';
         throw std::invalid_argument("Internal latency size mismatch.");
     }
+    for (size_t i = 0; i < m_processing_spec.m_tensor_input_size.size(); ++i) {
+        validate_spectral_spec(m_processing_spec.m_input_spectral_spec[i],
+                               i,
+                               true,
+                               m_processing_spec.m_preprocess_input_channels[i],
+                               m_processing_spec.m_preprocess_input_size[i],
+                               m_processing_spec.m_tensor_input_size[i]);
+    }
+    for (size_t i = 0; i < m_processing_spec.m_tensor_output_size.size(); ++i) {
+        validate_spectral_spec(m_processing_spec.m_output_spectral_spec[i],
+                               i,
+                               false,
+                               m_processing_spec.m_postprocess_output_channels[i],
+                               m_processing_spec.m_postprocess_output_size[i],
+                               m_processing_spec.m_tensor_output_size[i]);
+    }
     for (size_t i = 0; i < m_processing_spec.m_tensor_input_size.size(); ++i) {
         if (m_processing_spec.m_preprocess_input_size[i] == 0) {
             if (m_processing_spec.m_preprocess_input_channels[i] != 1) {
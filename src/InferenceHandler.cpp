@@ -5,6 +5,8 @@
 #include <anira/backends/BackendBase.h>
 #include <anira/utils/HostConfig.h>
 #include <anira/utils/InferenceBackend.h>
+#include <anira/utils/InferenceTimeCalibration.h>
+#include <anira/utils/MemoryLock.h>
 
 #include <cassert>
 #include <chrono>
@@ -204,6 +206,37 @@ size_t* InferenceHandler::pop_data(float* const* const* output_data,
     return m_inference_manager.pop_data(output_data, num_output_samples, wait_until);
 }
 
+size_t InferenceHandler::render(const float* const* input_data,
+                                size_t num_input_samples,
+                                float* const* output_data,
+                                size_t num_output_samples,
+                                size_t tensor_index) {
+    if (tensor_index < m_num_input_tensors) {
+        m_input_tensor_ptrs[tensor_index] = input_data;
+        m_input_tensor_num_samples[tensor_index] = num_input_samples;
+    }
+    if (tensor_index < m_num_output_tensors) {
+        m_output_tensor_ptrs[tensor_index] = output_data;
+        m_output_tensor_num_samples[tensor_index] = num_output_samples;
+    }
+
+    size_t* rendered_samples = m_inference_manager.render(m_input_tensor_ptrs,
+                                                          m_input_tensor_num_samples,
+                                                          m_output_tensor_ptrs,
+                                                          m_output_tensor_num_samples);
+    return rendered_samples[tensor_index];
+}
+
+size_t* InferenceHandler::render(const float* const* const* input_data,
+                                 size_t* num_input_samples,
+                                 float* const* const* output_data,
+                                 size_t* num_output_samples) {
+    return m_inference_manager.render(input_data,
+                                      num_input_samples,
+                                      output_data,
+                                      num_output_samples);
+}
+
 void InferenceHandler::set_inference_backend(InferenceBackend inference_backend) {
     m_inference_manager.set_backend(inference_backend);
 }
@@ -212,6 +245,26 @@ InferenceBackend InferenceHandler::get_inference_backend() {
     return m_inference_manager.get_backend();
 }
 
+void InferenceHandler::set_inference_time_calibration(const InferenceTimeCalibration& calibration) {
+    m_inference_manager.set_inference_time_calibration(calibration);
+}
+
+float InferenceHandler::get_max_inference_time() const {
+    return m_inference_manager.get_max_inference_time();
+}
+
+void InferenceHandler::set_arena_enabled(bool enabled) {
+    m_inference_manager.set_arena_enabled(enabled);
+}
+
+void InferenceHandler::set_memoization_cache_size(size_t num_entries) {
+    m_inference_manager.set_memoization_cache_size(num_entries);
+}
+
+MemoryLockStatus InferenceHandler::get_memory_lock_status() const {
+    return m_inference_manager.get_memory_lock_status();
+}
+
 unsigned int InferenceHandler::get_latency(size_t tensor_index) const {
     return m_inference_manager.get_latency()[tensor_index];
 }
@@ -220,6 +273,18 @@ std::vector<unsigned int> InferenceHandler::get_latency_vector() const {
     return m_inference_manager.get_latency();
 }
 
+InferenceStatistics InferenceHandler::get_statistics() const {
+    return m_inference_manager.get_statistics();
+}
+
+void InferenceHandler::reset_statistics() {
+    m_inference_manager.reset_statistics();
+}
+
+MemoryFootprint InferenceHandler::get_memory_footprint() const {
+    return m_inference_manager.get_memory_footprint();
+}
+
 size_t InferenceHandler::get_available_samples(size_t tensor_index, size_t channel) const {
     return m_inference_manager.get_available_samples(tensor_index, channel);
 }
@@ -6,20 +6,19 @@
 
 #include <cassert>
 #include <cstddef>
-#include <utility>
 #include <vector>
 
 namespace anira {
 
 PrePostProcessor::PrePostProcessor(InferenceConfig& inference_config)
-    : m_inference_config(inference_config) {
-    m_inputs.resize(m_inference_config.get_tensor_input_shape().size());
+    : m_inference_config(inference_config),
+      m_inputs(inference_config.get_tensor_input_shape().size()),
+      m_outputs(inference_config.get_tensor_output_shape().size()) {
     for (size_t i = 0; i < m_inference_config.get_tensor_input_shape().size(); ++i) {
         if (m_inference_config.get_preprocess_input_size()[i] <= 0) {
             m_inputs[i].resize(m_inference_config.get_tensor_input_size()[i]);
         }
     }
-    m_outputs.resize(m_inference_config.get_tensor_output_shape().size());
     for (size_t i = 0; i < m_inference_config.get_tensor_output_shape().size(); ++i) {
         if (m_inference_config.get_postprocess_output_size()[i] <= 0) {
             m_outputs[i].resize(m_inference_config.get_tensor_output_size()[i]);
@@ -33,20 +32,21 @@ void PrePostProcessor::pre_process(std::vector<RingBuffer>& input,
     for (size_t tensor_index = 0; tensor_index < m_inference_config.get_tensor_input_shape().size();
          tensor_index++) {
         if (m_inference_config.get_preprocess_input_size()[tensor_index] > 0) {
+            // The first frame of a spectral tensor overlaps with the previous inference
+            size_t const num_old_samples =
+                tensor_index < m_inference_config.get_input_spectral_spec().size()
+                    ? m_inference_config.get_input_spectral_spec()[tensor_index].get_overlap()
+                    : 0;
             pop_samples_from_buffer(input[tensor_index],
                                     output[tensor_index],
-                                    m_inference_config.get_preprocess_input_size()[tensor_index]);
+                                    m_inference_config.get_preprocess_input_size()[tensor_index],
+                                    num_old_samples);
         } else {
-            for (size_t sample = 0;
-                 sample < m_inference_config.get_tensor_input_size()[tensor_index];
-                 sample++) {
-                output[tensor_index].set_sample(0,
-                                                sample,
-                                                get_input(tensor_index, sample));  // Non-streamble
-                                                                                   // tensors have
-                                                                                   // no channel
-                                                                                   // count
-            }
+            // Non-streamable tensors have no channel count. A torn snapshot is used as well,
+            // waiting for a preempted writer is not real-time safe.
+            get_input_tensor(output[tensor_index].get_write_pointer(0),
+                             tensor_index,
+                             m_inference_config.get_tensor_input_size()[tensor_index]);
         }
     }
 }
@@ -62,13 +62,10 @@ void PrePostProcessor::post_process(std::vector<BufferF>& input,
                                    output[tensor_index],
                                    m_inference_config.get_postprocess_output_size()[tensor_index]);
         } else {
-            for (size_t sample = 0;
-                 sample < m_inference_config.get_tensor_output_size()[tensor_index];
-                 sample++) {
-                set_output(input[tensor_index].get_sample(0, sample),
-                           tensor_index,
-                           sample);  // Non-streamble tensors have no channel count
-            }
+            // Non-streamable tensors have no channel count
+            set_output_tensor(input[tensor_index].get_read_pointer(0),
+                              tensor_index,
+                              m_inference_config.get_tensor_output_size()[tensor_index]);
         }
     }
 }
@@ -76,12 +73,9 @@ void PrePostProcessor::post_process(std::vector<BufferF>& input,
 void PrePostProcessor::pop_samples_from_buffer(RingBuffer& input,
                                                BufferF& output,
                                                size_t num_samples) {
+    // The output buffer is always a single channel buffer
     for (size_t i = 0; i < input.get_num_channels(); i++) {
-        for (size_t j = 0; j < num_samples; j++) {
-            output.set_sample(0, j + (i * num_samples), input.pop_sample(i));  // The output buffer
-                                                                               // is always a single
-                                                                               // channel buffer
-        }
+        input.pop_window(i, output.get_write_pointer(0) + i * num_samples, num_samples, 0);
     }
 }
 
@@ -97,20 +91,28 @@ void PrePostProcessor::pop_samples_from_buffer(RingBuffer& input,
                                                size_t num_new_samples,
                                                size_t num_old_samples,
                                                size_t offset) {
-    int const num_total_samples = static_cast<int>(num_new_samples + num_old_samples);
+    size_t const num_total_samples = num_new_samples + num_old_samples;
     for (size_t i = 0; i < input.get_num_channels(); i++) {
-        // int j is important to be signed, because it is used in the condition j >= 0
-        for (int j = num_total_samples - 1; j >= 0; j--) {
-            if (std::cmp_greater_equal(j, num_old_samples)) {
-                output.set_sample(0,
-                                  (size_t)(num_total_samples - j + num_old_samples - 1) + offset,
-                                  input.pop_sample(i));
-            } else {
-                output.set_sample(0,
-                                  (size_t)j + offset,
-                                  input.get_past_sample(i, num_total_samples - (size_t)j));
-            }
-        }
+        input.pop_window(i,
+                         output.get_write_pointer(0) + offset + i * num_total_samples,
+                         num_new_samples,
+                         num_old_samples);
+    }
+}
+
+void PrePostProcessor::pop_windows_from_buffer(RingBuffer& input,
+                                               BufferF& output,
+                                               size_t num_windows,
+                                               size_t window_size,
+                                               size_t hop_size) {
+    size_t const num_channels = input.get_num_channels();
+    for (size_t i = 0; i < num_channels; i++) {
+        input.pop_windows(i,
+                          output.get_write_pointer(0) + i * window_size,
+                          num_windows,
+                          window_size,
+                          hop_size,
+                          num_channels * window_size);
     }
 }
 
@@ -129,7 +131,19 @@ void PrePostProcessor::set_input(const float& input, size_t i, size_t j) {
     assert(("Index j out of bounds" && j < m_inputs[i].size()));
     // assert(("Index is streamable, data should be passed via the process method." &&
     // this->m_inference_config.get_preprocess_input_size()[i] > 0)); TODO: Why does this not work?
-    m_inputs[i][j].store(input);
+    m_inputs[i].set(j, input);
+}
+
+void PrePostProcessor::set_input_tensor(const float* input, size_t i, size_t num_samples) {
+    assert(("Index i out of bounds" && i < m_inputs.size()));
+    assert(("Too many samples" && num_samples <= m_inputs[i].size()));
+    m_inputs[i].write(input, num_samples);
+}
+
+bool PrePostProcessor::try_set_input_tensor(const float* input, size_t i, size_t num_samples) {
+    assert(("Index i out of bounds" && i < m_inputs.size()));
+    assert(("Too many samples" && num_samples <= m_inputs[i].size()));
+    return m_inputs[i].try_write(input, num_samples);
 }
 
 void PrePostProcessor::set_output(const float& output, size_t i, size_t j) {
@@ -137,7 +151,13 @@ void PrePostProcessor::set_output(const float& output, size_t i, size_t j) {
     assert(("Index j out of bounds" && j < m_outputs[i].size()));
     // assert(("Index is streamable, data should be passed via the process method." &&
     // m_inference_config.get_postprocess_output_size()[i] > 0));
-    m_outputs[i][j].store(output);
+    m_outputs[i].set(j, output);
+}
+
+void PrePostProcessor::set_output_tensor(const float* output, size_t i, size_t num_samples) {
+    assert(("Index i out of bounds" && i < m_outputs.size()));
+    assert(("Too many samples" && num_samples <= m_outputs[i].size()));
+    m_outputs[i].write(output, num_samples);
 }
 
 float PrePostProcessor::get_input(size_t i, size_t j) {
@@ -145,7 +165,13 @@ float PrePostProcessor::get_input(size_t i, size_t j) {
     assert(("Index j out of bounds" && j < m_inputs[i].size()));
     // assert(("Index is streamable, data should be retrieved via the process method." &&
     // m_inference_config.get_preprocess_input_size()[i] > 0));
-    return m_inputs[i][j].load();
+    return m_inputs[i].get(j);
+}
+
+bool PrePostProcessor::get_input_tensor(float* input, size_t i, size_t num_samples) {
+    assert(("Index i out of bounds" && i < m_inputs.size()));
+    assert(("Too many samples" && num_samples <= m_inputs[i].size()));
+    return m_inputs[i].read(input, num_samples);
 }
 
 float PrePostProcessor::get_output(size_t i, size_t j) {
@@ -153,7 +179,13 @@ float PrePostProcessor::get_output(size_t i, size_t j) {
     assert(("Index j out of bounds" && j < m_outputs[i].size()));
     // assert(("Index is streamable, data should be retrieved via the process method." &&
     // m_inference_config.get_postprocess_output_size()[i] > 0));
-    return m_outputs[i][j].load();
+    return m_outputs[i].get(j);
+}
+
+bool PrePostProcessor::get_output_tensor(float* output, size_t i, size_t num_samples) {
+    assert(("Index i out of bounds" && i < m_outputs.size()));
+    assert(("Too many samples" && num_samples <= m_outputs[i].size()));
+    return m_outputs[i].read(output, num_samples);
 }
 
 }  // namespace anira
\ No newline at end of file
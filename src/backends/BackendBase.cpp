@@ -1,9 +1,15 @@
 #include <anira/InferenceConfig.h>
 #include <anira/backends/BackendBase.h>
+#include <anira/scheduler/MemoryFootprint.h>
 #include <anira/utils/Buffer.h>
+#include <anira/utils/InferenceBackend.h>
+#include <anira/utils/MemoryLock.h>
 
 #include <cstddef>
+#include <filesystem>
 #include <memory>
+#include <string>
+#include <system_error>
 #include <vector>
 
 namespace anira {
@@ -37,4 +43,50 @@ void BackendBase::process(std::vector<BufferF>& input,
     }
 }
 
-}  // namespace anira
\ No newline at end of file
+BackendMemoryFootprint BackendBase::get_memory_footprint() const {
+    return {};
+}
+
+MemoryLockStatus BackendBase::lock_memory() {
+    return {};
+}
+
+BackendMemoryFootprint BackendBase::estimate_memory_footprint(InferenceBackend backend,
+                                                              size_t num_instances) const {
+    size_t tensor_samples = 0;
+    for (size_t const size : m_inference_config.get_tensor_input_size()) { tensor_samples += size; }
+    for (size_t const size : m_inference_config.get_tensor_output_size()) {
+        tensor_samples += size;
+    }
+
+    return BackendMemoryFootprint{
+        .m_backend = backend,
+        .m_num_instances = num_instances,
+        .m_tensor_bytes = num_instances * tensor_samples * sizeof(float),
+        .m_model_bytes = num_instances * get_serialized_model_size(backend),
+    };
+}
+
+size_t BackendBase::get_serialized_model_size(InferenceBackend backend) const {
+    for (const auto& model_data : m_inference_config.m_model_data) {
+        if (model_data.m_backend != backend) { continue; }
+        if (model_data.m_is_binary) { return model_data.m_size; }
+        std::error_code error;
+        auto const file_size = std::filesystem::file_size(
+            std::string(static_cast<const char*>(model_data.m_data), model_data.m_size),
+            error);
+        return error ? 0 : static_cast<size_t>(file_size);
+    }
+    return 0;
+}
+
+void BackendBase::lock_binary_model_data(InferenceBackend backend,
+                                         MemoryLockStatus& status) const {
+    for (const auto& model_data : m_inference_config.m_model_data) {
+        if (model_data.m_backend == backend && model_data.m_is_binary) {
+            MemoryLock::lock(model_data.m_data, model_data.m_size, status);
+        }
+    }
+}
+
+}  // namespace anira
@@ -1,10 +1,12 @@
 #include <anira/InferenceConfig.h>
 #include <anira/backends/BackendBase.h>
 #include <anira/backends/LibTorchProcessor.h>
+#include <anira/scheduler/MemoryFootprint.h>
 #include <anira/scheduler/SessionElement.h>
 #include <anira/utils/Buffer.h>
 #include <anira/utils/InferenceBackend.h>
 #include <anira/utils/Logger.h>
+#include <anira/utils/MemoryLock.h>
 #include <c10/util/Exception.h>
 #include <torch/csrc/autograd/generated/variable_factories.h>
 #include <torch/csrc/jit/serialization/import.h>
@@ -46,6 +48,36 @@ void LibtorchProcessor::process(std::vector<BufferF>& input,
     }
 }
 
+BackendMemoryFootprint LibtorchProcessor::get_memory_footprint() const {
+    BackendMemoryFootprint footprint =
+        estimate_memory_footprint(InferenceBackend::LIBTORCH, m_instances.size());
+    // TorchScript modules expose their weights, which is more accurate than the file size
+    size_t model_bytes = 0;
+    for (const auto& instance : m_instances) {
+        for (const auto& parameter : instance->m_module.parameters()) {
+            model_bytes += static_cast<size_t>(parameter.numel() * parameter.element_size());
+        }
+        for (const auto& buffer : instance->m_module.buffers()) {
+            model_bytes += static_cast<size_t>(buffer.numel() * buffer.element_size());
+        }
+    }
+    footprint.m_model_bytes = model_bytes;
+    return footprint;
+}
+
+MemoryLockStatus LibtorchProcessor::lock_memory() {
+    MemoryLockStatus status;
+    for (const auto& instance : m_instances) {
+        for (const auto& parameter : instance->m_module.parameters()) {
+            MemoryLock::lock(parameter.data_ptr(), parameter.nbytes(), status);
+        }
+        for (const auto& buffer : instance->m_module.buffers()) {
+            MemoryLock::lock(buffer.data_ptr(), buffer.nbytes(), status);
+        }
+    }
+    return status;
+}
+
 LibtorchProcessor::Instance::Instance(InferenceConfig& inference_config)
     : m_inference_config(inference_config) {
     m_tensor_options = torch::TensorOptions().requires_grad(false);
@@ -3,10 +3,12 @@
 #include <anira/InferenceConfig.h>
 #include <anira/backends/BackendBase.h>
 #include <anira/backends/LiteRtProcessor.h>
+#include <anira/scheduler/MemoryFootprint.h>
 #include <anira/scheduler/SessionElement.h>
 #include <anira/utils/Buffer.h>
 #include <anira/utils/InferenceBackend.h>
 #include <anira/utils/Logger.h>
+#include <anira/utils/MemoryLock.h>
 
 #include <algorithm>
 #include <cassert>
@@ -91,6 +93,16 @@ void LiteRtProcessor::process(std::vector<BufferF>& input,
     }
 }
 
+BackendMemoryFootprint LiteRtProcessor::get_memory_footprint() const {
+    return estimate_memory_footprint(InferenceBackend::LITERT, m_instances.size());
+}
+
+MemoryLockStatus LiteRtProcessor::lock_memory() {
+    MemoryLockStatus status;
+    lock_binary_model_data(InferenceBackend::LITERT, status);
+    return status;
+}
+
 LiteRtProcessor::Instance::Instance(InferenceConfig& inference_config)
     : m_inference_config(inference_config) {
     // Any litert_check below can throw; if it does mid-construction the destructor
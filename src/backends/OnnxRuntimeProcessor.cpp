@@ -1,10 +1,12 @@
 #include <anira/InferenceConfig.h>
 #include <anira/backends/BackendBase.h>
 #include <anira/backends/OnnxRuntimeProcessor.h>
+#include <anira/scheduler/MemoryFootprint.h>
 #include <anira/scheduler/SessionElement.h>
 #include <anira/utils/Buffer.h>
 #include <anira/utils/InferenceBackend.h>
 #include <anira/utils/Logger.h>
+#include <anira/utils/MemoryLock.h>
 #include <onnxruntime_c_api.h>
 #include <onnxruntime_cxx_api.h>
 
@@ -43,6 +45,21 @@ void OnnxRuntimeProcessor::process(std::vector<BufferF>& input,
     }
 }
 
+BackendMemoryFootprint OnnxRuntimeProcessor::get_memory_footprint() const {
+    return estimate_memory_footprint(InferenceBackend::ONNX, m_instances.size());
+}
+
+MemoryLockStatus OnnxRuntimeProcessor::lock_memory() {
+    MemoryLockStatus status;
+    lock_binary_model_data(InferenceBackend::ONNX, status);
+    for (const auto& instance : m_instances) {
+        for (auto& input_data : instance->m_input_data) {
+            MemoryLock::lock(input_data.data(), input_data.size() * sizeof(float), status);
+        }
+    }
+    return status;
+}
+
 OnnxRuntimeProcessor::Instance::Instance(InferenceConfig& inference_config)
     : m_memory_info(Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeCPU))
     , m_inference_config(inference_config)
@@ -3,9 +3,11 @@
 #include <anira/InferenceConfig.h>
 #include <anira/backends/BackendBase.h>
 #include <anira/backends/TFLiteProcessor.h>
+#include <anira/scheduler/MemoryFootprint.h>
 #include <anira/scheduler/SessionElement.h>
 #include <anira/utils/Buffer.h>
 #include <anira/utils/InferenceBackend.h>
+#include <anira/utils/MemoryLock.h>
 #include <tensorflow/lite/core/c/c_api.h>
 
 #include <cassert>
@@ -48,6 +50,24 @@ void TFLiteProcessor::process(std::vector<BufferF>& input,
     }
 }
 
+BackendMemoryFootprint TFLiteProcessor::get_memory_footprint() const {
+    return estimate_memory_footprint(InferenceBackend::TFLITE, m_instances.size());
+}
+
+MemoryLockStatus TFLiteProcessor::lock_memory() {
+    MemoryLockStatus status;
+    lock_binary_model_data(InferenceBackend::TFLITE, status);
+    for (const auto& instance : m_instances) {
+        for (auto* tensor : instance->m_inputs) {
+            MemoryLock::lock(TfLiteTensorData(tensor), TfLiteTensorByteSize(tensor), status);
+        }
+        for (const auto* tensor : instance->m_outputs) {
+            MemoryLock::lock(TfLiteTensorData(tensor), TfLiteTensorByteSize(tensor), status);
+        }
+    }
+    return status;
+}
+
 TFLiteProcessor::Instance::Instance(InferenceConfig& inference_config)
     : m_inference_config(inference_config) {
     if (inference_config.is_model_binary(anira::InferenceBackend::TFLITE)) {
@@ -0,0 +1,305 @@
+#include <anira/benchmark/BenchmarkReporter.h>
+#include <anira/utils/Logger.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <ios>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace anira::benchmark {
+
+namespace {
+
+// Percentile of sorted samples with linear interpolation between the closest ranks
+double get_percentile(const std::vector<double>& sorted, double percentile) {
+    if (sorted.empty()) { return 0.; }
+    double const position = percentile / 100. * static_cast<double>(sorted.size() - 1);
+    auto const lower = static_cast<size_t>(std::floor(position));
+    size_t const upper = std::min(lower + 1, sorted.size() - 1);
+    double const fraction = position - static_cast<double>(lower);
+    return sorted[lower] + fraction * (sorted[upper] - sorted[lower]);
+}
+
+double get_median(std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    return get_percentile(samples, 50.);
+}
+
+double get_environment_double(const char* name, double default_value) {
+    const char* value = std::getenv(name);
+    if (value == nullptr) { return default_value; }
+    char* end = nullptr;
+    double const parsed = std::strtod(value, &end);
+    return end == value ? default_value : parsed;
+}
+
+}  // namespace
+
+void BenchmarkReporter::add_sample(const std::string& name, double value) {
+    m_samples[name].push_back(value);
+}
+
+void BenchmarkReporter::clear() {
+    m_samples.clear();
+}
+
+const std::map<std::string, std::vector<double>>& BenchmarkReporter::get_samples() const {
+    return m_samples;
+}
+
+std::vector<BenchmarkSummary> BenchmarkReporter::summarize() const {
+    std::vector<BenchmarkSummary> summaries;
+    summaries.reserve(m_samples.size());
+    for (const auto& [name, samples] : m_samples) { summaries.push_back(summarize(name, samples)); }
+    return summaries;
+}
+
+BenchmarkSummary BenchmarkReporter::summarize(const std::string& name,
+                                              const std::vector<double>& samples) {
+    BenchmarkSummary summary;
+    summary.m_name = name;
+    summary.m_num_samples = samples.size();
+    if (samples.empty()) { return summary; }
+
+    std::vector<double> sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+
+    double sum = 0.;
+    for (double const sample : samples) { sum += sample; }
+    summary.m_mean = sum / static_cast<double>(samples.size());
+
+    if (samples.size() > 1) {
+        double squared_sum = 0.;
+        double jitter_sum = 0.;
+        for (size_t i = 0; i < samples.size(); ++i) {
+            squared_sum += (samples[i] - summary.m_mean) * (samples[i] - summary.m_mean);
+            if (i > 0) { jitter_sum += std::abs(samples[i] - samples[i - 1]); }
+        }
+        summary.m_std_dev = std::sqrt(squared_sum / static_cast<double>(samples.size() - 1));
+        summary.m_jitter = jitter_sum / static_cast<double>(samples.size() - 1);
+    }
+
+    summary.m_min = sorted.front();
+    summary.m_max = sorted.back();
+    summary.m_p50 = get_percentile(sorted, 50.);
+    summary.m_p90 = get_percentile(sorted, 90.);
+    summary.m_p99 = get_percentile(sorted, 99.);
+    summary.m_p999 = get_percentile(sorted, 99.9);
+
+    double const q1 = get_percentile(sorted, 25.);
+    double const q3 = get_percentile(sorted, 75.);
+    double const fence = 1.5 * (q3 - q1);
+    summary.m_num_outliers = static_cast<size_t>(
+        std::count_if(sorted.begin(), sorted.end(), [&](double sample) {
+            return sample < q1 - fence || sample > q3 + fence;
+        }));
+    return summary;
+}
+
+void BenchmarkReporter::print_summary(std::ostream& stream) const {
+    stream << std::left << std::setw(72) << "Benchmark" << std::right << std::setw(8) << "n"
+           << std::setw(11) << "mean" << std::setw(11) << "stddev" << std::setw(11) << "p50"
+           << std::setw(11) << "p90" << std::setw(11) << "p99" << std::setw(11) << "p99.9"
+           << std::setw(11) << "max" << std::setw(11) << "jitter" << std::setw(10) << "outliers"
+           << '\n';
+    for (const auto& summary : summarize()) {
+        stream << std::left << std::setw(72) << summary.m_name << std::right << std::setw(8)
+               << summary.m_num_samples << std::fixed << std::setprecision(4) << std::setw(11)
+               << summary.m_mean << std::setw(11) << summary.m_std_dev << std::setw(11)
+               << summary.m_p50 << std::setw(11) << summary.m_p90 << std::setw(11)
+               << summary.m_p99 << std::setw(11) << summary.m_p999 << std::setw(11)
+               << summary.m_max << std::setw(11) << summary.m_jitter << std::setw(10)
+               << summary.m_num_outliers << '\n';
+    }
+}
+
+bool BenchmarkReporter::write_json(const std::string& file_path) const {
+    nlohmann::json benchmarks = nlohmann::json::array();
+    for (const auto& summary : summarize()) {
+        benchmarks.push_back({
+            {"name", summary.m_name},
+            {"samples", m_samples.at(summary.m_name)},
+            {"summary",
+             {
+                 {"num_samples", summary.m_num_samples},
+                 {"mean", summary.m_mean},
+                 {"std_dev", summary.m_std_dev},
+                 {"min", summary.m_min},
+                 {"max", summary.m_max},
+                 {"p50", summary.m_p50},
+                 {"p90", summary.m_p90},
+                 {"p99", summary.m_p99},
+                 {"p999", summary.m_p999},
+                 {"jitter", summary.m_jitter},
+                 {"num_outliers", summary.m_num_outliers},
+             }},
+        });
+    }
+
+    std::ofstream file(file_path);
+    if (!file.is_open()) {
+        LOG_ERROR << "Could not open file at " + file_path << '\n';
+        return false;
+    }
+    file << nlohmann::json{{"benchmarks", benchmarks}}.dump(2) << '\n';
+    return file.good();
+}
+
+bool BenchmarkReporter::read_json(const std::string& file_path) {
+    std::ifstream file(file_path);
+    if (!file.is_open()) {
+        LOG_ERROR << "Could not open file at " + file_path << '\n';
+        return false;
+    }
+
+    std::map<std::string, std::vector<double>> samples;
+    try {
+        nlohmann::json const json = nlohmann::json::parse(file);
+        for (const auto& benchmark : json.at("benchmarks")) {
+            samples[benchmark.at("name").get<std::string>()] =
+                benchmark.at("samples").get<std::vector<double>>();
+        }
+    } catch (const std::exception& e) {
+        LOG_ERROR << "Invalid benchmark results in " << file_path << ": " << e.what() << '\n';
+        return false;
+    }
+    m_samples = std::move(samples);
+    return true;
+}
+
+std::vector<BenchmarkComparison> BenchmarkReporter::compare(const BenchmarkReporter& baseline,
+                                                            double alpha,
+                                                            double min_relative_change) const {
+    std::vector<BenchmarkComparison> comparisons;
+    for (const auto& [name, samples] : m_samples) {
+        auto const baseline_samples = baseline.m_samples.find(name);
+        if (baseline_samples == baseline.m_samples.end() || samples.empty() ||
+            baseline_samples->second.empty()) {
+            continue;
+        }
+
+        BenchmarkComparison comparison;
+        comparison.m_name = name;
+        comparison.m_baseline_median = get_median(baseline_samples->second);
+        comparison.m_median = get_median(samples);
+        if (comparison.m_baseline_median > 0.) {
+            comparison.m_relative_change =
+                (comparison.m_median - comparison.m_baseline_median) /
+                comparison.m_baseline_median;
+        }
+
+        if (comparison.m_relative_change >= 0.) {
+            comparison.m_p_value = mann_whitney_p_value(samples, baseline_samples->second);
+            comparison.m_regression = comparison.m_p_value < alpha &&
+                                      comparison.m_relative_change > min_relative_change;
+        } else {
+            comparison.m_p_value = mann_whitney_p_value(baseline_samples->second, samples);
+            comparison.m_improvement = comparison.m_p_value < alpha &&
+                                       -comparison.m_relative_change > min_relative_change;
+        }
+        comparisons.push_back(comparison);
+    }
+    return comparisons;
+}
+
+void BenchmarkReporter::print_comparison(std::ostream& stream,
+                                         const std::vector<BenchmarkComparison>& comparisons) {
+    stream << std::left << std::setw(72) << "Benchmark" << std::right << std::setw(14)
+           << "baseline p50" << std::setw(11) << "p50" << std::setw(10) << "change"
+           << std::setw(12) << "p-value" << "  " << "result" << '\n';
+    for (const auto& comparison : comparisons) {
+        const char* result = "unchanged";
+        if (comparison.m_regression) {
+            result = "REGRESSION";
+        } else if (comparison.m_improvement) {
+            result = "improvement";
+        }
+        stream << std::left << std::setw(72) << comparison.m_name << std::right << std::fixed
+               << std::setprecision(4) << std::setw(14) << comparison.m_baseline_median
+               << std::setw(11) << comparison.m_median << std::setprecision(1) << std::setw(9)
+               << comparison.m_relative_change * 100. << '%' << std::scientific
+               << std::setprecision(2) << std::setw(12) << comparison.m_p_value << "  "
+               << result << std::defaultfloat << '\n';
+    }
+}
+
+bool BenchmarkReporter::report_from_environment(std::ostream& stream) const {
+    bool success = true;
+    print_summary(stream);
+
+    if (const char* output_path = std::getenv("ANIRA_BENCHMARK_OUTPUT")) {
+        if (write_json(output_path)) {
+            stream << "Benchmark results written to " << output_path << '\n';
+        } else {
+            success = false;
+        }
+    }
+
+    if (const char* baseline_path = std::getenv("ANIRA_BENCHMARK_BASELINE")) {
+        BenchmarkReporter baseline;
+        if (!baseline.read_json(baseline_path)) { return false; }
+
+        std::vector<BenchmarkComparison> const comparisons =
+            compare(baseline,
+                    get_environment_double("ANIRA_BENCHMARK_ALPHA", 0.01),
+                    get_environment_double("ANIRA_BENCHMARK_MIN_CHANGE", 0.05));
+        print_comparison(stream, comparisons);
+        for (const auto& comparison : comparisons) {
+            if (comparison.m_regression) { success = false; }
+        }
+    }
+    return success;
+}
+
+double BenchmarkReporter::mann_whitney_p_value(const std::vector<double>& samples,
+                                               const std::vector<double>& baseline) {
+    size_t const n1 = samples.size();
+    size_t const n2 = baseline.size();
+    if (n1 == 0 || n2 == 0) { return 1.; }
+
+    // Ranks of the pooled samples, tied values get the mean of their ranks
+    std::vector<std::pair<double, bool>> pooled;
+    pooled.reserve(n1 + n2);
+    for (double const sample : samples) { pooled.emplace_back(sample, true); }
+    for (double const sample : baseline) { pooled.emplace_back(sample, false); }
+    std::sort(pooled.begin(), pooled.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+
+    double rank_sum = 0.;
+    double tie_correction = 0.;
+    for (size_t i = 0; i < pooled.size();) {
+        size_t j = i;
+        while (j < pooled.size() && pooled[j].first == pooled[i].first) { ++j; }
+        double const mean_rank = (static_cast<double>(i + 1) + static_cast<double>(j)) / 2.;
+        for (size_t k = i; k < j; ++k) {
+            if (pooled[k].second) { rank_sum += mean_rank; }
+        }
+        auto const num_ties = static_cast<double>(j - i);
+        tie_correction += num_ties * num_ties * num_ties - num_ties;
+        i = j;
+    }
+
+    auto const n1d = static_cast<double>(n1);
+    auto const n2d = static_cast<double>(n2);
+    double const n = n1d + n2d;
+    double const u = rank_sum - n1d * (n1d + 1.) / 2.;
+    double const mean = n1d * n2d / 2.;
+    double const variance = n1d * n2d / 12. * ((n + 1.) - tie_correction / (n * (n - 1.)));
+    if (variance <= 0.) { return 1.; }
+
+    double const z = (u - mean - 0.5) / std::sqrt(variance);
+    return 0.5 * std::erfc(z / std::sqrt(2.));
+}
+
+}  // namespace anira::benchmark
@@ -1,15 +1,18 @@
 #include <anira/InferenceConfig.h>
 #include <anira/benchmark/ProcessBlockFixture.h>
+#include <anira/utils/Buffer.h>
 #include <anira/utils/HostConfig.h>
 #include <anira/utils/InferenceBackend.h>
 #include <anira/utils/helperFunctions.h>
 #include <benchmark/benchmark.h>
 
 #include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <iomanip>
 #include <ios>
 #include <iostream>
+#include <memory>
 #include <ratio>
 #include <string>
 #include <thread>
@@ -27,6 +30,21 @@ ProcessBlockFixture::~ProcessBlockFixture() = default;
 
 void ProcessBlockFixture::initialize_iteration() {
     m_prev_num_received_samples = static_cast<int>(m_inference_handler->get_available_samples(0));
+
+    size_t const num_output_tensors = m_inference_config.get_tensor_output_shape().size();
+    m_prev_num_received_samples_per_tensor.resize(num_output_tensors);
+    m_tensor_processed_time.resize(num_output_tensors);
+    m_tensor_processed.assign(num_output_tensors, false);
+    for (size_t i = 0; i < num_output_tensors; ++i) {
+        // Non-streamable outputs are written together with the streamable ones and have no
+        // receive buffer to observe
+        if (m_inference_config.get_postprocess_output_size()[i] > 0) {
+            m_prev_num_received_samples_per_tensor[i] =
+                m_inference_handler->get_available_samples(i);
+        } else {
+            m_tensor_processed[i] = true;
+        }
+    }
 }
 
 void ProcessBlockFixture::initialize_repetition(const InferenceConfig& inference_config,
@@ -101,7 +119,80 @@ void ProcessBlockFixture::initialize_repetition(const InferenceConfig& inference
 }
 
 bool ProcessBlockFixture::buffer_processed() {
-    return m_inference_handler->get_available_samples(0) >= m_prev_num_received_samples;
+    bool all_processed = true;
+    for (size_t i = 0; i < m_tensor_processed.size(); ++i) {
+        if (m_tensor_processed[i]) { continue; }
+        if (m_inference_handler->get_available_samples(i) >=
+            m_prev_num_received_samples_per_tensor[i]) {
+            m_tensor_processed[i] = true;
+            m_tensor_processed_time[i] = std::chrono::steady_clock::now();
+        } else {
+            all_processed = false;
+        }
+    }
+    return all_processed;
+}
+
+void ProcessBlockFixture::allocate_tensor_buffers(const InferenceConfig& inference_config,
+                                                  const HostConfig& host_config) {
+    size_t const num_input_tensors = inference_config.get_tensor_input_shape().size();
+    size_t const num_output_tensors = inference_config.get_tensor_output_shape().size();
+
+    m_input_buffers.clear();
+    m_input_pointers.clear();
+    m_num_input_samples.clear();
+    for (size_t i = 0; i < num_input_tensors; ++i) {
+        size_t num_channels = 1;
+        size_t num_samples = inference_config.get_tensor_input_size()[i];
+        if (inference_config.get_preprocess_input_size()[i] > 0) {
+            num_channels = inference_config.get_preprocess_input_channels()[i];
+            num_samples = static_cast<size_t>(
+                std::ceil(host_config.get_relative_buffer_size(inference_config, i, true)));
+        }
+        m_input_buffers.push_back(std::make_unique<Buffer<float>>(num_channels, num_samples));
+        m_input_pointers.push_back(m_input_buffers.back()->get_array_of_read_pointers());
+        m_num_input_samples.push_back(num_samples);
+    }
+
+    m_output_buffers.clear();
+    m_output_pointers.clear();
+    m_num_output_samples.clear();
+    for (size_t i = 0; i < num_output_tensors; ++i) {
+        size_t num_channels = 1;
+        size_t num_samples = inference_config.get_tensor_output_size()[i];
+        if (inference_config.get_postprocess_output_size()[i] > 0) {
+            num_channels = inference_config.get_postprocess_output_channels()[i];
+            num_samples = static_cast<size_t>(
+                std::ceil(host_config.get_relative_buffer_size(inference_config, i, false)));
+        }
+        m_output_buffers.push_back(std::make_unique<Buffer<float>>(num_channels, num_samples));
+        m_output_pointers.push_back(m_output_buffers.back()->get_array_of_write_pointers());
+        m_num_output_samples.push_back(num_samples);
+    }
+
+    m_tensor_runtime_sum.assign(num_output_tensors, 0.);
+}
+
+void ProcessBlockFixture::push_random_samples_in_tensor_buffers() {
+    for (auto& buffer : m_input_buffers) {
+        for (size_t channel = 0; channel < buffer->get_num_channels(); channel++) {
+            for (size_t sample = 0; sample < buffer->get_num_samples(); sample++) {
+                buffer->set_sample(channel, sample, random_sample());
+            }
+        }
+    }
+}
+
+void ProcessBlockFixture::process_tensor_buffers() {
+    // The handler reports the number of written samples through the same array, so the capacity
+    // is restored before every call
+    for (size_t i = 0; i < m_output_buffers.size(); ++i) {
+        m_num_output_samples[i] = m_output_buffers[i]->get_num_samples();
+    }
+    m_inference_handler->process(m_input_pointers.data(),
+                                 m_num_input_samples.data(),
+                                 m_output_pointers.data(),
+                                 m_num_output_samples.data());
 }
 
 void ProcessBlockFixture::push_random_samples_in_buffer(anira::HostConfig host_config) {
@@ -133,15 +224,39 @@ void ProcessBlockFixture::interation_step(const std::chrono::steady_clock::time_
 
     m_runtime_last_repetition += elapsed_time_ms;
 
+    m_reporter.add_sample(state.name() + "/" + m_model_name + "/" + m_inference_backend_name,
+                          elapsed_time_ms.count());
+
     std::cout << "SingleIteration/" << state.name() << "/" << m_model_name << "/"
               << m_inference_backend_name << "/" << state.range(0) << "/iteration:" << m_iteration
               << "/repetition:" << m_repetition << "\t\t\t" << std::fixed << std::setprecision(4)
               << elapsed_time_ms.count() << " ms" << '\n';
+
+    // Per tensor timings are only of interest if there is more than one streamable output
+    size_t num_streamable_outputs = 0;
+    for (size_t i = 0; i < m_tensor_processed.size(); ++i) {
+        if (m_inference_config.get_postprocess_output_size()[i] > 0) { num_streamable_outputs++; }
+    }
+    if (num_streamable_outputs > 1) {
+        m_tensor_runtime_sum.resize(m_tensor_processed.size(), 0.);
+        for (size_t i = 0; i < m_tensor_processed.size(); ++i) {
+            if (m_inference_config.get_postprocess_output_size()[i] == 0) { continue; }
+            auto tensor_time_ms =
+                std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(
+                    m_tensor_processed_time[i] - start);
+            m_tensor_runtime_sum[i] += tensor_time_ms.count();
+            state.counters["tensor_" + std::to_string(i) + "_ms"] =
+                ::benchmark::Counter(m_tensor_runtime_sum[i], ::benchmark::Counter::kAvgIterations);
+            std::cout << "\t\ttensor:" << i << "\t\t\t" << std::fixed << std::setprecision(4)
+                      << tensor_time_ms.count() << " ms" << '\n';
+        }
+    }
     m_iteration++;
 }
 
 void ProcessBlockFixture::repetition_step() {
     m_repetition += 1;
+    m_tensor_runtime_sum.assign(m_tensor_runtime_sum.size(), 0.);
     std::cout << "\n-------------------------------------------------------------------------------"
                  "---------------------------------------------------------\n"
               << '\n';
@@ -153,6 +268,10 @@ void ProcessBlockFixture::SetUp(const ::benchmark::State& state) {
 
 void ProcessBlockFixture::TearDown(const ::benchmark::State&) {
     m_buffer.reset();
+    m_input_pointers.clear();
+    m_output_pointers.clear();
+    m_input_buffers.clear();
+    m_output_buffers.clear();
     m_inference_handler.reset();
 
     if (m_sleep_after_repetition) { std::this_thread::sleep_for(m_runtime_last_repetition); }
@@ -0,0 +1,243 @@
+#include <anira/InferenceConfig.h>
+#include <anira/InferenceHandler.h>
+#include <anira/benchmark/RealtimeHarness.h>
+#include <anira/system/HighPriorityThread.h>
+#include <anira/utils/Histogram.h>
+#include <anira/utils/HostConfig.h>
+#include <anira/utils/helperFunctions.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <ios>
+#include <ostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace anira::benchmark {
+
+namespace {
+
+// The callback thread sleeps until shortly before the deadline and spins for the rest, since
+// sleep_until alone can wake up late by more than a short host period
+constexpr std::chrono::microseconds k_spin_time{200};
+
+double to_ms(double samples, float sample_rate) {
+    return samples * 1000. / static_cast<double>(sample_rate);
+}
+
+}  // namespace
+
+RealtimeHarness::RealtimeHarness(InferenceHandler& inference_handler,
+                                 InferenceConfig& inference_config)
+    : m_inference_handler(inference_handler), m_inference_config(inference_config) {}
+
+RealtimeHarness::~RealtimeHarness() {
+    stop();
+}
+
+RealtimeRunResult RealtimeHarness::measure(const HostConfig& host_config,
+                                           unsigned int latency,
+                                           std::chrono::milliseconds duration) {
+    m_host_config = host_config;
+    m_inference_handler.prepare(host_config, latency);
+    m_inference_handler.reset_statistics();
+
+    auto const buffer_size = static_cast<size_t>(host_config.m_buffer_size);
+    m_num_callbacks = static_cast<uint64_t>(
+        std::ceil(std::chrono::duration<double>(duration).count() * host_config.m_sample_rate /
+                  host_config.m_buffer_size));
+
+    m_input.resize(m_inference_config.get_preprocess_input_channels()[0], buffer_size);
+    m_output.resize(m_inference_config.get_postprocess_output_channels()[0],
+                    static_cast<size_t>(
+                        std::ceil(host_config.get_relative_buffer_size(m_inference_config,
+                                                                       0,
+                                                                       false))));
+    for (size_t channel = 0; channel < m_input.get_num_channels(); ++channel) {
+        for (size_t sample = 0; sample < m_input.get_num_samples(); ++sample) {
+            m_input.set_sample(channel, sample, random_sample());
+        }
+    }
+
+    m_callback_time.reset();
+    m_callback_overruns.store(0, std::memory_order_relaxed);
+    m_finished.store(false, std::memory_order_release);
+
+    start();
+    while (!m_finished.load(std::memory_order_acquire)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    stop();
+
+    InferenceStatistics const statistics = m_inference_handler.get_statistics();
+    return RealtimeRunResult{
+        .m_buffer_size = host_config.m_buffer_size,
+        .m_sample_rate = host_config.m_sample_rate,
+        .m_latency = latency,
+        .m_num_callbacks = m_num_callbacks,
+        .m_underruns = statistics.m_missing_samples.m_count,
+        .m_missing_samples = statistics.m_missing_samples.m_sum,
+        .m_callback_overruns = m_callback_overruns.load(std::memory_order_relaxed),
+        .m_callback_time = m_callback_time.snapshot(),
+    };
+}
+
+LatencySearchResult RealtimeHarness::find_min_safe_latency(const HostConfig& host_config,
+                                                           std::chrono::milliseconds duration,
+                                                           unsigned int resolution,
+                                                           unsigned int max_latency_factor) {
+    resolution = std::max(resolution, 1u);
+
+    LatencySearchResult result;
+    result.m_buffer_size = host_config.m_buffer_size;
+    result.m_sample_rate = host_config.m_sample_rate;
+    m_inference_handler.prepare(host_config);
+    result.m_default_latency = m_inference_handler.get_latency();
+
+    unsigned int const max_latency =
+        std::max(result.m_default_latency, resolution) * max_latency_factor;
+
+    // Grow the latency until a run is safe, the last unsafe latency bounds the bisection
+    unsigned int unsafe_latency = 0;
+    unsigned int safe_latency = result.m_default_latency;
+    result.m_runs.push_back(measure(host_config, safe_latency, duration));
+    while (!result.m_runs.back().is_safe()) {
+        if (safe_latency >= max_latency) { return result; }
+        unsafe_latency = safe_latency;
+        safe_latency = std::min(std::max(safe_latency * 2, resolution), max_latency);
+        result.m_runs.push_back(measure(host_config, safe_latency, duration));
+    }
+
+    while (safe_latency - unsafe_latency > resolution) {
+        unsigned int const latency = unsafe_latency + (safe_latency - unsafe_latency) / 2;
+        result.m_runs.push_back(measure(host_config, latency, duration));
+        if (result.m_runs.back().is_safe()) {
+            safe_latency = latency;
+        } else {
+            unsafe_latency = latency;
+        }
+    }
+
+    result.m_found = true;
+    result.m_min_safe_latency = safe_latency;
+    return result;
+}
+
+std::vector<LatencySearchResult> RealtimeHarness::sweep(float sample_rate,
+                                                        const std::vector<float>& buffer_sizes,
+                                                        std::chrono::milliseconds duration,
+                                                        unsigned int resolution) {
+    std::vector<LatencySearchResult> results;
+    results.reserve(buffer_sizes.size());
+    for (float const buffer_size : buffer_sizes) {
+        results.push_back(
+            find_min_safe_latency(HostConfig(buffer_size, sample_rate), duration, resolution));
+    }
+    return results;
+}
+
+float RealtimeHarness::get_min_safe_buffer_size(const std::vector<LatencySearchResult>& results) {
+    float min_buffer_size = 0.f;
+    for (const auto& result : results) {
+        // The first run of every search uses the default latency
+        if (result.m_runs.empty() || !result.m_runs.front().is_safe()) { continue; }
+        if (min_buffer_size == 0.f || result.m_buffer_size < min_buffer_size) {
+            min_buffer_size = result.m_buffer_size;
+        }
+    }
+    return min_buffer_size;
+}
+
+void RealtimeHarness::print_results(std::ostream& stream,
+                                    const std::vector<LatencySearchResult>& results) {
+    stream << std::left << std::setw(14) << "Buffer size" << std::setw(24) << "Default latency"
+           << std::setw(18) << "Default safe" << std::setw(24) << "Min safe latency"
+           << "Callback p99" << '\n';
+    for (const auto& result : results) {
+        const RealtimeRunResult* default_run =
+            result.m_runs.empty() ? nullptr : &result.m_runs.front();
+        stream << std::left << std::setw(14) << std::fixed << std::setprecision(0)
+               << result.m_buffer_size;
+
+        std::ostringstream default_latency;
+        default_latency << result.m_default_latency << " (" << std::fixed << std::setprecision(2)
+                        << to_ms(result.m_default_latency, result.m_sample_rate) << " ms)";
+        stream << std::setw(24) << default_latency.str();
+
+        std::ostringstream default_safe;
+        if (default_run != nullptr && default_run->is_safe()) {
+            default_safe << "yes";
+        } else if (default_run != nullptr) {
+            default_safe << "no (" << default_run->m_underruns << ")";
+        }
+        stream << std::setw(18) << default_safe.str();
+
+        std::ostringstream min_safe_latency;
+        if (result.m_found) {
+            min_safe_latency << result.m_min_safe_latency << " (" << std::fixed
+                             << std::setprecision(2)
+                             << to_ms(result.m_min_safe_latency, result.m_sample_rate) << " ms)";
+        } else {
+            min_safe_latency << "none";
+        }
+        stream << std::setw(24) << min_safe_latency.str();
+
+        if (default_run != nullptr) {
+            stream << std::fixed << std::setprecision(3)
+                   << static_cast<double>(default_run->m_callback_time.get_percentile(99.)) / 1e6
+                   << " ms";
+        }
+        stream << '\n';
+    }
+
+    float const min_buffer_size = get_min_safe_buffer_size(results);
+    if (min_buffer_size > 0.f) {
+        stream << "Minimum safe buffer size at default latency: " << std::fixed
+               << std::setprecision(0) << min_buffer_size << '\n';
+    } else {
+        stream << "No buffer size was safe at the default latency" << '\n';
+    }
+}
+
+void RealtimeHarness::run() {
+    using Clock = std::chrono::steady_clock;
+    double const period_s =
+        static_cast<double>(m_host_config.m_buffer_size) / m_host_config.m_sample_rate;
+    auto const num_input_samples = m_input.get_num_samples();
+    auto const num_output_samples = m_output.get_num_samples();
+    auto const start = Clock::now() + std::chrono::milliseconds(1);
+
+    // Deadlines are derived from the callback count, so rounding errors do not accumulate
+    auto deadline = [&](uint64_t callback) {
+        return start + std::chrono::duration_cast<Clock::duration>(
+                           std::chrono::duration<double>(static_cast<double>(callback) * period_s));
+    };
+
+    for (uint64_t callback = 0; callback < m_num_callbacks && !should_exit(); ++callback) {
+        auto const callback_time = deadline(callback);
+        std::this_thread::sleep_until(callback_time - k_spin_time);
+        while (Clock::now() < callback_time) {}
+
+        auto const begin = Clock::now();
+        m_inference_handler.process(m_input.get_array_of_read_pointers(),
+                                    num_input_samples,
+                                    m_output.get_array_of_write_pointers(),
+                                    num_output_samples);
+        auto const end = Clock::now();
+
+        m_callback_time.record(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()));
+        if (end > deadline(callback + 1)) {
+            m_callback_overruns.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    m_finished.store(true, std::memory_order_release);
+}
+
+}  // namespace anira::benchmark
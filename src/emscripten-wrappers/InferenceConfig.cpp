@@ -302,6 +302,11 @@ size_t processingspec_get_internal_model_latency(uintptr_t ptr, size_t tensor_in
     return tensor_index < v.size() ? v[tensor_index] : 0;
 }
 
+EMSCRIPTEN_KEEPALIVE
+float processingspec_get_model_sample_rate(uintptr_t ptr) {
+    return reinterpret_cast<anira::ProcessingSpec*>(ptr)->m_model_sample_rate;
+}
+
 EMSCRIPTEN_KEEPALIVE
 size_t processingspec_get_tensor_input_size(uintptr_t ptr, size_t tensor_index) {
     const auto& v = reinterpret_cast<anira::ProcessingSpec*>(ptr)->m_tensor_input_size;
@@ -109,6 +109,21 @@ void prepostprocessor_pop_samples_from_buffer_window_offset(uintptr_t ptr,
         offset);
 }
 
+EMSCRIPTEN_KEEPALIVE
+void prepostprocessor_pop_windows_from_buffer(uintptr_t ptr,
+                                              uintptr_t ring_buffer_ptr,
+                                              uintptr_t buffer_ptr,
+                                              size_t num_windows,
+                                              size_t window_size,
+                                              size_t hop_size) {
+    reinterpret_cast<anira::PrePostProcessor*>(ptr)->pop_windows_from_buffer(
+        *reinterpret_cast<anira::RingBuffer*>(ring_buffer_ptr),
+        *reinterpret_cast<anira::BufferF*>(buffer_ptr),
+        num_windows,
+        window_size,
+        hop_size);
+}
+
 EMSCRIPTEN_KEEPALIVE
 void prepostprocessor_push_samples_to_buffer(uintptr_t ptr,
                                              uintptr_t buffer_ptr,
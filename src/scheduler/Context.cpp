@@ -16,17 +16,23 @@
 #endif
 #include <anira/scheduler/Context.h>
 #include <anira/scheduler/InferenceThread.h>
+#include <anira/scheduler/MemoryFootprint.h>
 #include <anira/scheduler/SessionElement.h>
 #include <anira/utils/HostConfig.h>
 #include <anira/utils/InferenceBackend.h>
 #include <anira/utils/Logger.h>
+#include <anira/utils/MemoryLock.h>
+#include <anira/utils/RealtimeLogger.h>
+#include <anira/utils/Tracer.h>
 #include <concurrentqueue.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -35,11 +41,17 @@ namespace anira {
 
 Context::Context(const ContextConfig& context_config) {
     m_context_config = context_config;
+    RealtimeLogger::start();
     for (unsigned int i = 0; i < m_context_config.m_num_threads; ++i) {
-        m_thread_pool.emplace_back(std::make_unique<InferenceThread>(m_next_inference));
+        m_thread_pool.emplace_back(
+            std::make_unique<InferenceThread>(m_next_inference, m_context_config.m_lock_memory));
     }
 }
 
+Context::~Context() {
+    RealtimeLogger::stop();
+}
+
 std::shared_ptr<Context> Context::get_instance(const ContextConfig& context_config) {
     if (m_context == nullptr) {
         m_context = std::make_shared<Context>(context_config);
@@ -60,6 +72,8 @@ std::shared_ptr<Context> Context::get_instance(const ContextConfig& context_conf
             m_context->new_num_threads(context_config.m_num_threads);
             m_context->m_context_config.m_num_threads = context_config.m_num_threads;
         }
+        // Locking is applied to sessions prepared and threads created from now on
+        if (context_config.m_lock_memory) { m_context->m_context_config.m_lock_memory = true; }
     }
     return m_context;
 }
@@ -75,11 +89,13 @@ int Context::get_available_session_id() {
 }
 
 void Context::new_num_threads(unsigned int new_num_threads) {
+    std::lock_guard<std::mutex> const lock(m_thread_pool_mutex);
     auto const current_num_threads = (unsigned int)m_thread_pool.size();
 
     if (new_num_threads > current_num_threads) {
         for (unsigned int i = current_num_threads; i < new_num_threads; ++i) {
-            m_thread_pool.emplace_back(std::make_unique<InferenceThread>(m_next_inference));
+            m_thread_pool.emplace_back(std::make_unique<InferenceThread>(
+                m_next_inference, m_context_config.m_lock_memory));
         }
     } else if (new_num_threads < current_num_threads) {
         for (unsigned int i = current_num_threads - 1; i >= new_num_threads; --i) {
@@ -138,6 +154,7 @@ std::shared_ptr<SessionElement> Context::create_session(PrePostProcessor& pp_pro
 }
 
 void Context::release_thread_pool() {
+    std::lock_guard<std::mutex> const lock(m_thread_pool_mutex);
     m_thread_pool.clear();
 }
 
@@ -195,7 +212,10 @@ void Context::prepare_session(const std::shared_ptr<SessionElement>& session,
 
     drain_inference_queue(session);
 
+    // The locked buffers are freed by prepare
+    session->unlock_memory();
     session->prepare(new_config, std::move(custom_latency));
+    if (m_context_config.m_lock_memory) { session->lock_memory(); }
 
     start_thread_pool();
 
@@ -251,8 +271,8 @@ void Context::new_data_submitted(const std::shared_ptr<SessionElement>& session)
                     }
                 }
             }
-            LOG_INFO << "[WARNING] No free inference queue found in session: "
-                     << session->m_session_id << "!" << '\n';
+            LOG_RT_WARNING("No free inference queue found in session: %d!",
+                           session->m_session_id);
             return;
         }
     }
@@ -313,20 +333,101 @@ void Context::new_data_request(const std::shared_ptr<SessionElement>& session,
     }
 }
 
+size_t Context::get_num_sessions_using(const BackendBase* processor) {
+    return static_cast<size_t>(
+        std::count_if(m_sessions.begin(), m_sessions.end(), [processor](const auto& session) {
+            return session->uses_processor(processor);
+        }));
+}
+
 std::vector<std::shared_ptr<SessionElement>>& Context::get_sessions() {
     return m_sessions;
 }
 
+MemoryLockStatus Context::get_memory_lock_status() {
+    MemoryLockStatus status;
+    std::lock_guard<std::mutex> const lock(m_thread_pool_mutex);
+    for (const auto& thread : m_thread_pool) { status.merge(thread->get_stack_lock_status()); }
+    return status;
+}
+
+ContextMemoryFootprint Context::get_memory_footprint() {
+    ContextMemoryFootprint footprint;
+    std::vector<BackendBase*> custom_processors;
+    for (const auto& session : m_sessions) {
+        footprint.m_sessions.push_back(session->get_memory_footprint());
+        if (session->m_custom_processor != &session->m_default_processor &&
+            std::find(custom_processors.begin(),
+                      custom_processors.end(),
+                      session->m_custom_processor) == custom_processors.end()) {
+            custom_processors.push_back(session->m_custom_processor);
+        }
+    }
+
+    [[maybe_unused]] auto const add_processors = [&footprint](const auto& processors) {
+        for (const auto& processor : processors) {
+            BackendMemoryFootprint backend = processor->get_memory_footprint();
+            backend.m_num_sessions = get_num_sessions_using(processor.get());
+            footprint.m_processors.push_back(backend);
+        }
+    };
+#ifdef USE_LIBTORCH
+    add_processors(m_libtorch_processors);
+#endif
+#ifdef USE_ONNXRUNTIME
+    add_processors(m_onnx_processors);
+#endif
+#ifdef USE_TFLITE
+    add_processors(m_tflite_processors);
+#endif
+#ifdef USE_LITERT
+    add_processors(m_litert_processors);
+#endif
+    for (BackendBase* custom_processor : custom_processors) {
+        BackendMemoryFootprint backend = custom_processor->get_memory_footprint();
+        backend.m_backend = InferenceBackend::CUSTOM;
+        backend.m_num_sessions = get_num_sessions_using(custom_processor);
+        footprint.m_processors.push_back(backend);
+    }
+    return footprint;
+}
+
 bool Context::pre_process(const std::shared_ptr<SessionElement>& session) {
     for (size_t i = 0; i < session->m_inference_queue.size(); ++i) {
         if (session->m_inference_queue[i]->m_free.exchange(false)) {
-            session->m_pp_processor.pre_process(
-                session->m_send_buffer,
-                session->m_inference_queue[i]->m_tensor_input_data,
-                session->m_current_backend.load(std::memory_order_relaxed));
+            auto const pre_process_start = std::chrono::steady_clock::now();
+            {
+                ANIRA_TRACE_SCOPE("pre_process",
+                                  session->m_session_id,
+                                  static_cast<long>(session->m_current_queue));
+                session->m_pp_processor.pre_process(
+                    session->m_send_buffer,
+                    session->m_inference_queue[i]->m_tensor_input_data,
+                    session->m_current_backend.load(std::memory_order_relaxed));
+            }
+            auto const pre_process_end = std::chrono::steady_clock::now();
+            session->m_statistics.record_pre_process(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(pre_process_end -
+                                                                     pre_process_start)
+                    .count());
+            session->m_inference_queue[i]->m_submit_time = pre_process_end;
             session->m_time_stamps.insert(session->m_time_stamps.begin(), session->m_current_queue);
             session->m_inference_queue[i]->m_time_stamp = session->m_current_queue;
-            if (session->m_inference_config.m_session_exclusive_processor) {
+            if (session->m_inference_cache.lookup(
+                    session->m_inference_queue[i]->m_tensor_input_data,
+                    session->m_inference_queue[i]->m_tensor_output_data,
+                    session->m_current_backend.load(std::memory_order_relaxed),
+                    session->m_inference_queue[i]->m_cache_ticket)) {
+                // The outputs are known, the struct completes without an inference and is
+                // post-processed in order with the ones still in flight
+                session->m_statistics.record_memoized_inference();
+                if (session->m_inference_config.m_blocking_ratio > 0.f) {
+                    session->m_inference_queue[i]->m_done_semaphore.release();
+                } else {
+                    session->m_inference_queue[i]->m_done_atomic.store(true,
+                                                                        std::memory_order::release);
+                }
+            } else if (session->m_inference_config.m_session_exclusive_processor) {
                 // A session-exclusive processor carries its state across calls, so
                 // its tasks must execute strictly in order and never concurrently.
                 // Defer dispatch so at most one of this session's tasks is ever in
@@ -336,7 +437,7 @@ bool Context::pre_process(const std::shared_ptr<SessionElement>& session) {
                 if (auto next = session->try_acquire_next_dispatch()) {
                     if (!m_next_inference.try_enqueue(
                             InferenceData{.m_session = session, .m_thread_safe_struct = next})) {
-                        LOG_ERROR << "[ERROR] Could not enqueue next inference!" << '\n';
+                        LOG_RT_ERROR("Could not enqueue next inference!");
                         session->release_dispatch();  // retried on the next submission/completion
                     }
                 }
@@ -346,7 +447,7 @@ bool Context::pre_process(const std::shared_ptr<SessionElement>& session) {
                     .m_thread_safe_struct = session->m_inference_queue[i]};
                 moodycamel::ProducerToken const& producer_token = get_producer_token();
                 if (!m_next_inference.try_enqueue(producer_token, inference_data)) {
-                    LOG_ERROR << "[ERROR] Could not enqueue next inference!" << '\n';
+                    LOG_RT_ERROR("Could not enqueue next inference!");
                     session->m_inference_queue[i]->m_free.exchange(true);
                     session->m_time_stamps.pop_back();
                     return false;
@@ -366,14 +467,28 @@ bool Context::pre_process(const std::shared_ptr<SessionElement>& session) {
 void Context::post_process(
     const std::shared_ptr<SessionElement>& session,
     const std::shared_ptr<SessionElement::ThreadSafeStruct>& thread_safe_struct) {
-    session->m_pp_processor.post_process(
-        thread_safe_struct->m_tensor_output_data,
-        session->m_receive_buffer,
-        session->m_current_backend.load(std::memory_order_relaxed));
+    session->m_inference_cache.store(thread_safe_struct->m_cache_ticket,
+                                     thread_safe_struct->m_tensor_output_data);
+    auto const post_process_start = std::chrono::steady_clock::now();
+    {
+        ANIRA_TRACE_SCOPE("post_process",
+                          session->m_session_id,
+                          static_cast<long>(thread_safe_struct->m_time_stamp));
+        session->overlap_add_output_spectra(*thread_safe_struct);
+        session->m_pp_processor.post_process(
+            thread_safe_struct->m_tensor_output_data,
+            session->m_receive_buffer,
+            session->m_current_backend.load(std::memory_order_relaxed));
+    }
+    session->m_statistics.record_post_process(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                             post_process_start)
+            .count());
     thread_safe_struct->m_free.store(true, std::memory_order::release);
 }
 
 void Context::start_thread_pool() {
+    std::lock_guard<std::mutex> const lock(m_thread_pool_mutex);
     for (const auto& i : m_thread_pool) {
         if (!i->is_running()) { i->start(); }
         while (!i->is_running()) { std::this_thread::sleep_for(std::chrono::microseconds(50)); }
@@ -462,7 +577,7 @@ moodycamel::ConcurrentQueue<InferenceData>& Context::get_static_inference_queue(
 }
 
 std::unique_ptr<InferenceThread> Context::make_inference_thread() {
-    return std::make_unique<InferenceThread>(m_next_inference);
+    return std::make_unique<InferenceThread>(m_next_inference, m_context_config.m_lock_memory);
 }
 
 #ifdef USE_LIBTORCH
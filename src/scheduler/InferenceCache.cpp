@@ -0,0 +1,138 @@
+#include <anira/scheduler/InferenceCache.h>
+#include <anira/utils/Buffer.h>
+#include <anira/utils/InferenceBackend.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace anira {
+
+namespace {
+
+size_t get_num_values(const BufferF& tensor) {
+    return tensor.get_num_channels() * tensor.get_num_samples();
+}
+
+bool equals(const std::vector<BufferF>& a, const std::vector<BufferF>& b) {
+    for (size_t i = 0; i < a.size(); ++i) {
+        size_t const num_values = get_num_values(a[i]);
+        if (num_values == 0) { continue; }
+        if (std::memcmp(a[i].get_read_pointer(0),
+                        b[i].get_read_pointer(0),
+                        num_values * sizeof(float)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void copy(const std::vector<BufferF>& source, std::vector<BufferF>& destination) {
+    for (size_t i = 0; i < source.size(); ++i) {
+        size_t const num_values = get_num_values(source[i]);
+        if (num_values == 0) { continue; }
+        std::memcpy(destination[i].get_write_pointer(0),
+                    source[i].get_read_pointer(0),
+                    num_values * sizeof(float));
+    }
+}
+
+}  // namespace
+
+void InferenceCache::prepare(size_t num_entries,
+                             const std::vector<size_t>& tensor_input_size,
+                             const std::vector<size_t>& tensor_output_size) {
+    m_entries.clear();
+    m_entries.resize(num_entries);
+    for (auto& entry : m_entries) {
+        for (size_t const size : tensor_input_size) { entry.m_inputs.emplace_back(1, size); }
+        for (size_t const size : tensor_output_size) { entry.m_outputs.emplace_back(1, size); }
+    }
+    clear();
+}
+
+void InferenceCache::clear() {
+    for (auto& entry : m_entries) {
+        entry.m_valid = false;
+        entry.m_last_used = 0;
+        entry.m_generation = ++m_generation;
+    }
+    m_clock = 0;
+}
+
+bool InferenceCache::is_enabled() const {
+    return !m_entries.empty();
+}
+
+bool InferenceCache::lookup(const std::vector<BufferF>& input,
+                            std::vector<BufferF>& output,
+                            InferenceBackend backend,
+                            Ticket& ticket) {
+    ticket = Ticket();
+    if (m_entries.empty()) { return false; }
+
+    uint64_t const hash = calculate_hash(input);
+    ++m_clock;
+    for (auto& entry : m_entries) {
+        // The hash only narrows down the candidates, the inputs are compared to rule out
+        // collisions
+        if (entry.m_valid && entry.m_hash == hash && entry.m_backend == backend &&
+            equals(entry.m_inputs, input)) {
+            entry.m_last_used = m_clock;
+            copy(entry.m_outputs, output);
+            return true;
+        }
+    }
+
+    // Reserve the least recently used entry, an entry still waiting for its outputs is
+    // replaced as well and its outputs are dropped by store()
+    auto const victim = std::min_element(
+        m_entries.begin(), m_entries.end(), [](const Entry& a, const Entry& b) {
+            return a.m_last_used < b.m_last_used;
+        });
+    copy(input, victim->m_inputs);
+    victim->m_hash = hash;
+    victim->m_backend = backend;
+    victim->m_generation = ++m_generation;
+    victim->m_last_used = m_clock;
+    victim->m_valid = false;
+
+    ticket.m_entry = static_cast<size_t>(victim - m_entries.begin());
+    ticket.m_generation = victim->m_generation;
+    return false;
+}
+
+void InferenceCache::store(const Ticket& ticket, const std::vector<BufferF>& output) {
+    if (ticket.m_entry >= m_entries.size()) { return; }
+    Entry& entry = m_entries[ticket.m_entry];
+    if (entry.m_generation != ticket.m_generation) { return; }
+    copy(output, entry.m_outputs);
+    entry.m_valid = true;
+}
+
+const std::vector<InferenceCache::Entry>& InferenceCache::get_entries() const {
+    return m_entries;
+}
+
+std::vector<InferenceCache::Entry>& InferenceCache::get_entries() {
+    return m_entries;
+}
+
+uint64_t InferenceCache::calculate_hash(const std::vector<BufferF>& tensors) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const auto& tensor : tensors) {
+        size_t const num_values = get_num_values(tensor);
+        if (num_values == 0) { continue; }
+        const float* values = tensor.get_read_pointer(0);
+        for (size_t i = 0; i < num_values; ++i) {
+            hash ^= std::bit_cast<uint32_t>(values[i]);
+            hash *= 0x100000001b3ULL;
+        }
+    }
+    return hash;
+}
+
+}  // namespace anira
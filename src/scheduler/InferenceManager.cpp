@@ -4,13 +4,22 @@
 #include <anira/backends/BackendBase.h>
 #include <anira/scheduler/Context.h>
 #include <anira/scheduler/InferenceManager.h>
+#include <anira/utils/Buffer.h>
 #include <anira/utils/HostConfig.h>
 #include <anira/utils/InferenceBackend.h>
+#include <anira/utils/InferenceTimeCalibration.h>
+#include <anira/utils/MemoryLock.h>
 #include <anira/utils/Logger.h>
+#include <anira/utils/Resampler.h>
+#include <anira/utils/RingBuffer.h>
+#include <anira/utils/Tracer.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cmath>
 #include <cstddef>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -37,19 +46,82 @@ InferenceBackend InferenceManager::get_backend() const {
     return m_session->m_current_backend.load(std::memory_order_relaxed);
 }
 
+void InferenceManager::set_inference_time_calibration(const InferenceTimeCalibration& calibration) {
+    m_calibration = calibration;
+}
+
+float InferenceManager::get_max_inference_time() const {
+    return m_session->get_max_inference_time();
+}
+
+void InferenceManager::set_arena_enabled(bool enabled) {
+    m_session->m_use_arena = enabled;
+}
+
+void InferenceManager::set_memoization_cache_size(size_t num_entries) {
+    m_session->m_memoization_cache_size = num_entries;
+}
+
+MemoryLockStatus InferenceManager::get_memory_lock_status() const {
+    return m_session->m_memory_lock_status;
+}
+
 void InferenceManager::prepare(HostConfig new_config, std::vector<long> custom_latency) {
+    // The calibration runs on the processor of the backend selected now, before the latency is
+    // calculated from the max inference time
+    m_session->m_calibrated_max_inference_time = 0.f;
+    if (m_calibration.m_enabled) {
+        InferenceBackend const backend = get_backend();
+        float const max_inference_time = InferenceTimeCalibrator::calibrate(
+            m_calibration, m_session->get_processor(backend), backend);
+        if (max_inference_time > 0.f) {
+            m_session->m_calibrated_max_inference_time = max_inference_time;
+        } else {
+            LOG_ERROR << "Could not calibrate the max inference time, using the configured "
+                      << m_inference_config.m_max_inference_time << " ms" << '\n';
+        }
+    }
+
+    prepare_session(new_config, std::move(custom_latency));
+}
+
+void InferenceManager::prepare_session(HostConfig new_config, std::vector<long> custom_latency) {
     m_host_config = new_config;
+    m_custom_latency = custom_latency;
 
     m_context->prepare_session(m_session, m_host_config, std::move(custom_latency));
 
     m_missing_samples.clear();
     m_missing_samples.resize(m_inference_config.get_tensor_output_shape().size(), 0);
+
+    // Scratch of the resamplers, so that no block allocates on the audio thread
+    m_resampled_input.clear();
+    m_resampled_output.clear();
+    m_required_samples.assign(m_inference_config.get_tensor_output_shape().size(), 0);
+    if (m_session->m_resampling) {
+        m_resampled_input.resize(m_inference_config.get_tensor_input_shape().size());
+        m_resampled_output.resize(m_inference_config.get_tensor_output_shape().size());
+        for (size_t i = 0; i < m_resampled_input.size(); ++i) {
+            if (m_inference_config.get_preprocess_input_size()[i] == 0) { continue; }
+            const Resampler& resampler = m_session->m_send_resampler[i];
+            m_resampled_input[i].resize(
+                m_inference_config.get_preprocess_input_channels()[i],
+                resampler.get_max_num_output_samples(resampler.get_max_num_input_samples()));
+        }
+        for (size_t i = 0; i < m_resampled_output.size(); ++i) {
+            if (m_inference_config.get_postprocess_output_size()[i] == 0) { continue; }
+            m_resampled_output[i].resize(
+                m_inference_config.get_postprocess_output_channels()[i],
+                m_session->m_receive_resampler[i].get_max_num_input_samples());
+        }
+    }
 }
 
 size_t* InferenceManager::process(const float* const* const* input_data,
                                   size_t* num_input_samples,
                                   float* const* const* output_data,
                                   size_t* num_output_samples) {
+    ANIRA_TRACE_SCOPE("process", m_session->m_session_id, -1);
     process_input(input_data, num_input_samples);
 
     m_context->new_data_submitted(m_session);
@@ -70,11 +142,13 @@ size_t* InferenceManager::process(const float* const* const* input_data,
 }
 
 void InferenceManager::push_data(const float* const* const* input_data, size_t* num_input_samples) {
+    ANIRA_TRACE_SCOPE("push_data", m_session->m_session_id, -1);
     process_input(input_data, num_input_samples);
     m_context->new_data_submitted(m_session);
 }
 
 size_t* InferenceManager::pop_data(float* const* const* output_data, size_t* num_output_samples) {
+    ANIRA_TRACE_SCOPE("pop_data", m_session->m_session_id, -1);
     if (m_inference_config.m_blocking_ratio > 0.f) {
         std::chrono::steady_clock::time_point const wait_until;
         m_context->new_data_request(m_session, wait_until);
@@ -88,47 +162,326 @@ size_t* InferenceManager::pop_data(float* const* const* output_data, size_t* num
 size_t* InferenceManager::pop_data(float* const* const* output_data,
                                    size_t* num_output_samples,
                                    std::chrono::steady_clock::time_point wait_until) {
+    ANIRA_TRACE_SCOPE("pop_data", m_session->m_session_id, -1);
     if (m_inference_config.m_blocking_ratio > 0.f) {
         m_context->new_data_request(m_session, wait_until);
     } else {
-        LOG_ERROR << "[ERROR] InferenceConfig does not use blocking_ratio and does not use "
-                     "semaphores for data acquisition, cannot wait for data!"
-                  << '\n';
+        LOG_RT_ERROR("InferenceConfig does not use blocking_ratio and does not use semaphores for "
+                     "data acquisition, cannot wait for data!");
     }
 
     return process_output(output_data, num_output_samples);
 }
 
+size_t* InferenceManager::render(const float* const* const* input_data,
+                                 size_t* num_input_samples,
+                                 float* const* const* output_data,
+                                 size_t* num_output_samples) {
+    if (m_session->m_resampling) {
+        return render_resampled(input_data, num_input_samples, output_data, num_output_samples);
+    }
+    return render_blocks(input_data,
+                         num_input_samples,
+                         output_data,
+                         num_output_samples,
+                         m_host_config.m_sample_rate);
+}
+
+size_t* InferenceManager::render_blocks(const float* const* const* input_data,
+                                        size_t* num_input_samples,
+                                        float* const* const* output_data,
+                                        size_t* num_output_samples,
+                                        float sample_rate) {
+    size_t const num_input_tensors = m_inference_config.get_tensor_input_shape().size();
+    size_t const num_output_tensors = m_inference_config.get_tensor_output_shape().size();
+
+    // One render block holds one preprocessing window per parallel processor, so every
+    // submitted block can be spread over all workers at once
+    size_t const num_windows = std::max(m_inference_config.m_num_parallel_processors, 1u);
+    HostConfig render_config = m_host_config;
+    render_config.m_sample_rate = sample_rate;
+    render_config.m_buffer_size = static_cast<float>(
+        m_inference_config.get_preprocess_input_size()[m_host_config.m_tensor_index] *
+        num_windows);
+    render_config.m_allow_smaller_buffers = false;
+
+    // A custom latency of zero removes the real-time latency padding from the receive buffers
+    m_context->prepare_session(m_session,
+                               render_config,
+                               std::vector<long>(num_output_tensors, 0));
+
+    std::vector<size_t> input_block_size(num_input_tensors, 0);
+    std::vector<size_t> output_block_size(num_output_tensors, 0);
+    for (size_t i = 0; i < num_input_tensors; ++i) {
+        if (m_inference_config.get_preprocess_input_size()[i] > 0) {
+            input_block_size[i] = static_cast<size_t>(
+                render_config.get_relative_buffer_size(m_inference_config, i, true));
+        } else if (num_input_samples[i] > 0) {
+            // Non-streamable parameters have no channel count
+            m_pp_processor.set_input_tensor(input_data[i][0], i, num_input_samples[i]);
+        }
+    }
+    for (size_t i = 0; i < num_output_tensors; ++i) {
+        if (m_inference_config.get_postprocess_output_size()[i] > 0) {
+            output_block_size[i] = static_cast<size_t>(
+                render_config.get_relative_buffer_size(m_inference_config, i, false));
+        }
+    }
+
+    std::vector<size_t> submitted_input(num_input_tensors, 0);
+    std::vector<size_t> submitted_output(num_output_tensors, 0);
+    std::vector<size_t> rendered_output(num_output_tensors, 0);
+    std::vector<size_t> skipped_output(num_output_tensors, 0);
+
+    while (true) {
+        bool submit_needed = false;
+        for (size_t i = 0; i < num_input_tensors; ++i) {
+            if (input_block_size[i] > 0 && submitted_input[i] < num_input_samples[i]) {
+                submit_needed = true;
+            }
+        }
+        for (size_t i = 0; i < num_output_tensors; ++i) {
+            if (output_block_size[i] > 0 &&
+                submitted_output[i] <
+                    num_output_samples[i] + m_session->get_internal_latency(i)) {
+                submit_needed = true;
+            }
+        }
+
+        // Keep submitting blocks as long as all of their windows find a free struct, inputs past
+        // the end of the span are zero-padded to flush the model
+        if (submit_needed && get_num_free_structs() >= num_windows) {
+            for (size_t i = 0; i < num_input_tensors; ++i) {
+                for (size_t channel = 0;
+                     channel < m_inference_config.get_preprocess_input_channels()[i] &&
+                     input_block_size[i] > 0;
+                     ++channel) {
+                    for (size_t sample = submitted_input[i];
+                         sample < submitted_input[i] + input_block_size[i];
+                         ++sample) {
+                        m_session->m_send_buffer[i].push_sample(
+                            channel,
+                            sample < num_input_samples[i] ? input_data[i][channel][sample] : 0.f);
+                    }
+                }
+                submitted_input[i] += input_block_size[i];
+            }
+            for (size_t i = 0; i < num_output_tensors; ++i) {
+                submitted_output[i] += output_block_size[i];
+            }
+            m_context->new_data_submitted(m_session);
+            continue;
+        }
+
+        // Waiting instead of spinning leaves the cores to the inference threads. Without a
+        // blocking ratio the structs signal completion by an atomic flag only.
+        if (m_inference_config.m_blocking_ratio > 0.f) {
+            m_context->new_data_request(m_session,
+                                        std::chrono::steady_clock::now() + k_render_wait_timeout);
+        } else {
+            m_context->new_data_request(m_session);
+        }
+
+        bool progress = false;
+        for (size_t i = 0; i < num_output_tensors; ++i) {
+            if (output_block_size[i] == 0) { continue; }
+            RingBuffer& receive_buffer = m_session->m_receive_buffer[i];
+            // Samples beyond the requested span are popped and discarded to keep the receive
+            // buffer from overflowing while the flush blocks complete
+            while (receive_buffer.get_available_samples(0) > 0) {
+                bool const skip = skipped_output[i] < m_session->get_internal_latency(i);
+                bool const write = !skip && rendered_output[i] < num_output_samples[i];
+                for (size_t channel = 0;
+                     channel < m_inference_config.get_postprocess_output_channels()[i];
+                     ++channel) {
+                    float const sample = receive_buffer.pop_sample(channel);
+                    if (write) { output_data[i][channel][rendered_output[i]] = sample; }
+                }
+                if (skip) {
+                    skipped_output[i]++;
+                } else if (write) {
+                    rendered_output[i]++;
+                }
+                progress = true;
+            }
+        }
+
+        if (!submit_needed && m_session->m_time_stamps.empty()) { break; }
+        if (!progress && m_inference_config.m_blocking_ratio <= 0.f) {
+            std::this_thread::sleep_for(k_render_poll_interval);
+        }
+    }
+
+    for (size_t i = 0; i < num_output_tensors; ++i) {
+        if (output_block_size[i] > 0) {
+            num_output_samples[i] = rendered_output[i];
+        } else if (num_output_samples[i] > 0) {
+            // Non-streamable parameters have no channel count
+            m_pp_processor.get_output_tensor(output_data[i][0], i, num_output_samples[i]);
+        }
+    }
+
+    // Return to the real-time configuration of the last prepare call, keeping its calibration
+    prepare_session(m_host_config, m_custom_latency);
+
+    return num_output_samples;
+}
+
+size_t* InferenceManager::render_resampled(const float* const* const* input_data,
+                                           size_t* num_input_samples,
+                                           float* const* const* output_data,
+                                           size_t* num_output_samples) {
+    size_t const num_input_tensors = m_inference_config.get_tensor_input_shape().size();
+    size_t const num_output_tensors = m_inference_config.get_tensor_output_shape().size();
+    float const host_sample_rate = m_host_config.m_sample_rate;
+    float const model_sample_rate = m_inference_config.get_model_sample_rate();
+    ResamplerQuality const quality = m_inference_config.get_resampler_quality();
+
+    // The whole span is resampled at once, zeros behind it flush the tail of the filter
+    std::vector<BufferF> model_input(num_input_tensors);
+    std::vector<const float* const*> model_input_data(input_data, input_data + num_input_tensors);
+    std::vector<size_t> num_model_input_samples(num_input_samples,
+                                                num_input_samples + num_input_tensors);
+    double send_latency = 0.;
+    for (size_t i = 0; i < num_input_tensors; ++i) {
+        if (m_inference_config.get_preprocess_input_size()[i] == 0) { continue; }
+        size_t const num_channels = m_inference_config.get_preprocess_input_channels()[i];
+        Resampler resampler;
+        resampler.prepare(num_channels,
+                          host_sample_rate,
+                          model_sample_rate,
+                          quality,
+                          std::max(num_input_samples[i], Resampler::get_num_taps(quality)));
+        send_latency = resampler.get_latency();
+
+        size_t const num_flush_samples = resampler.get_num_taps();
+        BufferF zeros(num_channels, num_flush_samples);
+        model_input[i].resize(num_channels,
+                              resampler.get_max_num_output_samples(num_input_samples[i]) +
+                                  resampler.get_max_num_output_samples(num_flush_samples));
+        size_t num_resampled = resampler.process(input_data[i],
+                                                 num_input_samples[i],
+                                                 model_input[i].get_array_of_write_pointers(),
+                                                 model_input[i].get_num_samples());
+        std::vector<float*> flush_output(num_channels);
+        for (size_t channel = 0; channel < num_channels; ++channel) {
+            flush_output[channel] = model_input[i].get_write_pointer(channel, num_resampled);
+        }
+        num_resampled += resampler.process(zeros.get_array_of_read_pointers(),
+                                           num_flush_samples,
+                                           flush_output.data(),
+                                           model_input[i].get_num_samples() - num_resampled);
+        model_input_data[i] = model_input[i].get_array_of_read_pointers();
+        num_model_input_samples[i] = num_resampled;
+    }
+
+    // The phase offset and the skipped samples remove the delay of both filters, like the session
+    // does in real time with a model latency of zero
+    std::vector<Resampler> resampler(num_output_tensors);
+    std::vector<size_t> num_skipped_samples(num_output_tensors, 0);
+    std::vector<BufferF> model_output(num_output_tensors);
+    std::vector<float* const*> model_output_data(output_data, output_data + num_output_tensors);
+    std::vector<size_t> num_model_output_samples(num_output_samples,
+                                                 num_output_samples + num_output_tensors);
+    for (size_t i = 0; i < num_output_tensors; ++i) {
+        if (m_inference_config.get_postprocess_output_size()[i] == 0) { continue; }
+        size_t const num_channels = m_inference_config.get_postprocess_output_channels()[i];
+        resampler[i].prepare(num_channels, model_sample_rate, host_sample_rate, quality, 0);
+        uint64_t const interpolation = resampler[i].get_interpolation_factor();
+        uint64_t const decimation = resampler[i].get_decimation_factor();
+        auto const filter_delay = static_cast<uint64_t>(
+            std::llround(send_latency * static_cast<double>(interpolation) +
+                         resampler[i].get_latency() * static_cast<double>(decimation)));
+        num_skipped_samples[i] = static_cast<size_t>(filter_delay / decimation);
+        resampler[i].set_phase_offset(filter_delay % decimation);
+
+        size_t const num_samples =
+            resampler[i].get_num_input_samples(num_skipped_samples[i] + num_output_samples[i]);
+        resampler[i].prepare(
+            num_channels, model_sample_rate, host_sample_rate, quality, num_samples);
+        resampler[i].set_phase_offset(filter_delay % decimation);
+        model_output[i].resize(num_channels, num_samples);
+        model_output_data[i] = model_output[i].get_array_of_write_pointers();
+        num_model_output_samples[i] = num_samples;
+    }
+
+    render_blocks(model_input_data.data(),
+                  num_model_input_samples.data(),
+                  model_output_data.data(),
+                  num_model_output_samples.data(),
+                  model_sample_rate);
+
+    for (size_t i = 0; i < num_output_tensors; ++i) {
+        if (m_inference_config.get_postprocess_output_size()[i] == 0) { continue; }
+        size_t const num_channels = m_inference_config.get_postprocess_output_channels()[i];
+        BufferF resampled(num_channels, num_skipped_samples[i] + num_output_samples[i]);
+        size_t const num_resampled =
+            resampler[i].process(model_output[i].get_array_of_read_pointers(),
+                                 num_model_output_samples[i],
+                                 resampled.get_array_of_write_pointers(),
+                                 resampled.get_num_samples());
+        size_t const num_rendered =
+            num_resampled > num_skipped_samples[i] ? num_resampled - num_skipped_samples[i] : 0;
+        num_output_samples[i] = std::min(num_output_samples[i], num_rendered);
+        for (size_t channel = 0; channel < num_channels; ++channel) {
+            std::copy_n(resampled.get_read_pointer(channel, num_skipped_samples[i]),
+                        num_output_samples[i],
+                        output_data[i][channel]);
+        }
+    }
+
+    return num_output_samples;
+}
+
 void InferenceManager::process_input(const float* const* const* input_data, size_t* num_samples) {
     for (size_t tensor_index = 0; tensor_index < m_inference_config.get_tensor_input_shape().size();
          ++tensor_index) {
         if (m_inference_config.get_preprocess_input_size()[tensor_index] > 0) {
+            const float* const* samples = input_data[tensor_index];
+            size_t num_send_samples = num_samples[tensor_index];
+            if (m_session->m_resampling) {
+                BufferF& resampled = m_resampled_input[tensor_index];
+                num_send_samples = m_session->m_send_resampler[tensor_index].process(
+                    samples,
+                    num_send_samples,
+                    resampled.get_array_of_write_pointers(),
+                    resampled.get_num_samples());
+                samples = resampled.get_array_of_read_pointers();
+            }
             for (size_t channel = 0;
                  channel < m_inference_config.get_preprocess_input_channels()[tensor_index];
                  ++channel) {
-                for (size_t sample = 0; sample < num_samples[tensor_index]; ++sample) {
-                    m_session->m_send_buffer[tensor_index].push_sample(
-                        channel,
-                        input_data[tensor_index][channel][sample]);
+                for (size_t sample = 0; sample < num_send_samples; ++sample) {
+                    m_session->m_send_buffer[tensor_index].push_sample(channel,
+                                                                       samples[channel][sample]);
                 }
             }
-        } else {
-            for (size_t sample = 0; sample < num_samples[tensor_index]; ++sample) {
-                m_pp_processor.set_input(input_data[tensor_index][0][sample],
-                                         tensor_index,
-                                         sample);  // Non-streamable parameters have no channel
-                                                   // count
-            }
+        } else if (num_samples[tensor_index] > 0) {
+            // Non-streamable parameters have no channel count. The audio thread must not wait
+            // for other writers, the values are dropped while another thread publishes them.
+            m_pp_processor.try_set_input_tensor(input_data[tensor_index][0],
+                                                tensor_index,
+                                                num_samples[tensor_index]);
         }
     }
 }
 
 size_t* InferenceManager::process_output(float* const* const* output_data, size_t* num_samples) {
+    // Behind the resamplers the receive buffers hold samples at the model sample rate
+    for (size_t i = 0; i < m_inference_config.get_tensor_output_shape().size(); ++i) {
+        if (m_inference_config.get_postprocess_output_size()[i] > 0) {
+            m_required_samples[i] =
+                m_session->m_resampling
+                    ? m_session->m_receive_resampler[i].get_num_input_samples(num_samples[i])
+                    : num_samples[i];
+        }
+    }
     for (size_t i = 0; i < m_inference_config.get_tensor_output_shape().size(); ++i) {
         if (m_inference_config.get_postprocess_output_size()[i] > 0) {
             int const missing_samples_before = static_cast<int>(m_missing_samples[i]);
             while (m_missing_samples[i]) {
-                if (m_session->m_receive_buffer[i].get_available_samples(0) > num_samples[i]) {
+                if (m_session->m_receive_buffer[i].get_available_samples(0) >
+                    m_required_samples[i]) {
                     for (size_t channel = 0;
                          channel < m_inference_config.get_postprocess_output_channels()[i];
                          ++channel) {
@@ -140,17 +493,17 @@ size_t* InferenceManager::process_output(float* const* const* output_data, size_
                 }
             }
             if (missing_samples_before - m_missing_samples[i] > 0) {
-                LOG_INFO << "[WARNING] Catch up missing samples: "
-                         << missing_samples_before - m_missing_samples[i]
-                         << " in session: " << m_session->m_session_id << " for tensor index: " << i
-                         << "!" << '\n';
+                LOG_RT_WARNING("Catch up missing samples: %d in session: %d for tensor index: %zu!",
+                               missing_samples_before - static_cast<int>(m_missing_samples[i]),
+                               m_session->m_session_id,
+                               i);
             }
         }
     }
     bool enough_samples = true;
     for (size_t i = 0; i < m_inference_config.get_tensor_output_shape().size(); ++i) {
         if (m_inference_config.get_postprocess_output_size()[i] > 0) {
-            if (m_session->m_receive_buffer[i].get_available_samples(0) < (size_t)num_samples[i]) {
+            if (m_session->m_receive_buffer[i].get_available_samples(0) < m_required_samples[i]) {
                 enough_samples = false;
                 break;
             }
@@ -160,7 +513,26 @@ size_t* InferenceManager::process_output(float* const* const* output_data, size_
         for (size_t tensor_index = 0;
              tensor_index < m_inference_config.get_tensor_output_shape().size();
              ++tensor_index) {
-            if (m_inference_config.get_postprocess_output_size()[tensor_index] > 0) {
+            if (m_inference_config.get_postprocess_output_size()[tensor_index] > 0 &&
+                m_session->m_resampling) {
+                BufferF& resampled = m_resampled_output[tensor_index];
+                size_t const num_required = m_required_samples[tensor_index];
+                for (size_t channel = 0;
+                     channel < m_inference_config.get_postprocess_output_channels()[tensor_index];
+                     ++channel) {
+                    for (size_t sample = 0; sample < num_required; ++sample) {
+                        resampled.set_sample(
+                            channel,
+                            sample,
+                            m_session->m_receive_buffer[tensor_index].pop_sample(channel));
+                    }
+                }
+                m_session->m_receive_resampler[tensor_index].process(
+                    resampled.get_array_of_read_pointers(),
+                    num_required,
+                    output_data[tensor_index],
+                    num_samples[tensor_index]);
+            } else if (m_inference_config.get_postprocess_output_size()[tensor_index] > 0) {
                 for (size_t channel = 0;
                      channel < m_inference_config.get_postprocess_output_channels()[tensor_index];
                      ++channel) {
@@ -169,13 +541,11 @@ size_t* InferenceManager::process_output(float* const* const* output_data, size_
                             m_session->m_receive_buffer[tensor_index].pop_sample(channel);
                     }
                 }
-            } else {
-                for (size_t sample = 0; sample < num_samples[tensor_index]; ++sample) {
-                    output_data[tensor_index][0][sample] =
-                        m_pp_processor.get_output(tensor_index, sample);  // Non-streamable
-                                                                          // parameters have no
-                                                                          // channel count
-                }
+            } else if (num_samples[tensor_index] > 0) {
+                // Non-streamable parameters have no channel count
+                m_pp_processor.get_output_tensor(output_data[tensor_index][0],
+                                                 tensor_index,
+                                                 num_samples[tensor_index]);
             }
         }
         return num_samples;
@@ -183,10 +553,12 @@ size_t* InferenceManager::process_output(float* const* const* output_data, size_
         clear_data(output_data, num_samples, m_inference_config.get_postprocess_output_channels());
         for (size_t i = 0; i < m_inference_config.get_tensor_output_shape().size(); ++i) {
             if (m_inference_config.get_postprocess_output_size()[i] > 0) {
-                m_missing_samples[i] += num_samples[i];
-                LOG_INFO << "[WARNING] Missing samples: " << m_missing_samples[i]
-                         << " in session: " << m_session->m_session_id << " for tensor index: " << i
-                         << "!" << '\n';
+                m_missing_samples[i] += m_required_samples[i];
+                m_session->m_statistics.record_missing_samples(num_samples[i]);
+                LOG_RT_WARNING("Missing samples: %zu in session: %d for tensor index: %zu!",
+                               m_missing_samples[i],
+                               m_session->m_session_id,
+                               i);
             }
             num_samples[i] = 0;  // Set num_samples to 0 if not enough samples are available
         }
@@ -194,6 +566,14 @@ size_t* InferenceManager::process_output(float* const* const* output_data, size_
     }
 }
 
+size_t InferenceManager::get_num_free_structs() const {
+    size_t num_free_structs = 0;
+    for (const auto& thread_safe_struct : m_session->m_inference_queue) {
+        if (thread_safe_struct->m_free.load(std::memory_order::acquire)) { num_free_structs++; }
+    }
+    return num_free_structs;
+}
+
 void InferenceManager::clear_data(float* const* const* data,
                                   size_t* num_samples,
                                   const std::vector<size_t>& num_channels) {
@@ -213,7 +593,20 @@ void InferenceManager::clear_data(float* const* const* data,
 }
 
 std::vector<unsigned int> InferenceManager::get_latency() const {
-    return m_session->m_latency;
+    return m_session->m_host_latency;
+}
+
+InferenceStatistics InferenceManager::get_statistics() const {
+    return m_session->m_statistics.snapshot(m_session->m_session_id,
+                                            m_session->m_deadline_ns.load(std::memory_order_relaxed));
+}
+
+void InferenceManager::reset_statistics() {
+    m_session->m_statistics.reset();
+}
+
+MemoryFootprint InferenceManager::get_memory_footprint() const {
+    return m_session->get_memory_footprint();
 }
 
 const Context& InferenceManager::get_context() const {
@@ -223,7 +616,13 @@ const Context& InferenceManager::get_context() const {
 size_t InferenceManager::get_available_samples(size_t tensor_index, size_t channel) const {
     m_context->new_data_request(m_session);
     if (m_inference_config.get_postprocess_output_size()[tensor_index] > 0) {
-        return m_session->m_receive_buffer[tensor_index].get_available_samples(channel);
+        size_t const num_samples =
+            m_session->m_receive_buffer[tensor_index].get_available_samples(channel);
+        if (m_session->m_resampling) {
+            return m_session->m_receive_resampler[tensor_index].get_num_output_samples(
+                num_samples);
+        }
+        return num_samples;
     } else {
         return 0;
     }
@@ -2,7 +2,10 @@
 #include <anira/scheduler/SessionElement.h>
 #include <anira/utils/Buffer.h>
 #include <anira/utils/InferenceBackend.h>
+#include <anira/utils/InputRecorder.h>
 #include <anira/utils/Logger.h>
+#include <anira/utils/MemoryLock.h>
+#include <anira/utils/Tracer.h>
 #include <concurrentqueue.h>
 
 // IWYU pragma: keep - processor methods are called through SessionElement's shared_ptr members
@@ -28,8 +31,11 @@
 
 namespace anira {
 
-InferenceThread::InferenceThread(moodycamel::ConcurrentQueue<InferenceData>& next_inference)
-    : m_next_inference(next_inference), m_consumer_token(next_inference) {}
+InferenceThread::InferenceThread(moodycamel::ConcurrentQueue<InferenceData>& next_inference,
+                                 bool lock_stack)
+    : m_next_inference(next_inference)
+    , m_consumer_token(next_inference)
+    , m_lock_stack(lock_stack) {}
 
 InferenceThread::~InferenceThread() {
     stop();
@@ -60,6 +66,14 @@ bool InferenceThread::is_running() const {
 #endif
 
 void InferenceThread::run_loop() {
+    // Locked at the shallowest frame of the thread, so the inferences run on the locked pages
+    if (m_lock_stack && !m_stack_locked.load(std::memory_order_acquire)) {
+        if (!MemoryLock::lock_stack(m_stack_lock_status)) {
+            LOG_ERROR << "Inference thread: " << m_stack_lock_status.m_errors.back()
+                      << ", the stack is only prefaulted" << '\n';
+        }
+        m_stack_locked.store(true, std::memory_order_release);
+    }
     while (!should_exit()) {
         constexpr std::array<int, 2> k_iterations = {4, 32};
         // The times for the exponential backoff. The first loop is insteadly trying to acquire the
@@ -69,6 +83,11 @@ void InferenceThread::run_loop() {
     }
 }
 
+MemoryLockStatus InferenceThread::get_stack_lock_status() const {
+    if (!m_stack_locked.load(std::memory_order_acquire)) { return {}; }
+    return m_stack_lock_status;
+}
+
 void InferenceThread::exponential_backoff(std::array<int, 2> iterations) {
     for (int i = 0; i < iterations[0]; i++) {
         if (should_exit()) { return; }
@@ -113,6 +132,9 @@ void InferenceThread::exponential_backoff(std::array<int, 2> iterations) {
 
 bool InferenceThread::execute() {
     if (m_next_inference.try_dequeue(m_consumer_token, m_inference_data)) {
+        ANIRA_TRACE_INSTANT("dequeue",
+                            m_inference_data.m_session->m_session_id,
+                            static_cast<long>(m_inference_data.m_thread_safe_struct->m_time_stamp));
         if (m_inference_data.m_session->m_initialized.load(std::memory_order::acquire)) {
             do_inference(m_inference_data.m_session, m_inference_data.m_thread_safe_struct);
         }
@@ -125,14 +147,49 @@ void InferenceThread::do_inference(
     const std::shared_ptr<SessionElement>& session,
     const std::shared_ptr<SessionElement::ThreadSafeStruct>& thread_safe_struct) {
     session->m_active_inferences.fetch_add(1, std::memory_order::release);
-    inference(session,
-              thread_safe_struct->m_tensor_input_data,
-              thread_safe_struct->m_tensor_output_data);
+    InferenceBackend const backend = session->m_current_backend.load(std::memory_order_relaxed);
+    auto const submit_time = thread_safe_struct->m_submit_time;
+    // The recorded inputs are replayed straight into the backend, so they are captured as
+    // features in its layout
+    session->analyze_input_spectra(*thread_safe_struct);
+    session->transform_input_layout(*thread_safe_struct, backend);
+    RecordedInference* const record =
+        InputRecorder::capture(thread_safe_struct->m_tensor_input_data);
+    auto const inference_start = std::chrono::steady_clock::now();
+    {
+        ANIRA_TRACE_SCOPE("inference",
+                          session->m_session_id,
+                          static_cast<long>(thread_safe_struct->m_time_stamp));
+        inference(session,
+                  backend,
+                  thread_safe_struct->m_tensor_input_data,
+                  thread_safe_struct->m_tensor_output_data);
+    }
+    auto const inference_end = std::chrono::steady_clock::now();
+    session->transform_output_layout(*thread_safe_struct, backend);
+    session->synthesize_output_spectra(*thread_safe_struct);
+    auto const queue_wait_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(inference_start - submit_time).count();
+    auto const inference_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(inference_end - inference_start)
+            .count();
+    InputRecorder::commit(record,
+                          session->m_session_id,
+                          backend,
+                          thread_safe_struct->m_time_stamp,
+                          queue_wait_ns,
+                          inference_ns);
+    // The struct may be reused by the audio thread as soon as it is marked done, so the submit
+    // time has been copied above
     if (session->m_inference_config.m_blocking_ratio > 0.f) {
         thread_safe_struct->m_done_semaphore.release();
     } else {
         thread_safe_struct->m_done_atomic.store(true, std::memory_order::release);
     }
+    session->m_statistics.record_inference(backend,
+                                           queue_wait_ns,
+                                           inference_ns,
+                                           session->m_deadline_ns.load(std::memory_order_relaxed));
     session->m_active_inferences.fetch_sub(1, std::memory_order::release);
 
     // Session-exclusive processors: this task is fully done (its state write has
@@ -144,7 +201,7 @@ void InferenceThread::do_inference(
         if (auto next = session->try_acquire_next_dispatch()) {
             if (!m_next_inference.try_enqueue(
                     InferenceData{.m_session = session, .m_thread_safe_struct = next})) {
-                LOG_ERROR << "[ERROR] Could not enqueue next inference!" << '\n';
+                LOG_RT_ERROR("Could not enqueue next inference!");
                 session->release_dispatch();
             }
         }
@@ -152,53 +209,50 @@ void InferenceThread::do_inference(
 }
 
 void InferenceThread::inference(const std::shared_ptr<SessionElement>& session,
+                                InferenceBackend backend,
                                 std::vector<BufferF>& input,
                                 std::vector<BufferF>& output) {
 #ifdef USE_LIBTORCH
-    if (session->m_current_backend.load(std::memory_order_relaxed) == LIBTORCH) {
+    if (backend == LIBTORCH) {
         if (session->m_libtorch_processor != nullptr) {
             session->m_libtorch_processor->process(input, output, session);
         } else {
             session->m_default_processor.process(input, output, session);
-            LOG_ERROR << "[ERROR] LibTorch model has not been provided. Using default processor."
-                      << '\n';
+            LOG_RT_ERROR("LibTorch model has not been provided. Using default processor.");
         }
     }
 #endif
 #ifdef USE_ONNXRUNTIME
-    if (session->m_current_backend.load(std::memory_order_relaxed) == ONNX) {
+    if (backend == ONNX) {
         if (session->m_onnx_processor != nullptr) {
             session->m_onnx_processor->process(input, output, session);
         } else {
             session->m_default_processor.process(input, output, session);
-            LOG_ERROR << "[ERROR] OnnxRuntime model has not been provided. Using default processor."
-                      << '\n';
+            LOG_RT_ERROR("OnnxRuntime model has not been provided. Using default processor.");
         }
     }
 #endif
 #ifdef USE_TFLITE
-    if (session->m_current_backend.load(std::memory_order_relaxed) == TFLITE) {
+    if (backend == TFLITE) {
         if (session->m_tflite_processor != nullptr) {
             session->m_tflite_processor->process(input, output, session);
         } else {
             session->m_default_processor.process(input, output, session);
-            LOG_ERROR << "[ERROR] TFLite model has not been provided. Using default processor."
-                      << '\n';
+            LOG_RT_ERROR("TFLite model has not been provided. Using default processor.");
         }
     }
 #endif
 #ifdef USE_LITERT
-    if (session->m_current_backend.load(std::memory_order_relaxed) == LITERT) {
+    if (backend == LITERT) {
         if (session->m_litert_processor != nullptr) {
             session->m_litert_processor->process(input, output, session);
         } else {
             session->m_default_processor.process(input, output, session);
-            LOG_ERROR << "[ERROR] LiteRT model has not been provided. Using default processor."
-                      << '\n';
+            LOG_RT_ERROR("LiteRT model has not been provided. Using default processor.");
         }
     }
 #endif
-    if (session->m_current_backend.load(std::memory_order_relaxed) == CUSTOM) {
+    if (backend == CUSTOM) {
         session->m_custom_processor->process(input, output, session);
     }
 }
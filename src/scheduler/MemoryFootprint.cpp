@@ -0,0 +1,28 @@
+#include <anira/scheduler/MemoryFootprint.h>
+
+#include <cstddef>
+
+namespace anira {
+
+size_t BackendMemoryFootprint::get_total_bytes() const {
+    return m_tensor_bytes + m_model_bytes;
+}
+
+size_t MemoryFootprint::get_total_bytes() const {
+    size_t total =
+        m_send_buffer_bytes + m_receive_buffer_bytes + m_struct_tensor_bytes + m_cache_bytes;
+    for (const auto& backend : m_backends) { total += backend.get_total_bytes(); }
+    return total;
+}
+
+size_t ContextMemoryFootprint::get_total_bytes() const {
+    size_t total = 0;
+    for (const auto& session : m_sessions) {
+        total += session.m_send_buffer_bytes + session.m_receive_buffer_bytes +
+                 session.m_struct_tensor_bytes + session.m_cache_bytes;
+    }
+    for (const auto& processor : m_processors) { total += processor.get_total_bytes(); }
+    return total;
+}
+
+}  // namespace anira
@@ -0,0 +1,495 @@
+#include <anira/ContextConfig.h>
+#include <anira/InferenceConfig.h>
+#include <anira/PrePostProcessor.h>
+#include <anira/scheduler/SchedulerSimulator.h>
+#include <anira/scheduler/SessionElement.h>
+#include <anira/utils/Histogram.h>
+#include <anira/utils/HostConfig.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <vector>
+
+namespace anira {
+
+namespace {
+
+// Events at the same time are handled in this order, so completions are visible to the callbacks
+// and a callback submits before its own output is collected
+enum EventType { DONE, START, CALLBACK, OUTPUT };
+
+struct Event {
+    double m_time = 0.;
+    EventType m_type = DONE;
+    size_t m_index = 0;
+    uint64_t m_order = 0;
+
+    bool operator>(const Event& other) const {
+        if (m_time != other.m_time) { return m_time > other.m_time; }
+        if (m_type != other.m_type) { return m_type > other.m_type; }
+        return m_order > other.m_order;
+    }
+};
+
+struct Task {
+    size_t m_session = 0;
+    uint64_t m_sequence = 0;
+};
+
+struct Inference {
+    double m_submit_time = 0.;
+    bool m_done = false;
+};
+
+enum ThreadActivity { IDLE, WAKING, BUSY };
+
+struct ThreadState {
+    ThreadActivity m_activity = IDLE;
+    Task m_task;
+    double m_busy_time = 0.;
+};
+
+struct SessionState {
+    double m_period = 0.;
+    double m_offset = 0.;
+    double m_input_per_callback = 0.;
+    double m_output_per_callback = 0.;
+    double m_window = 0.;
+    double m_output_per_inference = 0.;
+    double m_blocking_time = 0.;
+    double m_deadline = 0.;
+    bool m_exclusive = false;
+    size_t m_processor = 0;
+
+    double m_input = 0.;
+    double m_receive = 0.;
+    double m_missing = 0.;
+    size_t m_free_structs = 0;
+    uint64_t m_first_sequence = 0;
+    std::deque<Inference> m_inferences;
+    std::deque<Task> m_pending;
+    bool m_dispatched = false;
+    Histogram m_completion;
+};
+
+}  // namespace
+
+struct SchedulerSimulator::Session {
+    InferenceConfig m_inference_config;
+    HostConfig m_host_config;
+    InferenceTimeDistribution m_inference_time;
+    std::chrono::microseconds m_offset;
+    std::unique_ptr<PrePostProcessor> m_pp_processor;
+    std::unique_ptr<SessionElement> m_session_element;
+};
+
+InferenceTimeDistribution InferenceTimeDistribution::constant(double time_ms) {
+    InferenceTimeDistribution distribution;
+    distribution.m_type = CONSTANT;
+    distribution.m_first = time_ms;
+    return distribution;
+}
+
+InferenceTimeDistribution InferenceTimeDistribution::normal(double mean_ms, double std_dev_ms) {
+    InferenceTimeDistribution distribution;
+    distribution.m_type = NORMAL;
+    distribution.m_first = mean_ms;
+    distribution.m_second = std_dev_ms;
+    return distribution;
+}
+
+InferenceTimeDistribution InferenceTimeDistribution::log_normal(double mean_ms,
+                                                                double std_dev_ms) {
+    if (mean_ms <= 0.) { return constant(0.); }
+    // Parameters of the underlying normal distribution that yield the requested moments
+    double const variance = std::log(1. + (std_dev_ms * std_dev_ms) / (mean_ms * mean_ms));
+    InferenceTimeDistribution distribution;
+    distribution.m_type = LOG_NORMAL;
+    distribution.m_first = std::log(mean_ms) - variance / 2.;
+    distribution.m_second = std::sqrt(variance);
+    return distribution;
+}
+
+InferenceTimeDistribution InferenceTimeDistribution::empirical(
+    const std::vector<double>& samples_ms) {
+    InferenceTimeDistribution distribution;
+    distribution.m_type = EMPIRICAL;
+    double weight = 0.;
+    for (double const sample : samples_ms) {
+        distribution.m_lower_bounds.push_back(sample);
+        distribution.m_upper_bounds.push_back(sample);
+        distribution.m_cumulative_weights.push_back(++weight);
+    }
+    return distribution;
+}
+
+InferenceTimeDistribution InferenceTimeDistribution::from_histogram(
+    const HistogramSnapshot& snapshot) {
+    InferenceTimeDistribution distribution;
+    distribution.m_type = EMPIRICAL;
+    double weight = 0.;
+    for (size_t i = 0; i < Histogram::k_num_buckets; ++i) {
+        if (snapshot.m_buckets[i] == 0) { continue; }
+        uint64_t const lower = i == 0 ? 0 : Histogram::bucket_upper_bound(i - 1) + 1;
+        uint64_t const upper = Histogram::bucket_upper_bound(i);
+        distribution.m_lower_bounds.push_back(
+            static_cast<double>(std::clamp(lower, snapshot.m_min, snapshot.m_max)) / 1e6);
+        distribution.m_upper_bounds.push_back(
+            static_cast<double>(std::clamp(upper, snapshot.m_min, snapshot.m_max)) / 1e6);
+        weight += static_cast<double>(snapshot.m_buckets[i]);
+        distribution.m_cumulative_weights.push_back(weight);
+    }
+    return distribution;
+}
+
+double InferenceTimeDistribution::sample(std::mt19937_64& generator) const {
+    switch (m_type) {
+        case CONSTANT:
+            return m_first;
+        case NORMAL:
+            return std::max(std::normal_distribution<double>(m_first, m_second)(generator), 0.);
+        case LOG_NORMAL:
+            return std::lognormal_distribution<double>(m_first, m_second)(generator);
+        case EMPIRICAL: {
+            if (m_cumulative_weights.empty()) { return 0.; }
+            double const weight = std::uniform_real_distribution<double>(
+                0.,
+                m_cumulative_weights.back())(generator);
+            auto const bin = static_cast<size_t>(
+                std::upper_bound(m_cumulative_weights.begin(), m_cumulative_weights.end(), weight) -
+                m_cumulative_weights.begin());
+            size_t const index = std::min(bin, m_cumulative_weights.size() - 1);
+            if (m_lower_bounds[index] >= m_upper_bounds[index]) { return m_lower_bounds[index]; }
+            return std::uniform_real_distribution<double>(m_lower_bounds[index],
+                                                          m_upper_bounds[index])(generator);
+        }
+    }
+    return 0.;
+}
+
+double SimulatedSessionResult::get_deadline_miss_rate() const {
+    if (m_num_inferences == 0) { return 0.; }
+    return static_cast<double>(m_deadline_misses) / static_cast<double>(m_num_inferences);
+}
+
+double SimulatedSessionResult::get_underrun_rate() const {
+    if (m_num_callbacks == 0) { return 0.; }
+    return static_cast<double>(m_underruns) / static_cast<double>(m_num_callbacks);
+}
+
+double SimulationResult::get_deadline_miss_rate() const {
+    uint64_t misses = 0;
+    uint64_t inferences = 0;
+    for (const auto& session : m_sessions) {
+        misses += session.m_deadline_misses;
+        inferences += session.m_num_inferences;
+    }
+    return inferences == 0 ? 0. : static_cast<double>(misses) / static_cast<double>(inferences);
+}
+
+double SimulationResult::get_underrun_rate() const {
+    uint64_t underruns = 0;
+    uint64_t callbacks = 0;
+    for (const auto& session : m_sessions) {
+        underruns += session.m_underruns;
+        callbacks += session.m_num_callbacks;
+    }
+    return callbacks == 0 ? 0. : static_cast<double>(underruns) / static_cast<double>(callbacks);
+}
+
+SchedulerSimulator::SchedulerSimulator(const ContextConfig& context_config, uint64_t seed)
+    : m_num_threads(std::max(context_config.m_num_threads, 1u)), m_seed(seed) {}
+
+SchedulerSimulator::~SchedulerSimulator() = default;
+
+size_t SchedulerSimulator::add_session(const InferenceConfig& inference_config,
+                                       const HostConfig& host_config,
+                                       const InferenceTimeDistribution& inference_time,
+                                       std::chrono::microseconds offset) {
+    auto session = std::make_unique<Session>(Session{
+        .m_inference_config = inference_config,
+        .m_host_config = host_config,
+        .m_inference_time = inference_time,
+        .m_offset = offset,
+        .m_pp_processor = nullptr,
+        .m_session_element = nullptr,
+    });
+    // The session element calculates the latency and number of structs exactly like a prepared
+    // session, it is never registered with the Context
+    session->m_pp_processor = std::make_unique<PrePostProcessor>(session->m_inference_config);
+    session->m_session_element =
+        std::make_unique<SessionElement>(static_cast<int>(m_sessions.size()),
+                                         *session->m_pp_processor,
+                                         session->m_inference_config);
+    session->m_session_element->prepare(host_config);
+    m_sessions.push_back(std::move(session));
+    return m_sessions.size() - 1;
+}
+
+void SchedulerSimulator::clear_sessions() {
+    m_sessions.clear();
+}
+
+SimulationResult SchedulerSimulator::run(std::chrono::milliseconds duration) {
+    std::mt19937_64 generator(m_seed);
+    double const end_time = std::chrono::duration<double>(duration).count();
+    double const poll_interval = std::chrono::duration<double>(k_poll_interval).count();
+
+    SimulationResult result;
+    result.m_sessions.resize(m_sessions.size());
+    std::vector<SessionState> states(m_sessions.size());
+
+    // Sessions with equal configs share a processor unless it is session exclusive
+    std::vector<std::vector<double>> processors;
+    for (size_t s = 0; s < m_sessions.size(); ++s) {
+        const Session& session = *m_sessions[s];
+        const InferenceConfig& config = session.m_inference_config;
+        const SessionElement& element = *session.m_session_element;
+        const HostConfig& host_config = session.m_host_config;
+        SessionState& state = states[s];
+        SimulatedSessionResult& session_result = result.m_sessions[s];
+
+        size_t const input_index = host_config.m_tensor_index;
+        size_t output_index = 0;
+        for (size_t i = 0; i < config.get_postprocess_output_size().size(); ++i) {
+            if (config.get_postprocess_output_size()[i] > 0) {
+                output_index = i;
+                break;
+            }
+        }
+
+        state.m_period = static_cast<double>(host_config.m_buffer_size) /
+                         static_cast<double>(host_config.m_sample_rate);
+        state.m_offset = std::chrono::duration<double>(session.m_offset).count();
+        state.m_input_per_callback =
+            host_config.get_relative_buffer_size(config, input_index, true);
+        state.m_output_per_callback =
+            host_config.get_relative_buffer_size(config, output_index, false);
+        state.m_window = static_cast<double>(config.get_preprocess_input_size()[input_index]);
+        state.m_output_per_inference =
+            static_cast<double>(config.get_postprocess_output_size()[output_index]);
+        state.m_blocking_time = static_cast<double>(config.m_blocking_ratio) * state.m_period;
+        state.m_deadline =
+            static_cast<double>(element.m_deadline_ns.load(std::memory_order_relaxed)) / 1e9;
+        state.m_exclusive = config.m_session_exclusive_processor;
+        state.m_free_structs = element.m_num_structs;
+        if (state.m_output_per_inference > 0.) {
+            // The receive buffer starts with the zeros prepare() pushes for the latency
+            state.m_receive = static_cast<double>(element.m_latency[output_index] -
+                                                  element.get_internal_latency(output_index));
+        }
+
+        state.m_processor = processors.size();
+        if (!state.m_exclusive) {
+            for (size_t other = 0; other < s; ++other) {
+                if (!states[other].m_exclusive &&
+                    m_sessions[other]->m_inference_config == config) {
+                    state.m_processor = states[other].m_processor;
+                    break;
+                }
+            }
+        }
+        if (state.m_processor == processors.size()) {
+            processors.emplace_back(std::max(config.m_num_parallel_processors, 1u), 0.);
+        }
+
+        session_result.m_latency = element.m_latency[output_index];
+        session_result.m_num_structs = element.m_num_structs;
+        session_result.m_deadline_ns = element.m_deadline_ns.load(std::memory_order_relaxed);
+    }
+
+    std::priority_queue<Event, std::vector<Event>, std::greater<>> events;
+    uint64_t order = 0;
+    auto const schedule = [&](double time, EventType type, size_t index) {
+        events.push(Event{.m_time = time, .m_type = type, .m_index = index, .m_order = order++});
+    };
+
+    std::vector<ThreadState> threads(m_num_threads);
+    std::deque<Task> queue;
+
+    auto const start_task = [&](size_t t, double time) {
+        ThreadState& thread = threads[t];
+        thread.m_task = queue.front();
+        queue.pop_front();
+        thread.m_activity = BUSY;
+
+        // A processor without a free instance keeps the thread spinning until one is released
+        std::vector<double>& instances = processors[states[thread.m_task.m_session].m_processor];
+        auto const instance = std::min_element(instances.begin(), instances.end());
+        double const begin = std::max(time, *instance);
+        double const end =
+            begin + m_sessions[thread.m_task.m_session]->m_inference_time.sample(generator) / 1e3;
+        *instance = end;
+        thread.m_busy_time += end - time;
+        schedule(end, DONE, t);
+    };
+
+    auto const enqueue = [&](const Task& task, double time) {
+        queue.push_back(task);
+        for (size_t t = 0; t < threads.size(); ++t) {
+            if (threads[t].m_activity == IDLE) {
+                threads[t].m_activity = WAKING;
+                schedule(time +
+                             std::uniform_real_distribution<double>(0., poll_interval)(generator),
+                         START,
+                         t);
+                return;
+            }
+        }
+    };
+
+    for (size_t s = 0; s < states.size(); ++s) { schedule(states[s].m_offset, CALLBACK, s); }
+    std::vector<uint64_t> num_callbacks(states.size(), 0);
+
+    while (!events.empty()) {
+        Event const event = events.top();
+        events.pop();
+
+        switch (event.m_type) {
+            case START: {
+                ThreadState& thread = threads[event.m_index];
+                if (queue.empty()) {
+                    thread.m_activity = IDLE;
+                } else {
+                    start_task(event.m_index, event.m_time);
+                }
+                break;
+            }
+            case DONE: {
+                Task const task = threads[event.m_index].m_task;
+                SessionState& state = states[task.m_session];
+                SimulatedSessionResult& session_result = result.m_sessions[task.m_session];
+                Inference& inference = state.m_inferences[task.m_sequence - state.m_first_sequence];
+                inference.m_done = true;
+
+                double const completion = event.m_time - inference.m_submit_time;
+                state.m_completion.record(static_cast<uint64_t>(completion * 1e9));
+                session_result.m_num_inferences++;
+                if (state.m_deadline > 0. && completion > state.m_deadline) {
+                    session_result.m_deadline_misses++;
+                }
+
+                if (state.m_exclusive) {
+                    state.m_dispatched = false;
+                    if (!state.m_pending.empty()) {
+                        state.m_dispatched = true;
+                        enqueue(state.m_pending.front(), event.m_time);
+                        state.m_pending.pop_front();
+                    }
+                }
+
+                if (queue.empty()) {
+                    threads[event.m_index].m_activity = IDLE;
+                } else {
+                    start_task(event.m_index, event.m_time);
+                }
+                break;
+            }
+            case CALLBACK: {
+                SessionState& state = states[event.m_index];
+                SimulatedSessionResult& session_result = result.m_sessions[event.m_index];
+                session_result.m_num_callbacks++;
+
+                state.m_input += state.m_input_per_callback;
+                while (state.m_window > 0. && state.m_input >= state.m_window) {
+                    state.m_input -= state.m_window;
+                    if (state.m_free_structs == 0) {
+                        session_result.m_dropped_inferences++;
+                        state.m_receive += state.m_output_per_inference;
+                        continue;
+                    }
+                    state.m_free_structs--;
+                    state.m_inferences.push_back(Inference{.m_submit_time = event.m_time});
+                    Task const task{.m_session = event.m_index,
+                                    .m_sequence =
+                                        state.m_first_sequence + state.m_inferences.size() - 1};
+                    if (!state.m_exclusive) {
+                        enqueue(task, event.m_time);
+                    } else if (state.m_dispatched) {
+                        state.m_pending.push_back(task);
+                    } else {
+                        state.m_dispatched = true;
+                        enqueue(task, event.m_time);
+                    }
+                }
+
+                schedule(event.m_time + state.m_blocking_time, OUTPUT, event.m_index);
+                // Callback times are derived from the count, so rounding errors do not accumulate
+                double const next_callback =
+                    state.m_offset +
+                    static_cast<double>(++num_callbacks[event.m_index]) * state.m_period;
+                if (next_callback < end_time) { schedule(next_callback, CALLBACK, event.m_index); }
+                break;
+            }
+            case OUTPUT: {
+                SessionState& state = states[event.m_index];
+                SimulatedSessionResult& session_result = result.m_sessions[event.m_index];
+
+                // Results are post-processed in submission order
+                while (!state.m_inferences.empty() && state.m_inferences.front().m_done) {
+                    state.m_inferences.pop_front();
+                    state.m_first_sequence++;
+                    state.m_free_structs++;
+                    state.m_receive += state.m_output_per_inference;
+                }
+                if (state.m_output_per_inference <= 0.) { break; }
+
+                // Samples that were zero-filled before are skipped as soon as there is a surplus
+                double const surplus =
+                    std::max(state.m_receive - state.m_output_per_callback, 0.);
+                double const catch_up = std::min(state.m_missing, surplus);
+                state.m_missing -= catch_up;
+                state.m_receive -= catch_up;
+
+                if (state.m_receive >= state.m_output_per_callback) {
+                    state.m_receive -= state.m_output_per_callback;
+                } else {
+                    session_result.m_underruns++;
+                    session_result.m_missing_samples +=
+                        static_cast<uint64_t>(std::ceil(state.m_output_per_callback));
+                    state.m_missing += state.m_output_per_callback;
+                }
+                break;
+            }
+        }
+    }
+
+    double busy_time = 0.;
+    for (const auto& thread : threads) { busy_time += thread.m_busy_time; }
+    if (end_time > 0.) {
+        result.m_thread_utilization =
+            std::min(busy_time / (end_time * static_cast<double>(threads.size())), 1.);
+    }
+    for (size_t s = 0; s < states.size(); ++s) {
+        result.m_sessions[s].m_completion = states[s].m_completion.snapshot();
+    }
+    return result;
+}
+
+size_t SchedulerSimulator::find_max_sessions(const InferenceConfig& inference_config,
+                                             const HostConfig& host_config,
+                                             const InferenceTimeDistribution& inference_time,
+                                             std::chrono::milliseconds duration,
+                                             double max_underrun_rate,
+                                             size_t max_sessions) {
+    clear_sessions();
+    for (size_t num_sessions = 1; num_sessions <= max_sessions; ++num_sessions) {
+        add_session(inference_config, host_config, inference_time);
+        if (run(duration).get_underrun_rate() > max_underrun_rate) {
+            clear_sessions();
+            return num_sessions - 1;
+        }
+    }
+    clear_sessions();
+    return max_sessions;
+}
+
+}  // namespace anira
@@ -1,7 +1,19 @@
 #include <anira/InferenceConfig.h>
 #include <anira/PrePostProcessor.h>
+#include <anira/scheduler/Context.h>
+#include <anira/scheduler/InferenceCache.h>
+#include <anira/scheduler/MemoryFootprint.h>
 #include <anira/scheduler/SessionElement.h>
+#include <anira/utils/Arena.h>
 #include <anira/utils/HostConfig.h>
+#include <anira/utils/LayoutTransform.h>
+#include <anira/utils/Logger.h>
+#include <anira/utils/MemoryLock.h>
+#include <anira/utils/Resampler.h>
+#include <anira/utils/ResamplerQuality.h>
+#include <anira/utils/SpectralSpec.h>
+#include <anira/utils/SpectralTransform.h>
+#include <anira/utils/TensorLayout.h>
 
 #ifdef USE_LIBTORCH
 #include <anira/backends/LibTorchProcessor.h>
@@ -20,12 +32,59 @@
 #include <atomic>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <new>
 #include <utility>
 #include <vector>
 
 namespace anira {
 
+namespace {
+
+// Gets the channels and samples of the blocks of a channels-last tensor, returns false if the
+// blocks have a single row or column and need no transposition
+bool get_channels_last_block(const std::vector<int64_t>& shape,
+                             size_t& num_channels,
+                             size_t& num_samples) {
+    if (shape.size() < 2) { return false; }
+    num_samples = static_cast<size_t>(shape[shape.size() - 2]);
+    num_channels = static_cast<size_t>(shape.back());
+    return num_channels > 1 && num_samples > 1;
+}
+
+void transform_layout(std::vector<BufferF>& tensors,
+                      std::vector<BufferF>& scratch,
+                      const TensorShapeList& shapes,
+                      bool to_channels_last) {
+    for (size_t i = 0; i < tensors.size() && i < scratch.size() && i < shapes.size(); ++i) {
+        size_t num_channels = 0;
+        size_t num_samples = 0;
+        if (scratch[i].get_num_samples() == 0 ||
+            !get_channels_last_block(shapes[i], num_channels, num_samples)) {
+            continue;
+        }
+        size_t const block_size = num_channels * num_samples;
+        size_t const num_blocks = tensors[i].get_num_samples() / block_size;
+        const float* source = tensors[i].get_read_pointer(0);
+        float* destination = scratch[i].get_write_pointer(0);
+        for (size_t block = 0; block < num_blocks; ++block) {
+            size_t const offset = block * block_size;
+            if (to_channels_last) {
+                LayoutTransform::transpose(
+                    source + offset, destination + offset, num_channels, num_samples);
+            } else {
+                LayoutTransform::transpose(
+                    source + offset, destination + offset, num_samples, num_channels);
+            }
+        }
+        // Exchanges the memory of owned tensors, tensors in an arena exchange their values
+        tensors[i].swap_data(scratch[i]);
+    }
+}
+
+}  // namespace
+
 SessionElement::SessionElement(int new_session_id,
                                PrePostProcessor& pp_processor,
                                InferenceConfig& inference_config)
@@ -35,6 +94,10 @@ SessionElement::SessionElement(int new_session_id,
     , m_default_processor(m_inference_config)
     , m_custom_processor(&m_default_processor) {}
 
+SessionElement::~SessionElement() {
+    unlock_memory();
+}
+
 SessionElement::ThreadSafeStruct::ThreadSafeStruct(const std::vector<size_t>& tensor_input_size,
                                                    const std::vector<size_t>& tensor_output_size) {
     m_tensor_input_data.clear();
@@ -43,9 +106,30 @@ SessionElement::ThreadSafeStruct::ThreadSafeStruct(const std::vector<size_t>& te
     for (unsigned long const& i : tensor_output_size) { m_tensor_output_data.emplace_back(1, i); }
 }
 
+SessionElement::ThreadSafeStruct::ThreadSafeStruct(const std::vector<size_t>& tensor_input_size,
+                                                   const std::vector<size_t>& tensor_output_size,
+                                                   Arena& arena) {
+    m_tensor_input_data.reserve(tensor_input_size.size());
+    m_tensor_output_data.reserve(tensor_output_size.size());
+    for (size_t const size : tensor_input_size) {
+        m_tensor_input_data.emplace_back(1, size, arena.allocate<float>(size));
+    }
+    for (size_t const size : tensor_output_size) {
+        m_tensor_output_data.emplace_back(1, size, arena.allocate<float>(size));
+    }
+}
+
+SessionElement::SessionArena::SessionArena(size_t capacity) : m_arena(capacity) {}
+
+SessionElement::SessionArena::~SessionArena() {
+    for (size_t i = 0; i < m_num_structs; ++i) { m_structs[i].~ThreadSafeStruct(); }
+}
+
 void SessionElement::clear() {
     for (auto& buffer : m_send_buffer) { buffer.clear_with_positions(); }
     for (auto& buffer : m_receive_buffer) { buffer.clear_with_positions(); }
+    for (auto& resampler : m_send_resampler) { resampler.reset(); }
+    for (auto& resampler : m_receive_resampler) { resampler.reset(); }
     m_time_stamps.clear();
     m_current_queue = 0;
 
@@ -65,14 +149,13 @@ void SessionElement::clear() {
         for (auto& input_data : inference->m_tensor_input_data) { input_data.clear(); }
         for (auto& output_data : inference->m_tensor_output_data) { output_data.clear(); }
     }
+    for (auto& tail : m_overlap_tail) { tail.clear(); }
 
     // Push back 0.f for latency
     for (size_t i = 0; i < m_inference_config.get_tensor_output_shape().size(); ++i) {
         if (m_latency[i] > 0) {
             for (size_t j = 0; j < m_inference_config.get_postprocess_output_channels()[i]; ++j) {
-                for (size_t k = 0;
-                     k < m_latency[i] - m_inference_config.get_internal_model_latency()[i];
-                     ++k) {
+                for (size_t k = 0; k < m_latency[i] - get_internal_latency(i); ++k) {
                     m_receive_buffer[i].push_sample(j, 0.f);
                 }
             }
@@ -110,8 +193,15 @@ void SessionElement::release_dispatch() {
     m_stateful_dispatch_busy.store(false, std::memory_order_release);
 }
 
-void SessionElement::prepare(const HostConfig& host_config, std::vector<long> custom_latency) {
-    m_host_config = host_config;
+void SessionElement::prepare(const HostConfig& spec, std::vector<long> custom_latency) {
+    m_host_config = spec;
+
+    // Behind the resamplers the ring buffers and the latency calculation run at the model rate
+    float const model_sample_rate = m_inference_config.get_model_sample_rate();
+    m_resampling = model_sample_rate > 0.f && spec.m_sample_rate > 0.f &&
+                   std::abs(model_sample_rate - spec.m_sample_rate) > 1e-3f;
+    HostConfig const host_config = m_resampling ? calculate_model_config(spec) : spec;
+    prepare_spectral_transforms(host_config);
 
     // Calculate the latency, number of structs needed
     m_latency.clear();
@@ -265,26 +355,61 @@ void SessionElement::prepare(const HostConfig& host_config, std::vector<long> cu
         }
     }
 
-    // Add the internal model latency to the latency
+    // Add the internal model latency and the overlap of the spectral stage to the latency
     for (size_t i = 0; i < m_inference_config.get_tensor_output_shape().size(); ++i) {
         if (m_inference_config.get_postprocess_output_size()[i] > 0) {
-            m_latency[i] += m_inference_config.get_internal_model_latency()[i];
+            m_latency[i] += get_internal_latency(i);
         }
     }
 
     // Overwrite with custom latency if provided
-    if (custom_latency.size() == m_inference_config.get_tensor_output_shape().size()) {
+    if (!m_resampling &&
+        custom_latency.size() == m_inference_config.get_tensor_output_shape().size()) {
         for (size_t i = 0; i < custom_latency.size(); ++i) {
             if (custom_latency[i] >= 0) { m_latency[i] = custom_latency[i]; }
         }
     }
 
+    if (m_resampling) {
+        prepare_resampling(spec, custom_latency);
+    } else {
+        m_send_resampler.clear();
+        m_receive_resampler.clear();
+        m_host_latency = m_latency;
+    }
+
     // Calculate the max size of the send and receive buffers
     m_send_buffer_size.clear();
     m_receive_buffer_size.clear();
     m_send_buffer_size = calculate_send_buffer_sizes(host_config);
     m_receive_buffer_size = calculate_receive_buffer_sizes(host_config);
 
+    // Spectral tensors exchange samples with the pre- and post-processing
+    std::vector<size_t> const tensor_input_size = calculate_signal_size(true);
+    std::vector<size_t> const tensor_output_size = calculate_signal_size(false);
+    std::vector<size_t> const layout_input_size = calculate_layout_scratch_size(true);
+    std::vector<size_t> const layout_output_size = calculate_layout_scratch_size(false);
+    std::vector<size_t> const spectral_input_size = calculate_spectral_size(true);
+    std::vector<size_t> const spectral_output_size = calculate_spectral_size(false);
+    size_t spectral_work_size = 0;
+    for (const auto& transform : m_input_transform) {
+        spectral_work_size = std::max(spectral_work_size, transform.get_work_size());
+    }
+    for (const auto& transform : m_output_transform) {
+        spectral_work_size = std::max(spectral_work_size, transform.get_work_size());
+    }
+
+    // In arena mode all buffers below are placed in a single slab. Structures of the previous
+    // slab still held by an inference keep it alive until they are released.
+    m_arena.reset();
+    if (m_use_arena) {
+        m_arena = std::make_shared<SessionArena>(
+            calculate_arena_size(tensor_input_size, tensor_output_size));
+    }
+    auto const allocate_samples = [this](size_t num_samples) -> float* {
+        return m_arena != nullptr ? m_arena->m_arena.allocate<float>(num_samples) : nullptr;
+    };
+
     // Resize the send and receive buffers
     m_send_buffer.clear();
     m_receive_buffer.clear();
@@ -293,18 +418,22 @@ void SessionElement::prepare(const HostConfig& host_config, std::vector<long> cu
 
     for (size_t i = 0; i < m_inference_config.get_tensor_input_shape().size(); ++i) {
         if (m_send_buffer_size[i] > 0) {
+            size_t const num_channels = m_inference_config.get_preprocess_input_channels()[i];
             m_send_buffer[i].initialize_with_positions(
-                m_inference_config.get_preprocess_input_channels()[i],
-                m_send_buffer_size[i]);
+                num_channels,
+                m_send_buffer_size[i],
+                allocate_samples(num_channels * m_send_buffer_size[i]));
         } else {
             m_send_buffer[i].clear_with_positions();
         }
     }
     for (size_t i = 0; i < m_inference_config.get_tensor_output_shape().size(); ++i) {
         if (m_receive_buffer_size[i] > 0) {
+            size_t const num_channels = m_inference_config.get_postprocess_output_channels()[i];
             m_receive_buffer[i].initialize_with_positions(
-                m_inference_config.get_postprocess_output_channels()[i],
-                m_receive_buffer_size[i]);
+                num_channels,
+                m_receive_buffer_size[i],
+                allocate_samples(num_channels * m_receive_buffer_size[i]));
         } else {
             m_receive_buffer[i].clear_with_positions();
         }
@@ -314,9 +443,7 @@ void SessionElement::prepare(const HostConfig& host_config, std::vector<long> cu
     for (size_t i = 0; i < m_inference_config.get_tensor_output_shape().size(); ++i) {
         if (m_latency[i] > 0) {
             for (size_t j = 0; j < m_inference_config.get_postprocess_output_channels()[i]; ++j) {
-                for (size_t k = 0;
-                     k < m_latency[i] - m_inference_config.get_internal_model_latency()[i];
-                     ++k) {
+                for (size_t k = 0; k < m_latency[i] - get_internal_latency(i); ++k) {
                     m_receive_buffer[i].push_sample(j, 0.f);
                 }
             }
@@ -326,16 +453,551 @@ void SessionElement::prepare(const HostConfig& host_config, std::vector<long> cu
     // Create the thread-safe structs for the inference queue
     m_inference_queue.clear();
 
-    std::vector<size_t> const tensor_input_size = m_inference_config.get_tensor_input_size();
-    std::vector<size_t> const tensor_output_size = m_inference_config.get_tensor_output_size();
+    auto const allocate_tensor = [&allocate_samples](size_t size) -> BufferF {
+        if (size == 0) { return BufferF(); }
+        if (float* const memory = allocate_samples(size)) { return BufferF(1, size, memory); }
+        return BufferF(1, size);
+    };
+    auto const add_tensors = [&allocate_tensor](std::vector<BufferF>& tensors,
+                                                const std::vector<size_t>& sizes) {
+        for (size_t const size : sizes) { tensors.push_back(allocate_tensor(size)); }
+    };
 
-    for (size_t i = 0; i < m_num_structs; ++i) {
-        m_inference_queue.emplace_back(
-            std::make_unique<ThreadSafeStruct>(tensor_input_size, tensor_output_size));
+    if (m_arena != nullptr) {
+        // The structures share the ownership of the slab they are constructed in
+        m_arena->m_structs = m_arena->m_arena.allocate<ThreadSafeStruct>(m_num_structs);
+        for (size_t i = 0; i < m_num_structs; ++i) {
+            ThreadSafeStruct* thread_safe_struct = new (m_arena->m_structs + i)
+                ThreadSafeStruct(tensor_input_size, tensor_output_size, m_arena->m_arena);
+            ++m_arena->m_num_structs;
+            m_inference_queue.emplace_back(m_arena, thread_safe_struct);
+        }
+    } else {
+        for (size_t i = 0; i < m_num_structs; ++i) {
+            m_inference_queue.emplace_back(
+                std::make_unique<ThreadSafeStruct>(tensor_input_size, tensor_output_size));
+        }
+    }
+    for (auto& thread_safe_struct : m_inference_queue) {
+        add_tensors(thread_safe_struct->m_layout_input_scratch, layout_input_size);
+        add_tensors(thread_safe_struct->m_layout_output_scratch, layout_output_size);
+        add_tensors(thread_safe_struct->m_spectral_input_data, spectral_input_size);
+        add_tensors(thread_safe_struct->m_spectral_output_data, spectral_output_size);
+        thread_safe_struct->m_spectral_work = allocate_tensor(spectral_work_size);
     }
 
     m_time_stamps.clear();
     m_time_stamps.reserve(m_num_structs);
+
+    // Skipping an inference would skip an update of the state a session-exclusive processor
+    // carries across calls
+    size_t num_cache_entries = m_memoization_cache_size;
+    if (num_cache_entries > 0 && m_inference_config.m_session_exclusive_processor) {
+        LOG_INFO << "Session " << m_session_id
+                 << ": memoization is disabled for session-exclusive processors" << '\n';
+        num_cache_entries = 0;
+    }
+    m_inference_cache.prepare(num_cache_entries, tensor_input_size, tensor_output_size);
+
+    m_deadline_ns.store(calculate_deadline_ns(host_config), std::memory_order_relaxed);
+}
+
+uint64_t SessionElement::calculate_deadline_ns(const HostConfig& host_config) const {
+    // The zeros pushed for latency cover the time until the first result is needed, so the
+    // tightest streamable output determines how long an inference may take
+    double deadline_s = 0.;
+    for (size_t i = 0; i < m_inference_config.get_tensor_output_shape().size(); ++i) {
+        if (m_inference_config.get_postprocess_output_size()[i] <= 0) { continue; }
+        size_t const internal_latency = get_internal_latency(i);
+        size_t const padding =
+            m_latency[i] > internal_latency ? m_latency[i] - internal_latency : 0;
+        float const sample_rate =
+            host_config.get_relative_sample_rate(m_inference_config, i, false);
+        if (padding == 0 || sample_rate <= 0.f) { continue; }
+        double const tensor_deadline_s = static_cast<double>(padding) / sample_rate;
+        if (deadline_s == 0. || tensor_deadline_s < deadline_s) { deadline_s = tensor_deadline_s; }
+    }
+    return static_cast<uint64_t>(deadline_s * 1e9);
+}
+
+size_t SessionElement::calculate_arena_size(const std::vector<size_t>& tensor_input_size,
+                                            const std::vector<size_t>& tensor_output_size) const {
+    size_t capacity = 0;
+    for (size_t i = 0; i < m_send_buffer_size.size(); ++i) {
+        capacity += Arena::get_aligned_size(m_inference_config.get_preprocess_input_channels()[i] *
+                                            m_send_buffer_size[i] * sizeof(float));
+    }
+    for (size_t i = 0; i < m_receive_buffer_size.size(); ++i) {
+        capacity +=
+            Arena::get_aligned_size(m_inference_config.get_postprocess_output_channels()[i] *
+                                    m_receive_buffer_size[i] * sizeof(float));
+    }
+
+    size_t struct_tensor_size = 0;
+    for (size_t const size : tensor_input_size) {
+        struct_tensor_size += Arena::get_aligned_size(size * sizeof(float));
+    }
+    for (size_t const size : tensor_output_size) {
+        struct_tensor_size += Arena::get_aligned_size(size * sizeof(float));
+    }
+    for (size_t const size : calculate_layout_scratch_size(true)) {
+        if (size > 0) { struct_tensor_size += Arena::get_aligned_size(size * sizeof(float)); }
+    }
+    for (size_t const size : calculate_layout_scratch_size(false)) {
+        if (size > 0) { struct_tensor_size += Arena::get_aligned_size(size * sizeof(float)); }
+    }
+    size_t spectral_work_size = 0;
+    for (size_t const size : calculate_spectral_size(true)) {
+        if (size > 0) { struct_tensor_size += Arena::get_aligned_size(size * sizeof(float)); }
+    }
+    for (size_t const size : calculate_spectral_size(false)) {
+        if (size > 0) { struct_tensor_size += Arena::get_aligned_size(size * sizeof(float)); }
+    }
+    for (const auto& transform : m_input_transform) {
+        spectral_work_size = std::max(spectral_work_size, transform.get_work_size());
+    }
+    for (const auto& transform : m_output_transform) {
+        spectral_work_size = std::max(spectral_work_size, transform.get_work_size());
+    }
+    if (spectral_work_size > 0) {
+        struct_tensor_size += Arena::get_aligned_size(spectral_work_size * sizeof(float));
+    }
+    capacity += Arena::get_aligned_size(m_num_structs * sizeof(ThreadSafeStruct)) +
+                m_num_structs * struct_tensor_size;
+    return capacity;
+}
+
+MemoryFootprint SessionElement::get_memory_footprint() const {
+    auto const get_num_bytes = [](const BufferF& buffer) {
+        return buffer.get_num_channels() * buffer.get_num_samples() * sizeof(float);
+    };
+
+    MemoryFootprint footprint;
+    footprint.m_session_id = m_session_id;
+    for (const auto& buffer : m_send_buffer) {
+        footprint.m_send_buffer_bytes += get_num_bytes(buffer);
+    }
+    for (const auto& buffer : m_receive_buffer) {
+        footprint.m_receive_buffer_bytes += get_num_bytes(buffer);
+    }
+    for (const auto& resampler : m_send_resampler) {
+        footprint.m_send_buffer_bytes += resampler.get_memory_size();
+    }
+    for (const auto& resampler : m_receive_resampler) {
+        footprint.m_receive_buffer_bytes += resampler.get_memory_size();
+    }
+    for (const auto& transform : m_input_transform) {
+        footprint.m_send_buffer_bytes += transform.get_memory_size();
+    }
+    for (const auto& transform : m_output_transform) {
+        footprint.m_receive_buffer_bytes += transform.get_memory_size();
+    }
+    for (const auto& tail : m_overlap_tail) {
+        footprint.m_receive_buffer_bytes += get_num_bytes(tail);
+    }
+
+    footprint.m_num_structs = m_inference_queue.size();
+    for (const auto& thread_safe_struct : m_inference_queue) {
+        for (const auto& tensor : thread_safe_struct->m_tensor_input_data) {
+            footprint.m_struct_tensor_bytes += get_num_bytes(tensor);
+        }
+        for (const auto& tensor : thread_safe_struct->m_tensor_output_data) {
+            footprint.m_struct_tensor_bytes += get_num_bytes(tensor);
+        }
+        for (const auto& tensor : thread_safe_struct->m_layout_input_scratch) {
+            footprint.m_struct_tensor_bytes += get_num_bytes(tensor);
+        }
+        for (const auto& tensor : thread_safe_struct->m_layout_output_scratch) {
+            footprint.m_struct_tensor_bytes += get_num_bytes(tensor);
+        }
+        for (const auto& tensor : thread_safe_struct->m_spectral_input_data) {
+            footprint.m_struct_tensor_bytes += get_num_bytes(tensor);
+        }
+        for (const auto& tensor : thread_safe_struct->m_spectral_output_data) {
+            footprint.m_struct_tensor_bytes += get_num_bytes(tensor);
+        }
+        footprint.m_struct_tensor_bytes += get_num_bytes(thread_safe_struct->m_spectral_work);
+    }
+    for (const auto& entry : m_inference_cache.get_entries()) {
+        for (const auto& tensor : entry.m_inputs) {
+            footprint.m_cache_bytes += get_num_bytes(tensor);
+        }
+        for (const auto& tensor : entry.m_outputs) {
+            footprint.m_cache_bytes += get_num_bytes(tensor);
+        }
+    }
+
+    // Sessions outside the Context only count themselves
+    auto const get_num_sessions = [](const BackendBase* processor) {
+        return std::max<size_t>(1, Context::get_num_sessions_using(processor));
+    };
+    [[maybe_unused]] auto const add_processor = [&](const auto& processor) {
+        if (processor == nullptr) { return; }
+        BackendMemoryFootprint backend = processor->get_memory_footprint();
+        backend.m_num_sessions = get_num_sessions(processor.get());
+        footprint.m_backends.push_back(backend);
+    };
+#ifdef USE_LIBTORCH
+    add_processor(m_libtorch_processor);
+#endif
+#ifdef USE_ONNXRUNTIME
+    add_processor(m_onnx_processor);
+#endif
+#ifdef USE_TFLITE
+    add_processor(m_tflite_processor);
+#endif
+#ifdef USE_LITERT
+    add_processor(m_litert_processor);
+#endif
+    if (m_custom_processor != &m_default_processor) {
+        BackendMemoryFootprint backend = m_custom_processor->get_memory_footprint();
+        backend.m_backend = InferenceBackend::CUSTOM;
+        backend.m_num_sessions = get_num_sessions(m_custom_processor);
+        footprint.m_backends.push_back(backend);
+    }
+    return footprint;
+}
+
+void SessionElement::lock_memory() {
+    unlock_memory();
+    MemoryLockStatus status;
+    auto const lock = [this, &status](void* data, size_t bytes) {
+        if (MemoryLock::lock(data, bytes, status)) { m_locked_memory.emplace_back(data, bytes); }
+    };
+    auto const lock_buffer = [&lock](BufferF& buffer) {
+        lock(buffer.data(), buffer.get_num_channels() * buffer.get_num_samples() * sizeof(float));
+    };
+
+    if (m_arena != nullptr) {
+        lock(m_arena->m_arena.data(), m_arena->m_arena.get_capacity());
+    } else {
+        for (auto& buffer : m_send_buffer) { lock_buffer(buffer); }
+        for (auto& buffer : m_receive_buffer) { lock_buffer(buffer); }
+        for (auto& thread_safe_struct : m_inference_queue) {
+            for (auto& tensor : thread_safe_struct->m_tensor_input_data) { lock_buffer(tensor); }
+            for (auto& tensor : thread_safe_struct->m_tensor_output_data) { lock_buffer(tensor); }
+            for (auto& tensor : thread_safe_struct->m_layout_input_scratch) {
+                if (tensor.get_num_samples() > 0) { lock_buffer(tensor); }
+            }
+            for (auto& tensor : thread_safe_struct->m_layout_output_scratch) {
+                if (tensor.get_num_samples() > 0) { lock_buffer(tensor); }
+            }
+            for (auto& tensor : thread_safe_struct->m_spectral_input_data) {
+                if (tensor.get_num_samples() > 0) { lock_buffer(tensor); }
+            }
+            for (auto& tensor : thread_safe_struct->m_spectral_output_data) {
+                if (tensor.get_num_samples() > 0) { lock_buffer(tensor); }
+            }
+            if (thread_safe_struct->m_spectral_work.get_num_samples() > 0) {
+                lock_buffer(thread_safe_struct->m_spectral_work);
+            }
+        }
+    }
+    for (auto& tail : m_overlap_tail) {
+        if (tail.get_num_samples() > 0) { lock_buffer(tail); }
+    }
+    for (auto& entry : m_inference_cache.get_entries()) {
+        for (auto& tensor : entry.m_inputs) { lock_buffer(tensor); }
+        for (auto& tensor : entry.m_outputs) { lock_buffer(tensor); }
+    }
+
+    [[maybe_unused]] auto const lock_processor = [&status](const auto& processor) {
+        if (processor != nullptr) { status.merge(processor->lock_memory()); }
+    };
+#ifdef USE_LIBTORCH
+    lock_processor(m_libtorch_processor);
+#endif
+#ifdef USE_ONNXRUNTIME
+    lock_processor(m_onnx_processor);
+#endif
+#ifdef USE_TFLITE
+    lock_processor(m_tflite_processor);
+#endif
+#ifdef USE_LITERT
+    lock_processor(m_litert_processor);
+#endif
+    status.merge(m_custom_processor->lock_memory());
+
+    for (const auto& error : status.m_errors) {
+        LOG_ERROR << "Session " << m_session_id << ": " << error
+                  << ", the memory is only prefaulted" << '\n';
+    }
+    m_memory_lock_status = std::move(status);
+}
+
+void SessionElement::unlock_memory() {
+    for (const auto& [data, bytes] : m_locked_memory) { MemoryLock::unlock(data, bytes); }
+    m_locked_memory.clear();
+    m_memory_lock_status = {};
+}
+
+BackendBase& SessionElement::get_processor(InferenceBackend backend) {
+#ifdef USE_LIBTORCH
+    if (backend == LIBTORCH && m_libtorch_processor != nullptr) { return *m_libtorch_processor; }
+#endif
+#ifdef USE_ONNXRUNTIME
+    if (backend == ONNX && m_onnx_processor != nullptr) { return *m_onnx_processor; }
+#endif
+#ifdef USE_TFLITE
+    if (backend == TFLITE && m_tflite_processor != nullptr) { return *m_tflite_processor; }
+#endif
+#ifdef USE_LITERT
+    if (backend == LITERT && m_litert_processor != nullptr) { return *m_litert_processor; }
+#endif
+    if (backend == CUSTOM) { return *m_custom_processor; }
+    return m_default_processor;
+}
+
+bool SessionElement::uses_processor(const BackendBase* processor) const {
+#ifdef USE_LIBTORCH
+    if (m_libtorch_processor.get() == processor) { return true; }
+#endif
+#ifdef USE_ONNXRUNTIME
+    if (m_onnx_processor.get() == processor) { return true; }
+#endif
+#ifdef USE_TFLITE
+    if (m_tflite_processor.get() == processor) { return true; }
+#endif
+#ifdef USE_LITERT
+    if (m_litert_processor.get() == processor) { return true; }
+#endif
+    return processor != nullptr && m_custom_processor == processor;
+}
+
+void SessionElement::transform_input_layout(ThreadSafeStruct& thread_safe_struct,
+                                            InferenceBackend backend) {
+    if (m_inference_config.get_tensor_layout(backend) != CHANNELS_LAST) { return; }
+    transform_layout(thread_safe_struct.m_tensor_input_data,
+                     thread_safe_struct.m_layout_input_scratch,
+                     m_inference_config.get_tensor_input_shape(backend),
+                     true);
+}
+
+void SessionElement::transform_output_layout(ThreadSafeStruct& thread_safe_struct,
+                                             InferenceBackend backend) {
+    if (m_inference_config.get_tensor_layout(backend) != CHANNELS_LAST) { return; }
+    transform_layout(thread_safe_struct.m_tensor_output_data,
+                     thread_safe_struct.m_layout_output_scratch,
+                     m_inference_config.get_tensor_output_shape(backend),
+                     false);
+}
+
+std::vector<size_t> SessionElement::calculate_layout_scratch_size(bool input) const {
+    const std::vector<size_t>& tensor_size = input ? m_inference_config.get_tensor_input_size()
+                                                   : m_inference_config.get_tensor_output_size();
+    std::vector<size_t> scratch_size(tensor_size.size(), 0);
+    for (const TensorShape& tensor_shape : m_inference_config.m_tensor_shape) {
+        if (tensor_shape.is_universal() || tensor_shape.m_layout != CHANNELS_LAST) { continue; }
+        const TensorShapeList& shapes =
+            input ? tensor_shape.m_tensor_input_shape : tensor_shape.m_tensor_output_shape;
+        for (size_t i = 0; i < shapes.size() && i < scratch_size.size(); ++i) {
+            size_t num_channels = 0;
+            size_t num_samples = 0;
+            if (get_channels_last_block(shapes[i], num_channels, num_samples)) {
+                scratch_size[i] = tensor_size[i];
+            }
+        }
+    }
+    return scratch_size;
+}
+
+void SessionElement::analyze_input_spectra(ThreadSafeStruct& thread_safe_struct) {
+    float* work = thread_safe_struct.m_spectral_work.data();
+    for (size_t i = 0; i < m_input_transform.size(); ++i) {
+        if (!m_input_transform[i].is_enabled()) { continue; }
+        m_input_transform[i].analyze(
+            thread_safe_struct.m_tensor_input_data[i].get_read_pointer(0),
+            thread_safe_struct.m_spectral_input_data[i].get_write_pointer(0),
+            work);
+        // Exchanging the buffers moves no samples and allocates nothing
+        std::swap(thread_safe_struct.m_tensor_input_data[i],
+                  thread_safe_struct.m_spectral_input_data[i]);
+    }
+    for (size_t i = 0; i < m_output_transform.size(); ++i) {
+        if (!m_output_transform[i].is_enabled()) { continue; }
+        std::swap(thread_safe_struct.m_tensor_output_data[i],
+                  thread_safe_struct.m_spectral_output_data[i]);
+    }
+}
+
+void SessionElement::synthesize_output_spectra(ThreadSafeStruct& thread_safe_struct) {
+    float* work = thread_safe_struct.m_spectral_work.data();
+    for (size_t i = 0; i < m_output_transform.size(); ++i) {
+        if (!m_output_transform[i].is_enabled()) { continue; }
+        m_output_transform[i].synthesize(
+            thread_safe_struct.m_tensor_output_data[i].get_read_pointer(0),
+            thread_safe_struct.m_spectral_output_data[i].get_write_pointer(0),
+            work);
+        std::swap(thread_safe_struct.m_tensor_output_data[i],
+                  thread_safe_struct.m_spectral_output_data[i]);
+    }
+    for (size_t i = 0; i < m_input_transform.size(); ++i) {
+        if (!m_input_transform[i].is_enabled()) { continue; }
+        std::swap(thread_safe_struct.m_tensor_input_data[i],
+                  thread_safe_struct.m_spectral_input_data[i]);
+    }
+}
+
+void SessionElement::overlap_add_output_spectra(ThreadSafeStruct& thread_safe_struct) {
+    for (size_t i = 0; i < m_output_transform.size(); ++i) {
+        if (!m_output_transform[i].is_enabled()) { continue; }
+        m_output_transform[i].overlap_add(
+            thread_safe_struct.m_tensor_output_data[i].get_write_pointer(0),
+            m_overlap_tail[i].get_write_pointer(0));
+    }
+}
+
+size_t SessionElement::get_internal_latency(size_t tensor_index) const {
+    size_t latency = m_inference_config.get_internal_model_latency()[tensor_index];
+    if (tensor_index < m_output_transform.size() &&
+        m_output_transform[tensor_index].is_enabled()) {
+        latency += m_output_transform[tensor_index].get_overlap();
+    }
+    return latency;
+}
+
+std::vector<size_t> SessionElement::calculate_signal_size(bool input) const {
+    std::vector<size_t> signal_size = input ? m_inference_config.get_tensor_input_size()
+                                            : m_inference_config.get_tensor_output_size();
+    const std::vector<SpectralTransform>& transforms =
+        input ? m_input_transform : m_output_transform;
+    for (size_t i = 0; i < signal_size.size() && i < transforms.size(); ++i) {
+        if (transforms[i].is_enabled()) { signal_size[i] = transforms[i].get_signal_size(); }
+    }
+    return signal_size;
+}
+
+std::vector<size_t> SessionElement::calculate_spectral_size(bool input) const {
+    const std::vector<size_t>& tensor_size = input ? m_inference_config.get_tensor_input_size()
+                                                   : m_inference_config.get_tensor_output_size();
+    const std::vector<SpectralTransform>& transforms =
+        input ? m_input_transform : m_output_transform;
+    std::vector<size_t> spectral_size(tensor_size.size(), 0);
+    for (size_t i = 0; i < spectral_size.size() && i < transforms.size(); ++i) {
+        if (transforms[i].is_enabled()) { spectral_size[i] = tensor_size[i]; }
+    }
+    return spectral_size;
+}
+
+void SessionElement::prepare_spectral_transforms(const HostConfig& host_config) {
+    size_t const num_input_tensors = m_inference_config.get_tensor_input_shape().size();
+    size_t const num_output_tensors = m_inference_config.get_tensor_output_shape().size();
+    const std::vector<SpectralSpec>& input_spec = m_inference_config.get_input_spectral_spec();
+    const std::vector<SpectralSpec>& output_spec = m_inference_config.get_output_spectral_spec();
+
+    m_input_transform.clear();
+    m_input_transform.resize(num_input_tensors);
+    for (size_t i = 0; i < num_input_tensors && i < input_spec.size(); ++i) {
+        if (m_inference_config.get_preprocess_input_size()[i] == 0) { continue; }
+        m_input_transform[i].prepare(
+            input_spec[i],
+            m_inference_config.get_preprocess_input_channels()[i],
+            m_inference_config.get_preprocess_input_size()[i],
+            host_config.get_relative_sample_rate(m_inference_config, i, true));
+    }
+
+    m_output_transform.clear();
+    m_output_transform.resize(num_output_tensors);
+    m_overlap_tail.clear();
+    m_overlap_tail.resize(num_output_tensors);
+    for (size_t i = 0; i < num_output_tensors && i < output_spec.size(); ++i) {
+        if (m_inference_config.get_postprocess_output_size()[i] == 0) { continue; }
+        m_output_transform[i].prepare(
+            output_spec[i],
+            m_inference_config.get_postprocess_output_channels()[i],
+            m_inference_config.get_postprocess_output_size()[i],
+            host_config.get_relative_sample_rate(m_inference_config, i, false));
+        if (m_output_transform[i].get_tail_size() > 0) {
+            m_overlap_tail[i] = BufferF(1, m_output_transform[i].get_tail_size());
+        }
+    }
+}
+
+HostConfig SessionElement::calculate_model_config(const HostConfig& host_config) const {
+    float const ratio = m_inference_config.get_model_sample_rate() / host_config.m_sample_rate;
+    HostConfig model_config = host_config;
+    model_config.m_sample_rate = m_inference_config.get_model_sample_rate();
+    // A block of n host samples completes the floor or the ceiling of n * ratio model samples
+    model_config.m_buffer_size = std::ceil(host_config.m_buffer_size * ratio);
+    model_config.m_allow_smaller_buffers = true;
+    return model_config;
+}
+
+void SessionElement::prepare_resampling(const HostConfig& host_config,
+                                        const std::vector<long>& custom_latency) {
+    double const host_sample_rate = host_config.m_sample_rate;
+    double const model_sample_rate = m_inference_config.get_model_sample_rate();
+    double const ratio = model_sample_rate / host_sample_rate;
+    ResamplerQuality const quality = m_inference_config.get_resampler_quality();
+    size_t const num_input_tensors = m_inference_config.get_tensor_input_shape().size();
+    size_t const num_output_tensors = m_inference_config.get_tensor_output_shape().size();
+
+    m_send_resampler.clear();
+    m_send_resampler.resize(num_input_tensors);
+    double send_latency = 0.;
+    for (size_t i = 0; i < num_input_tensors; ++i) {
+        if (m_inference_config.get_preprocess_input_size()[i] == 0) { continue; }
+        auto const max_block_size = static_cast<size_t>(
+            std::ceil(host_config.get_relative_buffer_size(m_inference_config, i, true)));
+        m_send_resampler[i].prepare(m_inference_config.get_preprocess_input_channels()[i],
+                                    host_sample_rate,
+                                    model_sample_rate,
+                                    quality,
+                                    max_block_size);
+        send_latency = m_send_resampler[i].get_latency();
+    }
+
+    m_receive_resampler.clear();
+    m_receive_resampler.resize(num_output_tensors);
+    m_host_latency.assign(num_output_tensors, 0);
+    for (size_t i = 0; i < num_output_tensors; ++i) {
+        if (m_inference_config.get_postprocess_output_size()[i] == 0) { continue; }
+        auto const max_block_size = static_cast<size_t>(
+            std::ceil(host_config.get_relative_buffer_size(m_inference_config, i, false)));
+        // A block pulls one model sample more than it spans and the phase offset reads up to
+        // ratio model samples ahead
+        auto const max_num_model_samples =
+            static_cast<size_t>(std::ceil(static_cast<double>(max_block_size) * ratio) +
+                                std::ceil(ratio)) +
+            2;
+        Resampler& resampler = m_receive_resampler[i];
+        resampler.prepare(m_inference_config.get_postprocess_output_channels()[i],
+                          model_sample_rate,
+                          host_sample_rate,
+                          quality,
+                          max_num_model_samples);
+
+        // With L / M the reduced ratio of the host to the model rate, the delay of both filters
+        // in units of 1/L model samples is a whole number, since the taps are even
+        uint64_t const interpolation = resampler.get_interpolation_factor();
+        uint64_t const decimation = resampler.get_decimation_factor();
+        auto const filter_delay = static_cast<uint64_t>(
+            std::llround(send_latency * static_cast<double>(interpolation) +
+                         resampler.get_latency() * static_cast<double>(decimation)));
+
+        uint64_t model_latency = 0;
+        if (custom_latency.size() == num_output_tensors && custom_latency[i] >= 0) {
+            uint64_t const target = static_cast<uint64_t>(custom_latency[i]) * decimation;
+            if (target > filter_delay) {
+                model_latency = (target - filter_delay + interpolation - 1) / interpolation;
+            }
+            model_latency = std::max<uint64_t>(model_latency, get_internal_latency(i));
+        } else {
+            model_latency = m_latency[i] + static_cast<uint64_t>(std::ceil(ratio)) + 2;
+        }
+
+        // The phase offset cuts the total delay down to the whole host samples below it
+        uint64_t const total_delay = model_latency * interpolation + filter_delay;
+        uint64_t const host_latency = total_delay / decimation;
+        resampler.set_phase_offset(total_delay - host_latency * decimation);
+        m_latency[i] = static_cast<unsigned int>(model_latency);
+        m_host_latency[i] = static_cast<unsigned int>(host_latency);
+    }
+}
+
+float SessionElement::get_max_inference_time() const {
+    return m_calibrated_max_inference_time > 0.f ? m_calibrated_max_inference_time
+                                                 : m_inference_config.m_max_inference_time;
 }
 
 template <typename T>
@@ -365,7 +1027,7 @@ void SessionElement::set_processor(std::shared_ptr<T>& processor) {
 size_t SessionElement::calculate_num_structs(const HostConfig& host_config) const {
     // Now calculate the number of structs necessary to keep the inference queues filled
     float const max_inference_time_in_samples =
-        m_inference_config.m_max_inference_time * host_config.m_sample_rate / 1000;
+        get_max_inference_time() * host_config.m_sample_rate / 1000;
     int const new_samples_needed_for_inference = static_cast<int>(
         m_inference_config.get_preprocess_input_size()[host_config.m_tensor_index]);
     int const max_possible_inferences = (int)max_num_inferences(host_config);
@@ -470,13 +1132,14 @@ int SessionElement::calculate_inference_caused_latency(float max_possible_infere
                   static_cast<float>(m_inference_config.m_num_parallel_processors)));
     float already_inferred = 0;
     float wait_time_left = wait_time;
+    float const max_inference_time = get_max_inference_time();
 
     for (unsigned int i = 0; i < max_inference_batches; ++i) {
-        inference_time_left += m_inference_config.m_max_inference_time;
+        inference_time_left += max_inference_time;
 
-        if (wait_time_left >= m_inference_config.m_max_inference_time) {
+        if (wait_time_left >= max_inference_time) {
             already_inferred += static_cast<float>(m_inference_config.m_num_parallel_processors);
-            wait_time_left -= m_inference_config.m_max_inference_time;
+            wait_time_left -= max_inference_time;
         }
 
         if (host_buffer_time_int > 0) {
@@ -578,7 +1241,7 @@ std::vector<size_t> SessionElement::calculate_send_buffer_sizes(
                                             preprocess_input_size);
             int const past_samples_needed = std::max(
                 static_cast<int>(
-                    static_cast<float>(m_inference_config.get_tensor_input_size()[i]) /
+                    static_cast<float>(calculate_signal_size(true)[i]) /
                     static_cast<float>(m_inference_config.get_preprocess_input_channels()[i])) -
                     preprocess_input_size,
                 0);
@@ -0,0 +1,77 @@
+#include <anira/scheduler/SessionStatistics.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace anira {
+
+void SessionStatistics::record_inference(InferenceBackend backend,
+                                         uint64_t queue_wait_ns,
+                                         uint64_t inference_ns,
+                                         uint64_t deadline_ns) {
+    size_t const index = static_cast<size_t>(backend);
+    if (index < k_num_backends) {
+        m_backends[index].m_queue_wait.record(queue_wait_ns);
+        m_backends[index].m_inference.record(inference_ns);
+    }
+
+    if (deadline_ns > 0) {
+        uint64_t const completion_ns = queue_wait_ns + inference_ns;
+        m_completion.record(completion_ns * 100 / deadline_ns);
+        if (completion_ns > deadline_ns) {
+            m_deadline_misses.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+void SessionStatistics::record_pre_process(uint64_t duration_ns) {
+    m_pre_process.record(duration_ns);
+}
+
+void SessionStatistics::record_post_process(uint64_t duration_ns) {
+    m_post_process.record(duration_ns);
+}
+
+void SessionStatistics::record_missing_samples(uint64_t num_samples) {
+    m_missing_samples.record(num_samples);
+}
+
+void SessionStatistics::record_memoized_inference() {
+    m_memoized_inferences.fetch_add(1, std::memory_order_relaxed);
+}
+
+InferenceStatistics SessionStatistics::snapshot(int session_id, uint64_t deadline_ns) const {
+    InferenceStatistics statistics;
+    statistics.m_session_id = session_id;
+    statistics.m_deadline_ns = deadline_ns;
+    for (size_t i = 0; i < k_num_backends; ++i) {
+        HistogramSnapshot inference = m_backends[i].m_inference.snapshot();
+        if (inference.m_count == 0) { continue; }
+        statistics.m_backends.push_back({static_cast<InferenceBackend>(i),
+                                         m_backends[i].m_queue_wait.snapshot(),
+                                         inference});
+    }
+    statistics.m_pre_process = m_pre_process.snapshot();
+    statistics.m_post_process = m_post_process.snapshot();
+    statistics.m_completion = m_completion.snapshot();
+    statistics.m_missing_samples = m_missing_samples.snapshot();
+    statistics.m_deadline_misses = m_deadline_misses.load(std::memory_order_relaxed);
+    statistics.m_memoized_inferences = m_memoized_inferences.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+void SessionStatistics::reset() {
+    for (auto& backend : m_backends) {
+        backend.m_queue_wait.reset();
+        backend.m_inference.reset();
+    }
+    m_pre_process.reset();
+    m_post_process.reset();
+    m_completion.reset();
+    m_missing_samples.reset();
+    m_deadline_misses.store(0, std::memory_order_relaxed);
+    m_memoized_inferences.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace anira
@@ -0,0 +1,63 @@
+#include <anira/utils/AlignedAllocator.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace anira {
+
+namespace {
+
+std::atomic<bool> s_huge_pages_enabled{false};
+
+}  // namespace
+
+void* AlignedAllocator::allocate(std::size_t bytes, std::size_t alignment) {
+    if (bytes == 0) { return nullptr; }
+    alignment = std::max(alignment, alignof(std::max_align_t));
+
+#if defined(__linux__)
+    bool const use_huge_pages =
+        s_huge_pages_enabled.load(std::memory_order_relaxed) && bytes >= k_huge_page_size;
+    if (use_huge_pages) { alignment = std::max(alignment, k_huge_page_size); }
+#endif
+
+#if defined(_WIN32)
+    void* data = _aligned_malloc(bytes, alignment);
+#else
+    void* data = nullptr;
+    if (posix_memalign(&data, alignment, bytes) != 0) { data = nullptr; }
+#endif
+
+#if defined(__linux__)
+    // Only a hint, the kernel falls back to regular pages if transparent huge pages are disabled
+    if (data != nullptr && use_huge_pages) { madvise(data, bytes, MADV_HUGEPAGE); }
+#endif
+    return data;
+}
+
+void AlignedAllocator::deallocate(void* data) noexcept {
+#if defined(_WIN32)
+    _aligned_free(data);
+#else
+    free(data);
+#endif
+}
+
+void AlignedAllocator::set_huge_pages_enabled(bool enabled) {
+    s_huge_pages_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool AlignedAllocator::is_huge_pages_enabled() {
+    return s_huge_pages_enabled.load(std::memory_order_relaxed);
+}
+
+}  // namespace anira
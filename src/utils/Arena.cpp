@@ -0,0 +1,49 @@
+#include <anira/utils/Arena.h>
+#include <anira/utils/Logger.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace anira {
+
+Arena::Arena(size_t capacity) : m_memory(capacity) {}
+
+void* Arena::allocate_bytes(size_t bytes) {
+    if (bytes == 0) { return nullptr; }
+    size_t const aligned_size = get_aligned_size(bytes);
+    if (m_memory.data() == nullptr || aligned_size > m_memory.size() - m_used) {
+        LOG_ERROR << "Arena of " << m_memory.size() << " bytes is exhausted!" << '\n';
+        return nullptr;
+    }
+    void* data = m_memory.data() + m_used;
+    m_used += aligned_size;
+    return data;
+}
+
+void Arena::reset() {
+    m_used = 0;
+}
+
+const std::byte* Arena::data() const {
+    return m_memory.data();
+}
+
+std::byte* Arena::data() {
+    return m_memory.data();
+}
+
+size_t Arena::get_capacity() const {
+    return m_memory.size();
+}
+
+size_t Arena::get_used() const {
+    return m_used;
+}
+
+bool Arena::contains(const void* data) const {
+    auto const begin = reinterpret_cast<uintptr_t>(m_memory.data());
+    auto const address = reinterpret_cast<uintptr_t>(data);
+    return begin != 0 && address >= begin && address - begin < m_memory.size();
+}
+
+}  // namespace anira
@@ -0,0 +1,209 @@
+#include <anira/utils/FFT.h>
+#include <anira/utils/Logger.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64)
+#include <immintrin.h>
+#define ANIRA_FFT_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define ANIRA_FFT_NEON
+#endif
+
+namespace anira {
+
+void FFT::prepare(size_t size) {
+    if (size < 4 || (size & (size - 1)) != 0) {
+        LOG_ERROR << "FFT: The size " << size << " is not a power of two of at least 4." << '\n';
+        m_size = 0;
+        return;
+    }
+    m_size = size;
+    size_t const num_complex = size / 2;
+
+    size_t num_bits = 0;
+    while ((static_cast<size_t>(1) << num_bits) < num_complex) { ++num_bits; }
+    m_bit_reverse.resize(num_complex);
+    for (size_t i = 0; i < num_complex; ++i) {
+        size_t reversed = 0;
+        for (size_t bit = 0; bit < num_bits; ++bit) {
+            reversed |= ((i >> bit) & 1) << (num_bits - 1 - bit);
+        }
+        m_bit_reverse[i] = static_cast<uint32_t>(reversed);
+    }
+
+    // The stage combining groups of half butterflies uses the half twiddles of a 2 * half FFT
+    m_twiddle_real.clear();
+    m_twiddle_imag.clear();
+    for (size_t half = 1; half < num_complex; half *= 2) {
+        for (size_t j = 0; j < half; ++j) {
+            double const angle = -std::numbers::pi * static_cast<double>(j) /
+                                 static_cast<double>(half);
+            m_twiddle_real.push_back(static_cast<float>(std::cos(angle)));
+            m_twiddle_imag.push_back(static_cast<float>(std::sin(angle)));
+        }
+    }
+
+    m_pack_real.resize(num_complex / 2 + 1);
+    m_pack_imag.resize(num_complex / 2 + 1);
+    for (size_t k = 0; k <= num_complex / 2; ++k) {
+        double const angle =
+            -2. * std::numbers::pi * static_cast<double>(k) / static_cast<double>(size);
+        m_pack_real[k] = static_cast<float>(std::cos(angle));
+        m_pack_imag[k] = static_cast<float>(std::sin(angle));
+    }
+}
+
+size_t FFT::get_size() const {
+    return m_size;
+}
+
+void FFT::forward(const float* input, float* real, float* imag) const {
+    size_t const num_complex = m_size / 2;
+    if (num_complex == 0) { return; }
+    // Even samples are the real parts, odd samples the imaginary parts of the packed signal
+    for (size_t i = 0; i < num_complex; ++i) {
+        size_t const index = 2 * static_cast<size_t>(m_bit_reverse[i]);
+        real[i] = input[index];
+        imag[i] = input[index + 1];
+    }
+    transform(real, imag);
+
+    // Splits the spectrum Z of the packed signal into the spectra E of the even and O of the odd
+    // samples, X[k] = E[k] + W^k O[k] and X[N/2 - k] = conj(E[k] - W^k O[k])
+    float const dc_real = real[0];
+    float const dc_imag = imag[0];
+    real[0] = dc_real + dc_imag;
+    imag[0] = 0.f;
+    real[num_complex] = dc_real - dc_imag;
+    imag[num_complex] = 0.f;
+    for (size_t k = 1; k < num_complex - k; ++k) {
+        size_t const mirror = num_complex - k;
+        float const even_real = 0.5f * (real[k] + real[mirror]);
+        float const even_imag = 0.5f * (imag[k] - imag[mirror]);
+        float const odd_real = 0.5f * (imag[k] + imag[mirror]);
+        float const odd_imag = -0.5f * (real[k] - real[mirror]);
+        float const twiddled_real = m_pack_real[k] * odd_real - m_pack_imag[k] * odd_imag;
+        float const twiddled_imag = m_pack_real[k] * odd_imag + m_pack_imag[k] * odd_real;
+        real[k] = even_real + twiddled_real;
+        imag[k] = even_imag + twiddled_imag;
+        real[mirror] = even_real - twiddled_real;
+        imag[mirror] = twiddled_imag - even_imag;
+    }
+    imag[num_complex / 2] = -imag[num_complex / 2];
+}
+
+void FFT::inverse(float* real, float* imag, float* output) const {
+    size_t const num_complex = m_size / 2;
+    if (num_complex == 0) { return; }
+    // Rebuilds the spectrum of the packed signal, Z[k] = E[k] + i O[k]
+    float const first = real[0];
+    float const last = real[num_complex];
+    real[0] = 0.5f * (first + last);
+    imag[0] = 0.5f * (first - last);
+    for (size_t k = 1; k < num_complex - k; ++k) {
+        size_t const mirror = num_complex - k;
+        float const even_real = 0.5f * (real[k] + real[mirror]);
+        float const even_imag = 0.5f * (imag[k] - imag[mirror]);
+        float const difference_real = 0.5f * (real[k] - real[mirror]);
+        float const difference_imag = 0.5f * (imag[k] + imag[mirror]);
+        float const odd_real =
+            m_pack_real[k] * difference_real + m_pack_imag[k] * difference_imag;
+        float const odd_imag =
+            m_pack_real[k] * difference_imag - m_pack_imag[k] * difference_real;
+        real[k] = even_real - odd_imag;
+        imag[k] = even_imag + odd_real;
+        real[mirror] = even_real + odd_imag;
+        imag[mirror] = odd_real - even_imag;
+    }
+    imag[num_complex / 2] = -imag[num_complex / 2];
+
+    // The inverse transform is the conjugate of the forward transform of the conjugate
+    for (size_t i = 0; i < num_complex; ++i) { imag[i] = -imag[i]; }
+    for (size_t i = 0; i < num_complex; ++i) {
+        size_t const reversed = m_bit_reverse[i];
+        if (i < reversed) {
+            std::swap(real[i], real[reversed]);
+            std::swap(imag[i], imag[reversed]);
+        }
+    }
+    transform(real, imag);
+    float const scale = 1.f / static_cast<float>(num_complex);
+    for (size_t i = 0; i < num_complex; ++i) {
+        output[2 * i] = real[i] * scale;
+        output[2 * i + 1] = -imag[i] * scale;
+    }
+}
+
+size_t FFT::get_memory_size() const {
+    return m_bit_reverse.size() * sizeof(uint32_t) +
+           (m_twiddle_real.size() + m_twiddle_imag.size() + m_pack_real.size() +
+            m_pack_imag.size()) *
+               sizeof(float);
+}
+
+void FFT::transform(float* real, float* imag) const {
+    size_t const num_complex = m_size / 2;
+    size_t offset = 0;
+    for (size_t half = 1; half < num_complex; half *= 2) {
+        const float* twiddle_real = m_twiddle_real.data() + offset;
+        const float* twiddle_imag = m_twiddle_imag.data() + offset;
+        for (size_t start = 0; start < num_complex; start += 2 * half) {
+            float* a_real = real + start;
+            float* a_imag = imag + start;
+            float* b_real = a_real + half;
+            float* b_imag = a_imag + half;
+            size_t j = 0;
+#if defined(ANIRA_FFT_SSE)
+            for (; j + 4 <= half; j += 4) {
+                __m128 const w_real = _mm_loadu_ps(twiddle_real + j);
+                __m128 const w_imag = _mm_loadu_ps(twiddle_imag + j);
+                __m128 const x_real = _mm_loadu_ps(b_real + j);
+                __m128 const x_imag = _mm_loadu_ps(b_imag + j);
+                __m128 const t_real =
+                    _mm_sub_ps(_mm_mul_ps(x_real, w_real), _mm_mul_ps(x_imag, w_imag));
+                __m128 const t_imag =
+                    _mm_add_ps(_mm_mul_ps(x_real, w_imag), _mm_mul_ps(x_imag, w_real));
+                __m128 const y_real = _mm_loadu_ps(a_real + j);
+                __m128 const y_imag = _mm_loadu_ps(a_imag + j);
+                _mm_storeu_ps(a_real + j, _mm_add_ps(y_real, t_real));
+                _mm_storeu_ps(a_imag + j, _mm_add_ps(y_imag, t_imag));
+                _mm_storeu_ps(b_real + j, _mm_sub_ps(y_real, t_real));
+                _mm_storeu_ps(b_imag + j, _mm_sub_ps(y_imag, t_imag));
+            }
+#elif defined(ANIRA_FFT_NEON)
+            for (; j + 4 <= half; j += 4) {
+                float32x4_t const w_real = vld1q_f32(twiddle_real + j);
+                float32x4_t const w_imag = vld1q_f32(twiddle_imag + j);
+                float32x4_t const x_real = vld1q_f32(b_real + j);
+                float32x4_t const x_imag = vld1q_f32(b_imag + j);
+                float32x4_t const t_real = vmlsq_f32(vmulq_f32(x_real, w_real), x_imag, w_imag);
+                float32x4_t const t_imag = vmlaq_f32(vmulq_f32(x_real, w_imag), x_imag, w_real);
+                float32x4_t const y_real = vld1q_f32(a_real + j);
+                float32x4_t const y_imag = vld1q_f32(a_imag + j);
+                vst1q_f32(a_real + j, vaddq_f32(y_real, t_real));
+                vst1q_f32(a_imag + j, vaddq_f32(y_imag, t_imag));
+                vst1q_f32(b_real + j, vsubq_f32(y_real, t_real));
+                vst1q_f32(b_imag + j, vsubq_f32(y_imag, t_imag));
+            }
+#endif
+            for (; j < half; ++j) {
+                float const t_real = b_real[j] * twiddle_real[j] - b_imag[j] * twiddle_imag[j];
+                float const t_imag = b_real[j] * twiddle_imag[j] + b_imag[j] * twiddle_real[j];
+                b_real[j] = a_real[j] - t_real;
+                b_imag[j] = a_imag[j] - t_imag;
+                a_real[j] += t_real;
+                a_imag[j] += t_imag;
+            }
+        }
+        offset += half;
+    }
+}
+
+}  // namespace anira
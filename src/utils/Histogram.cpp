@@ -0,0 +1,90 @@
+#include <anira/utils/Histogram.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace anira {
+
+void Histogram::record(uint64_t value) {
+    m_buckets[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t current_min = m_min.load(std::memory_order_relaxed);
+    while (value < current_min &&
+           !m_min.compare_exchange_weak(current_min, value, std::memory_order_relaxed)) {}
+    uint64_t current_max = m_max.load(std::memory_order_relaxed);
+    while (value > current_max &&
+           !m_max.compare_exchange_weak(current_max, value, std::memory_order_relaxed)) {}
+}
+
+void Histogram::reset() {
+    for (auto& bucket : m_buckets) { bucket.store(0, std::memory_order_relaxed); }
+    m_sum.store(0, std::memory_order_relaxed);
+    m_min.store(UINT64_MAX, std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
+
+HistogramSnapshot Histogram::snapshot() const {
+    // The count is the sum of the buckets, so it matches them even while values are recorded
+    HistogramSnapshot snapshot;
+    for (size_t i = 0; i < k_num_buckets; ++i) {
+        snapshot.m_buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+        snapshot.m_count += snapshot.m_buckets[i];
+    }
+    snapshot.m_sum = m_sum.load(std::memory_order_relaxed);
+    snapshot.m_max = m_max.load(std::memory_order_relaxed);
+    uint64_t const min = m_min.load(std::memory_order_relaxed);
+    snapshot.m_min = snapshot.m_count > 0 ? min : 0;
+    return snapshot;
+}
+
+size_t Histogram::bucket_index(uint64_t value) {
+    if (value < k_num_sub_buckets) { return static_cast<size_t>(value); }
+    // Values in [2^e, 2^(e+1)) are split into k_num_sub_buckets linear sub-buckets
+    size_t const exponent = static_cast<size_t>(std::bit_width(value)) - 1;
+    size_t const sub_bucket = static_cast<size_t>(value >> (exponent - 2)) & (k_num_sub_buckets - 1);
+    size_t const index = (exponent - 1) * k_num_sub_buckets + sub_bucket;
+    return std::min(index, k_num_buckets - 1);
+}
+
+uint64_t Histogram::bucket_upper_bound(size_t index) {
+    if (index < k_num_sub_buckets) { return index; }
+    if (index >= k_num_buckets - 1) { return UINT64_MAX; }
+    size_t const exponent = index / k_num_sub_buckets + 1;
+    uint64_t const sub_bucket = index % k_num_sub_buckets;
+    uint64_t const lower_bound = (k_num_sub_buckets + sub_bucket) << (exponent - 2);
+    return lower_bound + (uint64_t{1} << (exponent - 2)) - 1;
+}
+
+double HistogramSnapshot::get_mean() const {
+    if (m_count == 0) { return 0.; }
+    return static_cast<double>(m_sum) / static_cast<double>(m_count);
+}
+
+uint64_t HistogramSnapshot::get_percentile(double percentile) const {
+    if (m_count == 0) { return 0; }
+    percentile = std::clamp(percentile, 0., 100.);
+    auto const target = static_cast<uint64_t>(
+        std::max(std::ceil(percentile / 100. * static_cast<double>(m_count)), 1.));
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < Histogram::k_num_buckets; ++i) {
+        cumulative += m_buckets[i];
+        if (cumulative >= target) { return std::min(Histogram::bucket_upper_bound(i), m_max); }
+    }
+    return m_max;
+}
+
+void HistogramSnapshot::merge(const HistogramSnapshot& other) {
+    if (other.m_count == 0) { return; }
+    for (size_t i = 0; i < Histogram::k_num_buckets; ++i) { m_buckets[i] += other.m_buckets[i]; }
+    m_min = m_count == 0 ? other.m_min : std::min(m_min, other.m_min);
+    m_max = std::max(m_max, other.m_max);
+    m_count += other.m_count;
+    m_sum += other.m_sum;
+}
+
+}  // namespace anira
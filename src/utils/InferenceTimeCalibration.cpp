@@ -0,0 +1,343 @@
+#include <anira/InferenceConfig.h>
+#include <anira/backends/BackendBase.h>
+#include <anira/utils/Buffer.h>
+#include <anira/utils/InferenceBackend.h>
+#include <anira/utils/InferenceTimeCalibration.h>
+#include <anira/utils/Logger.h>
+
+#ifdef USE_LIBTORCH
+#include <anira/backends/LibTorchProcessor.h>
+#endif
+#ifdef USE_ONNXRUNTIME
+#include <anira/backends/OnnxRuntimeProcessor.h>
+#endif
+#ifdef USE_TFLITE
+#include <anira/backends/TFLiteProcessor.h>
+#endif
+#ifdef USE_LITERT
+#include <anira/backends/LiteRtProcessor.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <nlohmann/json_fwd.hpp>  // IWYU pragma: keep - declares the nlohmann::json type name
+#include <random>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+
+#if defined(__APPLE__)
+#include <sys/sysctl.h>
+#endif
+
+namespace anira {
+
+namespace {
+
+// Serializes the read-modify-write of the cache file within the process
+std::mutex s_mutex;
+
+// The enum values depend on the backends that are compiled in, so the cache uses fixed names
+const char* get_backend_name(InferenceBackend backend) {
+    switch (backend) {
+#ifdef USE_LIBTORCH
+        case InferenceBackend::LIBTORCH:
+            return "libtorch";
+#endif
+#ifdef USE_ONNXRUNTIME
+        case InferenceBackend::ONNX:
+            return "onnx";
+#endif
+#ifdef USE_TFLITE
+        case InferenceBackend::TFLITE:
+            return "tflite";
+#endif
+#ifdef USE_LITERT
+        case InferenceBackend::LITERT:
+            return "litert";
+#endif
+        default:
+            return "custom";
+    }
+}
+
+std::string get_cpu_name() {
+#if defined(_WIN32)
+    if (const char* identifier = std::getenv("PROCESSOR_IDENTIFIER")) { return identifier; }
+#elif defined(__APPLE__)
+    char brand[256] = {};
+    size_t size = sizeof(brand);
+    if (sysctlbyname("machdep.cpu.brand_string", brand, &size, nullptr, 0) == 0) {
+        return brand;
+    }
+#else
+    // x86 reports the "model name", many ARM kernels only the "Hardware"
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    std::string hardware;
+    while (std::getline(cpuinfo, line)) {
+        size_t const colon = line.find(':');
+        if (colon == std::string::npos || colon + 2 > line.size()) { continue; }
+        std::string const value = line.substr(colon + 2);
+        if (line.rfind("model name", 0) == 0) { return value; }
+        if (line.rfind("Hardware", 0) == 0) { hardware = value; }
+    }
+    if (!hardware.empty()) { return hardware; }
+#endif
+    return "unknown";
+}
+
+uint64_t hash_bytes(const void* data, size_t size) {
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// Creates and prepares a processor of a built-in backend, nullptr for custom processors
+std::unique_ptr<BackendBase> make_processor([[maybe_unused]] InferenceConfig& inference_config,
+                                            InferenceBackend backend) {
+    std::unique_ptr<BackendBase> processor;
+    switch (backend) {
+#ifdef USE_LIBTORCH
+        case InferenceBackend::LIBTORCH:
+            processor = std::make_unique<LibtorchProcessor>(inference_config);
+            break;
+#endif
+#ifdef USE_ONNXRUNTIME
+        case InferenceBackend::ONNX:
+            processor = std::make_unique<OnnxRuntimeProcessor>(inference_config);
+            break;
+#endif
+#ifdef USE_TFLITE
+        case InferenceBackend::TFLITE:
+            processor = std::make_unique<TFLiteProcessor>(inference_config);
+            break;
+#endif
+#ifdef USE_LITERT
+        case InferenceBackend::LITERT:
+            processor = std::make_unique<LiteRtProcessor>(inference_config);
+            break;
+#endif
+        default:
+            return nullptr;
+    }
+    processor->prepare();
+    return processor;
+}
+
+// Returns an empty object if the file is missing, unreadable or of another version
+nlohmann::json read_cache(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) { return nlohmann::json::object(); }
+    try {
+        nlohmann::json cache;
+        file >> cache;
+        if (cache.is_object() && cache.value("version", 0u) == InferenceTimeCalibrator::k_version &&
+            cache.contains("machines") && cache["machines"].is_object()) {
+            return cache;
+        }
+        LOG_ERROR << "Ignoring inference time cache " << path << " of another version" << '\n';
+    } catch (const nlohmann::json::exception& e) {
+        LOG_ERROR << "Ignoring invalid inference time cache " << path << ": " << e.what() << '\n';
+    }
+    return nlohmann::json::object();
+}
+
+}  // namespace
+
+std::string InferenceTimeCalibration::get_default_cache_path() {
+    std::filesystem::path directory;
+#if defined(_WIN32)
+    if (const char* local_app_data = std::getenv("LOCALAPPDATA")) { directory = local_app_data; }
+#elif defined(__APPLE__)
+    if (const char* home = std::getenv("HOME")) {
+        directory = std::filesystem::path(home) / "Library" / "Caches";
+    }
+#else
+    if (const char* cache_home = std::getenv("XDG_CACHE_HOME"); cache_home && *cache_home) {
+        directory = cache_home;
+    } else if (const char* home = std::getenv("HOME")) {
+        directory = std::filesystem::path(home) / ".cache";
+    }
+#endif
+    if (directory.empty()) {
+        std::error_code error;
+        directory = std::filesystem::temp_directory_path(error);
+    }
+    return (directory / "anira" / "inference_times.json").string();
+}
+
+float InferenceTimeCalibrator::calibrate(const InferenceTimeCalibration& calibration,
+                                         BackendBase& processor,
+                                         InferenceBackend backend) {
+    std::string const machine_id = get_machine_id();
+    std::string const model_id = get_model_id(processor, backend);
+    bool const use_cache = !calibration.m_cache_path.empty();
+
+    std::vector<double> samples_ms;
+    if (!use_cache || calibration.m_recalibrate ||
+        !load(calibration.m_cache_path, machine_id, model_id, samples_ms)) {
+        // A processor shared with other sessions would skew the times and change the state of
+        // stateful models, so built-in backends are measured on a private instance
+        InferenceConfig inference_config = processor.m_inference_config;
+        std::unique_ptr<BackendBase> const private_processor =
+            make_processor(inference_config, backend);
+        samples_ms = measure(private_processor != nullptr ? *private_processor : processor,
+                             calibration.m_num_inferences);
+        if (use_cache && !samples_ms.empty() &&
+            !store(calibration.m_cache_path, machine_id, model_id, samples_ms)) {
+            LOG_ERROR << "Could not store the inference times in " << calibration.m_cache_path
+                      << '\n';
+        }
+    }
+
+    double const percentile_ms = get_percentile(samples_ms, calibration.m_percentile);
+    return static_cast<float>(percentile_ms * (1. + calibration.m_margin));
+}
+
+std::vector<double> InferenceTimeCalibrator::measure(BackendBase& processor,
+                                                     unsigned int num_inferences) {
+    std::vector<BufferF> inputs;
+    std::vector<BufferF> outputs;
+    for (size_t const size : processor.m_inference_config.get_tensor_input_size()) {
+        inputs.emplace_back(1, size);
+    }
+    for (size_t const size : processor.m_inference_config.get_tensor_output_size()) {
+        outputs.emplace_back(1, size);
+    }
+
+    // Silent inputs can take faster paths in some kernels, so the inputs are low-level noise
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> distribution(-0.1f, 0.1f);
+    std::vector<double> samples_ms;
+    samples_ms.reserve(num_inferences);
+    for (unsigned int i = 0; i <= num_inferences; ++i) {
+        // Backends may modify the inputs in place
+        for (auto& input : inputs) {
+            float* data = input.get_write_pointer(0);
+            for (size_t j = 0; j < input.get_num_samples(); ++j) {
+                data[j] = distribution(generator);
+            }
+        }
+        auto const start = std::chrono::steady_clock::now();
+        processor.process(inputs, outputs, nullptr);
+        auto const end = std::chrono::steady_clock::now();
+        if (i > 0) {
+            samples_ms.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+        }
+    }
+    return samples_ms;
+}
+
+double InferenceTimeCalibrator::get_percentile(std::vector<double> samples_ms, double percentile) {
+    if (samples_ms.empty()) { return 0.; }
+    std::sort(samples_ms.begin(), samples_ms.end());
+    auto const rank = static_cast<size_t>(
+        std::ceil(percentile / 100. * static_cast<double>(samples_ms.size())));
+    return samples_ms[std::clamp<size_t>(rank, 1, samples_ms.size()) - 1];
+}
+
+std::string InferenceTimeCalibrator::get_machine_id() {
+    return get_cpu_name() + " (" + std::to_string(std::thread::hardware_concurrency()) +
+           " threads)";
+}
+
+std::string InferenceTimeCalibrator::get_model_id(const BackendBase& processor,
+                                                  InferenceBackend backend) {
+    std::ostringstream id;
+    id << get_backend_name(backend) << ' ';
+    if (const ModelData* model_data = processor.m_inference_config.get_model_data(backend)) {
+        if (model_data->m_is_binary) {
+            id << "binary:" << std::hex << std::setw(16) << std::setfill('0')
+               << hash_bytes(model_data->m_data, model_data->m_size) << std::dec;
+        } else {
+            std::string const path(static_cast<const char*>(model_data->m_data),
+                                   model_data->m_size);
+            id << path;
+            // A model replaced at the same path must not reuse the times of the old one
+            std::error_code error;
+            auto const file_size = std::filesystem::file_size(path, error);
+            if (!error) { id << " size:" << file_size; }
+            auto const write_time = std::filesystem::last_write_time(path, error);
+            if (!error) { id << " mtime:" << write_time.time_since_epoch().count(); }
+        }
+        if (!model_data->m_model_function.empty()) { id << ':' << model_data->m_model_function; }
+    }
+    id << " [";
+    const std::vector<size_t>& input_sizes = processor.m_inference_config.get_tensor_input_size();
+    for (size_t i = 0; i < input_sizes.size(); ++i) { id << (i > 0 ? "," : "") << input_sizes[i]; }
+    id << "] " << typeid(processor).name();
+    return id.str();
+}
+
+bool InferenceTimeCalibrator::load(const std::string& path,
+                                   const std::string& machine_id,
+                                   const std::string& model_id,
+                                   std::vector<double>& samples_ms) {
+    std::lock_guard<std::mutex> const lock(s_mutex);
+    nlohmann::json const cache = read_cache(path);
+    if (!cache.contains("machines")) { return false; }
+    const nlohmann::json& machines = cache["machines"];
+    if (!machines.contains(machine_id) || !machines[machine_id].is_object()) { return false; }
+    const nlohmann::json& models = machines[machine_id];
+    if (!models.contains(model_id) || !models[model_id].is_array()) { return false; }
+
+    samples_ms.clear();
+    for (const auto& sample : models[model_id]) {
+        if (!sample.is_number()) { return false; }
+        samples_ms.push_back(sample.get<double>());
+    }
+    return !samples_ms.empty();
+}
+
+bool InferenceTimeCalibrator::store(const std::string& path,
+                                    const std::string& machine_id,
+                                    const std::string& model_id,
+                                    const std::vector<double>& samples_ms) {
+    std::lock_guard<std::mutex> const lock(s_mutex);
+    nlohmann::json cache = read_cache(path);
+    cache["version"] = k_version;
+    cache["machines"][machine_id][model_id] = samples_ms;
+
+    std::error_code error;
+    std::filesystem::path const file_path(path);
+    if (file_path.has_parent_path()) {
+        std::filesystem::create_directories(file_path.parent_path(), error);
+    }
+
+    // Other processes may write the file at the same time, so each writes its own temporary file
+    std::filesystem::path temp_path = file_path;
+    temp_path += ".tmp" + std::to_string(std::random_device()());
+    {
+        std::ofstream file(temp_path);
+        if (!file.is_open()) { return false; }
+        file << cache.dump(2);
+        if (!file.good()) { return false; }
+    }
+    std::filesystem::rename(temp_path, file_path, error);
+    if (error) {
+        std::filesystem::remove(temp_path, error);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace anira
@@ -0,0 +1,360 @@
+#include <anira/backends/BackendBase.h>
+#include <anira/utils/Buffer.h>
+#include <anira/utils/InferenceBackend.h>
+#include <anira/utils/InputRecorder.h>
+#include <anira/utils/Logger.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace anira {
+
+namespace {
+
+constexpr std::array<char, 8> k_magic{'A', 'N', 'I', 'R', 'A', 'R', 'E', 'C'};
+
+// A slot is claimed by an inference thread, filled and then handed to the flush thread, which
+// writes it and frees it again
+enum SlotState : uint8_t { FREE, WRITING, READY };
+
+// The slots are allocated on the first start and intentionally never freed, since an inference
+// thread may still hold a slot while the recorder is stopped
+RecordedInference* s_records = nullptr;
+std::atomic<uint8_t>* s_states = nullptr;
+std::atomic<size_t> s_next_slot{0};
+std::atomic<bool> s_running{false};
+std::atomic<uint64_t> s_dropped_records{0};
+std::atomic<int64_t> s_start_time_ns{0};
+
+std::mutex s_mutex;
+std::ofstream s_file;
+std::thread s_flush_thread;
+
+// The enum values depend on the backends that are compiled in, so the file uses fixed ids
+enum BackendId : uint32_t { ID_LIBTORCH, ID_ONNX, ID_TFLITE, ID_LITERT, ID_CUSTOM };
+
+uint32_t to_backend_id(InferenceBackend backend) {
+    switch (backend) {
+#ifdef USE_LIBTORCH
+        case InferenceBackend::LIBTORCH:
+            return ID_LIBTORCH;
+#endif
+#ifdef USE_ONNXRUNTIME
+        case InferenceBackend::ONNX:
+            return ID_ONNX;
+#endif
+#ifdef USE_TFLITE
+        case InferenceBackend::TFLITE:
+            return ID_TFLITE;
+#endif
+#ifdef USE_LITERT
+        case InferenceBackend::LITERT:
+            return ID_LITERT;
+#endif
+        default:
+            return ID_CUSTOM;
+    }
+}
+
+InferenceBackend from_backend_id(uint32_t id) {
+    switch (id) {
+#ifdef USE_LIBTORCH
+        case ID_LIBTORCH:
+            return InferenceBackend::LIBTORCH;
+#endif
+#ifdef USE_ONNXRUNTIME
+        case ID_ONNX:
+            return InferenceBackend::ONNX;
+#endif
+#ifdef USE_TFLITE
+        case ID_TFLITE:
+            return InferenceBackend::TFLITE;
+#endif
+#ifdef USE_LITERT
+        case ID_LITERT:
+            return InferenceBackend::LITERT;
+#endif
+        default:
+            return InferenceBackend::CUSTOM;
+    }
+}
+
+int64_t get_time_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+template <typename T>
+void write_value(T value) {
+    s_file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool read_value(std::ifstream& file, T& value) {
+    file.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return file.gcount() == static_cast<std::streamsize>(sizeof(T));
+}
+
+void write_record(const RecordedInference& record) {
+    write_value(static_cast<int32_t>(record.m_session_id));
+    write_value(to_backend_id(record.m_backend));
+    write_value(record.m_sequence);
+    write_value(record.m_time_ns);
+    write_value(record.m_queue_wait_ns);
+    write_value(record.m_inference_ns);
+    write_value(static_cast<uint32_t>(record.m_inputs.size()));
+    for (const auto& input : record.m_inputs) {
+        write_value(static_cast<uint32_t>(input.get_num_channels()));
+        write_value(static_cast<uint32_t>(input.get_num_samples()));
+        for (size_t channel = 0; channel < input.get_num_channels(); ++channel) {
+            s_file.write(reinterpret_cast<const char*>(input.get_read_pointer(channel)),
+                         static_cast<std::streamsize>(input.get_num_samples() * sizeof(float)));
+        }
+    }
+}
+
+// Finishes the recording if the host never called stop(), declared last so it is destroyed
+// before the state it uses
+struct InputRecorderShutdown {
+    InputRecorderShutdown() = default;
+    InputRecorderShutdown(const InputRecorderShutdown&) = delete;
+    InputRecorderShutdown& operator=(const InputRecorderShutdown&) = delete;
+    ~InputRecorderShutdown() { InputRecorder::stop(); }
+} s_shutdown;
+
+}  // namespace
+
+bool InputRecorder::start(const std::string& file_path) {
+    std::lock_guard<std::mutex> const lock(s_mutex);
+    if (s_running.load(std::memory_order_relaxed)) { return false; }
+
+    s_file.open(file_path, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!s_file.is_open()) {
+        LOG_ERROR << "[ERROR] Could not open recording file " << file_path << '\n';
+        return false;
+    }
+    s_file.write(k_magic.data(), k_magic.size());
+    write_value(k_version);
+
+    if (s_records == nullptr) {
+        s_records = new RecordedInference[k_num_slots];
+        s_states = new std::atomic<uint8_t>[k_num_slots];
+        for (size_t i = 0; i < k_num_slots; ++i) {
+            s_states[i].store(FREE, std::memory_order_relaxed);
+        }
+    }
+    // Discard records that were committed after the previous stop
+    for (size_t i = 0; i < k_num_slots; ++i) {
+        uint8_t ready = READY;
+        s_states[i].compare_exchange_strong(ready, FREE, std::memory_order_acq_rel);
+    }
+
+    s_dropped_records.store(0, std::memory_order_relaxed);
+    s_start_time_ns.store(get_time_ns(), std::memory_order_relaxed);
+    s_running.store(true, std::memory_order_release);
+    s_flush_thread = std::thread(&InputRecorder::flush_loop);
+    return true;
+}
+
+void InputRecorder::stop() {
+    std::lock_guard<std::mutex> const lock(s_mutex);
+    if (!s_running.exchange(false, std::memory_order_acq_rel)) { return; }
+    if (s_flush_thread.joinable()) { s_flush_thread.join(); }
+    flush();
+    s_file.close();
+    if (s_dropped_records.load(std::memory_order_relaxed) > 0) {
+        LOG_INFO << "[WARNING] InputRecorder dropped "
+                 << s_dropped_records.load(std::memory_order_relaxed) << " inferences!" << '\n';
+    }
+}
+
+bool InputRecorder::is_running() {
+    return s_running.load(std::memory_order_acquire);
+}
+
+RecordedInference* InputRecorder::capture(const std::vector<BufferF>& inputs) {
+    if (!is_running()) { return nullptr; }
+
+    size_t const first_slot = s_next_slot.fetch_add(1, std::memory_order_relaxed);
+    for (size_t i = 0; i < k_num_slots; ++i) {
+        size_t const slot = (first_slot + i) % k_num_slots;
+        uint8_t free = FREE;
+        if (!s_states[slot].compare_exchange_strong(free, WRITING, std::memory_order_acquire)) {
+            continue;
+        }
+
+        RecordedInference& record = s_records[slot];
+        if (record.m_inputs.size() != inputs.size()) { record.m_inputs.resize(inputs.size()); }
+        for (size_t tensor = 0; tensor < inputs.size(); ++tensor) {
+            const BufferF& input = inputs[tensor];
+            BufferF& copy = record.m_inputs[tensor];
+            if (copy.get_num_channels() != input.get_num_channels() ||
+                copy.get_num_samples() != input.get_num_samples()) {
+                copy.resize(input.get_num_channels(), input.get_num_samples());
+            }
+            for (size_t channel = 0; channel < input.get_num_channels(); ++channel) {
+                std::memcpy(copy.get_write_pointer(channel),
+                            input.get_read_pointer(channel),
+                            input.get_num_samples() * sizeof(float));
+            }
+        }
+        return &record;
+    }
+
+    s_dropped_records.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+void InputRecorder::commit(RecordedInference* record,
+                           int session_id,
+                           InferenceBackend backend,
+                           uint64_t sequence,
+                           int64_t queue_wait_ns,
+                           int64_t inference_ns) {
+    if (record == nullptr) { return; }
+    record->m_session_id = session_id;
+    record->m_backend = backend;
+    record->m_sequence = sequence;
+    record->m_time_ns = static_cast<uint64_t>(get_time_ns() -
+                                              s_start_time_ns.load(std::memory_order_relaxed));
+    record->m_queue_wait_ns = queue_wait_ns;
+    record->m_inference_ns = inference_ns;
+    s_states[record - s_records].store(READY, std::memory_order_release);
+}
+
+uint64_t InputRecorder::get_dropped_records() {
+    return s_dropped_records.load(std::memory_order_relaxed);
+}
+
+bool InputRecorder::read(const std::string& file_path, std::vector<RecordedInference>& records) {
+    records.clear();
+    std::ifstream file(file_path, std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+        LOG_ERROR << "[ERROR] Could not open recording file " << file_path << '\n';
+        return false;
+    }
+
+    std::array<char, k_magic.size()> magic{};
+    file.read(magic.data(), magic.size());
+    uint32_t version = 0;
+    if (file.gcount() != static_cast<std::streamsize>(magic.size()) || magic != k_magic ||
+        !read_value(file, version) || version != k_version) {
+        LOG_ERROR << "[ERROR] " << file_path << " is not an anira recording of version "
+                  << k_version << '\n';
+        return false;
+    }
+
+    while (file.peek() != std::ifstream::traits_type::eof()) {
+        RecordedInference record;
+        int32_t session_id = 0;
+        uint32_t backend_id = 0;
+        uint32_t num_tensors = 0;
+        bool valid = read_value(file, session_id) && read_value(file, backend_id) &&
+                     read_value(file, record.m_sequence) && read_value(file, record.m_time_ns) &&
+                     read_value(file, record.m_queue_wait_ns) &&
+                     read_value(file, record.m_inference_ns) && read_value(file, num_tensors);
+        for (uint32_t tensor = 0; valid && tensor < num_tensors; ++tensor) {
+            uint32_t num_channels = 0;
+            uint32_t num_samples = 0;
+            valid = read_value(file, num_channels) && read_value(file, num_samples);
+            if (!valid) { break; }
+            BufferF& input = record.m_inputs.emplace_back(num_channels, num_samples);
+            for (size_t channel = 0; valid && channel < num_channels; ++channel) {
+                auto const num_bytes = static_cast<std::streamsize>(num_samples * sizeof(float));
+                file.read(reinterpret_cast<char*>(input.get_write_pointer(channel)), num_bytes);
+                valid = file.gcount() == num_bytes;
+            }
+        }
+        if (!valid) {
+            LOG_ERROR << "[ERROR] Recording " << file_path << " is truncated after "
+                      << records.size() << " records" << '\n';
+            return false;
+        }
+        record.m_session_id = session_id;
+        record.m_backend = from_backend_id(backend_id);
+        records.push_back(std::move(record));
+    }
+    return true;
+}
+
+std::vector<int64_t> InputRecorder::replay(BackendBase& backend,
+                                           const std::vector<RecordedInference>& records) {
+    const std::vector<size_t>& input_sizes = backend.m_inference_config.get_tensor_input_size();
+    const std::vector<size_t>& output_sizes = backend.m_inference_config.get_tensor_output_size();
+
+    std::vector<BufferF> inputs;
+    std::vector<BufferF> outputs;
+    for (size_t const size : input_sizes) { inputs.emplace_back(1, size); }
+    for (size_t const size : output_sizes) { outputs.emplace_back(1, size); }
+
+    std::vector<int64_t> durations;
+    durations.reserve(records.size());
+    for (const auto& record : records) {
+        bool matches = record.m_inputs.size() == inputs.size();
+        for (size_t tensor = 0; matches && tensor < inputs.size(); ++tensor) {
+            const BufferF& recorded = record.m_inputs[tensor];
+            matches = recorded.get_num_channels() * recorded.get_num_samples() ==
+                      input_sizes[tensor];
+        }
+        if (!matches) {
+            durations.push_back(-1);
+            continue;
+        }
+
+        // The inputs are copied for every call, since backends may modify them in place
+        for (size_t tensor = 0; tensor < inputs.size(); ++tensor) {
+            const BufferF& recorded = record.m_inputs[tensor];
+            for (size_t channel = 0; channel < recorded.get_num_channels(); ++channel) {
+                std::memcpy(inputs[tensor].get_write_pointer(0) +
+                                channel * recorded.get_num_samples(),
+                            recorded.get_read_pointer(channel),
+                            recorded.get_num_samples() * sizeof(float));
+            }
+        }
+
+        auto const start = std::chrono::steady_clock::now();
+        backend.process(inputs, outputs, nullptr);
+        auto const end = std::chrono::steady_clock::now();
+        durations.push_back(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+    return durations;
+}
+
+void InputRecorder::flush() {
+    std::vector<size_t> ready_slots;
+    ready_slots.reserve(k_num_slots);
+    for (size_t i = 0; i < k_num_slots; ++i) {
+        if (s_states[i].load(std::memory_order_acquire) == READY) { ready_slots.push_back(i); }
+    }
+    std::sort(ready_slots.begin(), ready_slots.end(), [](size_t a, size_t b) {
+        return s_records[a].m_time_ns < s_records[b].m_time_ns;
+    });
+    for (size_t const slot : ready_slots) {
+        write_record(s_records[slot]);
+        s_states[slot].store(FREE, std::memory_order_release);
+    }
+    s_file.flush();
+}
+
+void InputRecorder::flush_loop() {
+    while (s_running.load(std::memory_order_acquire)) {
+        std::this_thread::sleep_for(k_flush_interval);
+        flush();
+    }
+}
+
+}  // namespace anira
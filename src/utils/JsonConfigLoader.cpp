@@ -3,6 +3,9 @@
 #include <anira/utils/InferenceBackend.h>
 #include <anira/utils/JsonConfigLoader.h>
 #include <anira/utils/Logger.h>
+#include <anira/utils/ResamplerQuality.h>
+#include <anira/utils/SpectralSpec.h>
+#include <anira/utils/TensorLayout.h>
 
 #include <cstddef>
 #include <cstdint>
@@ -261,11 +264,24 @@ std::vector<anira::TensorShape> anira::JsonConfigLoader::create_tensor_shape_fro
             }
         }
 
+        anira::TensorLayout tensor_layout = anira::TensorLayout::CHANNELS_FIRST;
+        if (item.contains("tensor_layout")) {
+            const auto& layout = item.at("tensor_layout");
+            if (layout.is_string() && layout.get<std::string>() == "CHANNELS_LAST") {
+                tensor_layout = anira::TensorLayout::CHANNELS_LAST;
+            } else if (!layout.is_string() || layout.get<std::string>() != "CHANNELS_FIRST") {
+                LOG_ERROR << "Invalid 'tensor_layout' value in 'tensor_shape' array entry: "
+                             "expected 'CHANNELS_FIRST' or 'CHANNELS_LAST'."
+                          << '\n';
+            }
+        }
+
         if (tensor_backend == "ONNX") {
 #if USE_ONNXRUNTIME
             tensor_shape.emplace_back(input_shape_list,
                                       output_shape_list,
-                                      anira::InferenceBackend::ONNX);
+                                      anira::InferenceBackend::ONNX,
+                                      tensor_layout);
 #else
             LOG_ERROR << "Disabled 'inference_backend' value in 'tensor_shape' array "
                          "entry : ONNX currently disabled in config."
@@ -275,7 +291,8 @@ std::vector<anira::TensorShape> anira::JsonConfigLoader::create_tensor_shape_fro
 #if USE_TFLITE
             tensor_shape.emplace_back(input_shape_list,
                                       output_shape_list,
-                                      anira::InferenceBackend::TFLITE);
+                                      anira::InferenceBackend::TFLITE,
+                                      tensor_layout);
 #else
             LOG_ERROR << "Disabled 'inference_backend' value in 'tensor_shape' array "
                          "entry : TFLITE currently disabled in config."
@@ -285,7 +302,8 @@ std::vector<anira::TensorShape> anira::JsonConfigLoader::create_tensor_shape_fro
 #if USE_LITERT
             tensor_shape.emplace_back(input_shape_list,
                                       output_shape_list,
-                                      anira::InferenceBackend::LITERT);
+                                      anira::InferenceBackend::LITERT,
+                                      tensor_layout);
 #else
             LOG_ERROR << "Disabled 'inference_backend' value in 'tensor_shape' array "
                          "entry : LITERT currently disabled in config."
@@ -295,7 +313,8 @@ std::vector<anira::TensorShape> anira::JsonConfigLoader::create_tensor_shape_fro
 #if USE_LIBTORCH
             tensor_shape.emplace_back(input_shape_list,
                                       output_shape_list,
-                                      anira::InferenceBackend::LIBTORCH);
+                                      anira::InferenceBackend::LIBTORCH,
+                                      tensor_layout);
 #else
             LOG_ERROR << "Disabled 'inference_backend' value in 'tensor_shape' array "
                          "entry : LIBTORCH currently disabled in config."
@@ -304,8 +323,14 @@ std::vector<anira::TensorShape> anira::JsonConfigLoader::create_tensor_shape_fro
         } else if (tensor_backend == "CUSTOM") {
             tensor_shape.emplace_back(input_shape_list,
                                       output_shape_list,
-                                      anira::InferenceBackend::CUSTOM);
+                                      anira::InferenceBackend::CUSTOM,
+                                      tensor_layout);
         } else if (tensor_backend == "UNIVERSAL") {
+            if (tensor_layout != anira::TensorLayout::CHANNELS_FIRST) {
+                LOG_ERROR << "Invalid 'tensor_layout' value in 'tensor_shape' array entry: "
+                             "universal shapes are always 'CHANNELS_FIRST'."
+                          << '\n';
+            }
             tensor_shape.emplace_back(input_shape_list, output_shape_list);
         } else {
             LOG_ERROR << "Invalid 'inference_backend' value in 'tensor_shape' array "
@@ -384,9 +409,89 @@ anira::ProcessingSpec anira::JsonConfigLoader::create_processing_spec_from_confi
         config_required = true;
     }
 
+    if (config.contains("model_sample_rate")) {
+        const auto& model_sample_rate = config.at("model_sample_rate");
+        if (model_sample_rate.is_number() && model_sample_rate.get<float>() >= 0.f) {
+            processing_spec.m_model_sample_rate = model_sample_rate.get<float>();
+            config_required = true;
+        } else {
+            LOG_ERROR << "Invalid 'model_sample_rate' value: expected a non-negative number."
+                      << '\n';
+        }
+    }
+
+    if (config.contains("resampler_quality")) {
+        const auto& quality = config.at("resampler_quality");
+        std::string const name = quality.is_string() ? quality.get<std::string>() : "";
+        if (name == "LOW_QUALITY") {
+            processing_spec.m_resampler_quality = anira::ResamplerQuality::LOW_QUALITY;
+        } else if (name == "MEDIUM_QUALITY") {
+            processing_spec.m_resampler_quality = anira::ResamplerQuality::MEDIUM_QUALITY;
+        } else if (name == "HIGH_QUALITY") {
+            processing_spec.m_resampler_quality = anira::ResamplerQuality::HIGH_QUALITY;
+        } else {
+            LOG_ERROR << "Invalid 'resampler_quality' value: expected 'LOW_QUALITY', "
+                         "'MEDIUM_QUALITY' or 'HIGH_QUALITY'."
+                      << '\n';
+        }
+    }
+
+    if (config.contains("input_spectral_spec")) {
+        processing_spec.m_input_spectral_spec =
+            parse_spectral_spec(config.at("input_spectral_spec"), "input_spectral_spec");
+        config_required = true;
+    }
+
+    if (config.contains("output_spectral_spec")) {
+        processing_spec.m_output_spectral_spec =
+            parse_spectral_spec(config.at("output_spectral_spec"), "output_spectral_spec");
+        config_required = true;
+    }
+
     return processing_spec;
 }
 
+std::vector<anira::SpectralSpec> anira::JsonConfigLoader::parse_spectral_spec(
+    const nlohmann::json& spec_node,
+    const std::string& json_key_name) {
+    if (!spec_node.is_array()) {
+        LOG_ERROR << "Invalid '" << json_key_name << "' value: expected an array." << '\n';
+        return {};
+    }
+
+    // Entries that are null or have no feature disable the spectral stage of their tensor
+    std::vector<anira::SpectralSpec> spectral_spec;
+    for (const auto& entry : spec_node) {
+        anira::SpectralSpec spec;
+        if (entry.is_object() && entry.contains("feature")) {
+            const auto& feature = entry.at("feature");
+            std::string const name = feature.is_string() ? feature.get<std::string>() : "";
+            if (name == "COMPLEX_SPECTRUM") {
+                spec.m_feature = anira::SpectralFeature::COMPLEX_SPECTRUM;
+            } else if (name == "MAGNITUDE_SPECTRUM") {
+                spec.m_feature = anira::SpectralFeature::MAGNITUDE_SPECTRUM;
+            } else if (name == "LOG_MEL_SPECTRUM") {
+                spec.m_feature = anira::SpectralFeature::LOG_MEL_SPECTRUM;
+            } else if (name != "NO_SPECTRAL_FEATURE") {
+                LOG_ERROR << "Invalid 'feature' value in '" << json_key_name
+                          << "' array entry: expected 'NO_SPECTRAL_FEATURE', "
+                             "'COMPLEX_SPECTRUM', 'MAGNITUDE_SPECTRUM' or 'LOG_MEL_SPECTRUM'."
+                          << '\n';
+            }
+            spec.m_fft_size = entry.value("fft_size", static_cast<size_t>(0));
+            spec.m_hop_size = entry.value("hop_size", static_cast<size_t>(0));
+            spec.m_num_mels = entry.value("num_mels", static_cast<size_t>(0));
+            spec.m_min_frequency = entry.value("min_frequency", 0.f);
+            spec.m_max_frequency = entry.value("max_frequency", 0.f);
+        } else if (!entry.is_null() && !entry.is_object()) {
+            LOG_ERROR << "Invalid '" << json_key_name
+                      << "' array entry: expected an object or null." << '\n';
+        }
+        spectral_spec.push_back(spec);
+    }
+    return spectral_spec;
+}
+
 std::vector<size_t> anira::JsonConfigLoader::parse_size_t_json_shape(
     const nlohmann::json& shape_node,
     const std::string& json_key_name) {
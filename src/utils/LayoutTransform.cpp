@@ -0,0 +1,249 @@
+#include <anira/utils/LayoutTransform.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64)
+#include <immintrin.h>
+#define ANIRA_LAYOUT_TRANSFORM_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define ANIRA_LAYOUT_TRANSFORM_NEON
+#endif
+
+namespace anira {
+
+namespace {
+
+// Rows and columns of the blocks the tiles are transposed in, keeps the source rows and the
+// destination rows of a block in the L1 cache for large matrices
+constexpr size_t k_block_size = 32;
+
+// Returns the number of samples interleaved with SIMD, the caller handles the rest
+size_t interleave_stereo(const float* left,
+                         const float* right,
+                         float* destination,
+                         size_t num_samples) {
+    size_t sample = 0;
+#if defined(ANIRA_LAYOUT_TRANSFORM_SSE)
+    for (; sample + 4 <= num_samples; sample += 4) {
+        __m128 const l = _mm_loadu_ps(left + sample);
+        __m128 const r = _mm_loadu_ps(right + sample);
+        _mm_storeu_ps(destination + 2 * sample, _mm_unpacklo_ps(l, r));
+        _mm_storeu_ps(destination + 2 * sample + 4, _mm_unpackhi_ps(l, r));
+    }
+#elif defined(ANIRA_LAYOUT_TRANSFORM_NEON)
+    for (; sample + 4 <= num_samples; sample += 4) {
+        float32x4x2_t const frames = {vld1q_f32(left + sample), vld1q_f32(right + sample)};
+        vst2q_f32(destination + 2 * sample, frames);
+    }
+#endif
+    return sample;
+}
+
+// Returns the number of samples deinterleaved with SIMD, the caller handles the rest
+size_t deinterleave_stereo(const float* source, float* left, float* right, size_t num_samples) {
+    size_t sample = 0;
+#if defined(ANIRA_LAYOUT_TRANSFORM_SSE)
+    for (; sample + 4 <= num_samples; sample += 4) {
+        __m128 const frames_01 = _mm_loadu_ps(source + 2 * sample);
+        __m128 const frames_23 = _mm_loadu_ps(source + 2 * sample + 4);
+        _mm_storeu_ps(left + sample, _mm_shuffle_ps(frames_01, frames_23, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(right + sample,
+                      _mm_shuffle_ps(frames_01, frames_23, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+#elif defined(ANIRA_LAYOUT_TRANSFORM_NEON)
+    for (; sample + 4 <= num_samples; sample += 4) {
+        float32x4x2_t const frames = vld2q_f32(source + 2 * sample);
+        vst1q_f32(left + sample, frames.val[0]);
+        vst1q_f32(right + sample, frames.val[1]);
+    }
+#endif
+    return sample;
+}
+
+}  // namespace
+
+void LayoutTransform::transpose_tile(const float* const* source, float* const* destination) {
+#if defined(ANIRA_LAYOUT_TRANSFORM_SSE)
+    __m128 row_0 = _mm_loadu_ps(source[0]);
+    __m128 row_1 = _mm_loadu_ps(source[1]);
+    __m128 row_2 = _mm_loadu_ps(source[2]);
+    __m128 row_3 = _mm_loadu_ps(source[3]);
+    _MM_TRANSPOSE4_PS(row_0, row_1, row_2, row_3);
+    _mm_storeu_ps(destination[0], row_0);
+    _mm_storeu_ps(destination[1], row_1);
+    _mm_storeu_ps(destination[2], row_2);
+    _mm_storeu_ps(destination[3], row_3);
+#elif defined(ANIRA_LAYOUT_TRANSFORM_NEON)
+    float32x4x2_t const rows_01 = vtrnq_f32(vld1q_f32(source[0]), vld1q_f32(source[1]));
+    float32x4x2_t const rows_23 = vtrnq_f32(vld1q_f32(source[2]), vld1q_f32(source[3]));
+    vst1q_f32(destination[0],
+              vcombine_f32(vget_low_f32(rows_01.val[0]), vget_low_f32(rows_23.val[0])));
+    vst1q_f32(destination[1],
+              vcombine_f32(vget_low_f32(rows_01.val[1]), vget_low_f32(rows_23.val[1])));
+    vst1q_f32(destination[2],
+              vcombine_f32(vget_high_f32(rows_01.val[0]), vget_high_f32(rows_23.val[0])));
+    vst1q_f32(destination[3],
+              vcombine_f32(vget_high_f32(rows_01.val[1]), vget_high_f32(rows_23.val[1])));
+#else
+    for (size_t row = 0; row < k_tile_size; ++row) {
+        for (size_t column = 0; column < k_tile_size; ++column) {
+            destination[column][row] = source[row][column];
+        }
+    }
+#endif
+}
+
+void LayoutTransform::transpose(const float* source,
+                                float* destination,
+                                size_t num_rows,
+                                size_t num_columns) {
+    if (num_rows == 1 || num_columns == 1) {
+        std::memcpy(destination, source, num_rows * num_columns * sizeof(float));
+        return;
+    }
+    // Stereo blocks are too narrow for the tiles, but transposing them is (de)interleaving
+    if (num_rows == 2) {
+        const float* const rows[2] = {source, source + num_columns};
+        interleave(rows, destination, 2, num_columns);
+        return;
+    }
+    if (num_columns == 2) {
+        float* const rows[2] = {destination, destination + num_rows};
+        deinterleave(source, rows, 2, num_rows);
+        return;
+    }
+
+    for (size_t block_row = 0; block_row < num_rows; block_row += k_block_size) {
+        size_t const row_end = std::min(block_row + k_block_size, num_rows);
+        for (size_t block_column = 0; block_column < num_columns; block_column += k_block_size) {
+            size_t const column_end = std::min(block_column + k_block_size, num_columns);
+
+            size_t row = block_row;
+            for (; row + k_tile_size <= row_end; row += k_tile_size) {
+                size_t column = block_column;
+                for (; column + k_tile_size <= column_end; column += k_tile_size) {
+                    const float* const tile_source[k_tile_size] = {
+                        source + row * num_columns + column,
+                        source + (row + 1) * num_columns + column,
+                        source + (row + 2) * num_columns + column,
+                        source + (row + 3) * num_columns + column};
+                    float* const tile_destination[k_tile_size] = {
+                        destination + column * num_rows + row,
+                        destination + (column + 1) * num_rows + row,
+                        destination + (column + 2) * num_rows + row,
+                        destination + (column + 3) * num_rows + row};
+                    transpose_tile(tile_source, tile_destination);
+                }
+                for (; column < column_end; ++column) {
+                    for (size_t i = 0; i < k_tile_size; ++i) {
+                        destination[column * num_rows + row + i] =
+                            source[(row + i) * num_columns + column];
+                    }
+                }
+            }
+            for (; row < row_end; ++row) {
+                for (size_t column = block_column; column < column_end; ++column) {
+                    destination[column * num_rows + row] = source[row * num_columns + column];
+                }
+            }
+        }
+    }
+}
+
+void LayoutTransform::interleave(const float* const* source,
+                                 float* destination,
+                                 size_t num_channels,
+                                 size_t num_samples) {
+    if (num_channels == 1) {
+        std::memcpy(destination, source[0], num_samples * sizeof(float));
+        return;
+    }
+    if (num_channels == 2) {
+        for (size_t sample = interleave_stereo(source[0], source[1], destination, num_samples);
+             sample < num_samples;
+             ++sample) {
+            destination[2 * sample] = source[0][sample];
+            destination[2 * sample + 1] = source[1][sample];
+        }
+        return;
+    }
+
+    size_t channel = 0;
+    for (; channel + k_tile_size <= num_channels; channel += k_tile_size) {
+        size_t sample = 0;
+        for (; sample + k_tile_size <= num_samples; sample += k_tile_size) {
+            const float* const tile_source[k_tile_size] = {source[channel] + sample,
+                                                           source[channel + 1] + sample,
+                                                           source[channel + 2] + sample,
+                                                           source[channel + 3] + sample};
+            float* const tile_destination[k_tile_size] = {
+                destination + sample * num_channels + channel,
+                destination + (sample + 1) * num_channels + channel,
+                destination + (sample + 2) * num_channels + channel,
+                destination + (sample + 3) * num_channels + channel};
+            transpose_tile(tile_source, tile_destination);
+        }
+        for (; sample < num_samples; ++sample) {
+            for (size_t i = 0; i < k_tile_size; ++i) {
+                destination[sample * num_channels + channel + i] = source[channel + i][sample];
+            }
+        }
+    }
+    for (; channel < num_channels; ++channel) {
+        for (size_t sample = 0; sample < num_samples; ++sample) {
+            destination[sample * num_channels + channel] = source[channel][sample];
+        }
+    }
+}
+
+void LayoutTransform::deinterleave(const float* source,
+                                   float* const* destination,
+                                   size_t num_channels,
+                                   size_t num_samples) {
+    if (num_channels == 1) {
+        std::memcpy(destination[0], source, num_samples * sizeof(float));
+        return;
+    }
+    if (num_channels == 2) {
+        for (size_t sample =
+                 deinterleave_stereo(source, destination[0], destination[1], num_samples);
+             sample < num_samples;
+             ++sample) {
+            destination[0][sample] = source[2 * sample];
+            destination[1][sample] = source[2 * sample + 1];
+        }
+        return;
+    }
+
+    size_t channel = 0;
+    for (; channel + k_tile_size <= num_channels; channel += k_tile_size) {
+        size_t sample = 0;
+        for (; sample + k_tile_size <= num_samples; sample += k_tile_size) {
+            const float* const tile_source[k_tile_size] = {
+                source + sample * num_channels + channel,
+                source + (sample + 1) * num_channels + channel,
+                source + (sample + 2) * num_channels + channel,
+                source + (sample + 3) * num_channels + channel};
+            float* const tile_destination[k_tile_size] = {destination[channel] + sample,
+                                                          destination[channel + 1] + sample,
+                                                          destination[channel + 2] + sample,
+                                                          destination[channel + 3] + sample};
+            transpose_tile(tile_source, tile_destination);
+        }
+        for (; sample < num_samples; ++sample) {
+            for (size_t i = 0; i < k_tile_size; ++i) {
+                destination[channel + i][sample] = source[sample * num_channels + channel + i];
+            }
+        }
+    }
+    for (; channel < num_channels; ++channel) {
+        for (size_t sample = 0; sample < num_samples; ++sample) {
+            destination[channel][sample] = source[sample * num_channels + channel];
+        }
+    }
+}
+
+}  // namespace anira
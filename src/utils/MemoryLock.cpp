@@ -0,0 +1,187 @@
+#include <anira/utils/MemoryLock.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif !defined(__EMSCRIPTEN__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#if defined(_MSC_VER)
+#define ANIRA_NOINLINE __declspec(noinline)
+#else
+#define ANIRA_NOINLINE __attribute__((noinline))
+#endif
+
+namespace anira {
+
+namespace {
+
+void add_failure(MemoryLockStatus& status, size_t bytes, const std::string& reason) {
+    status.m_failed_bytes += bytes;
+    status.m_errors.push_back("Could not lock " + std::to_string(bytes) + " bytes: " + reason);
+}
+
+// Number of locked ranges touching every page, the operating system does not nest locks
+struct PageLocks {
+    std::mutex m_mutex;
+    std::unordered_map<uintptr_t, size_t> m_counts;
+};
+
+// Never destroyed, sessions may still unlock their memory during static destruction
+PageLocks& get_page_locks() {
+    static auto* page_locks = new PageLocks();
+    return *page_locks;
+}
+
+uintptr_t get_first_page(const void* data) {
+    auto const address = reinterpret_cast<uintptr_t>(data);
+    return address - address % MemoryLock::get_page_size();
+}
+
+uintptr_t get_end_page(const void* data, size_t bytes) {
+    return get_first_page(static_cast<const std::byte*>(data) + bytes - 1) +
+           MemoryLock::get_page_size();
+}
+
+bool lock_pages(void* data, size_t bytes, MemoryLockStatus& status) {
+    MemoryLock::prefault(data, bytes);
+#if defined(__EMSCRIPTEN__)
+    add_failure(status, bytes, "memory locking is not supported on WebAssembly");
+    return false;
+#elif defined(_WIN32)
+    if (VirtualLock(data, bytes) == 0) {
+        add_failure(status,
+                    bytes,
+                    std::system_category().message(static_cast<int>(GetLastError())));
+        return false;
+    }
+#else
+    // Some systems require the address to be page aligned
+    uintptr_t const begin = get_first_page(data);
+    if (mlock(reinterpret_cast<const void*>(begin), get_end_page(data, bytes) - begin) != 0) {
+        add_failure(status, bytes, std::generic_category().message(errno));
+        return false;
+    }
+#endif
+    status.m_locked_bytes += bytes;
+    return true;
+}
+
+void unlock_pages([[maybe_unused]] uintptr_t begin, [[maybe_unused]] uintptr_t end) {
+    if (begin == end) { return; }
+#if defined(_WIN32)
+    VirtualUnlock(reinterpret_cast<void*>(begin), end - begin);
+#elif !defined(__EMSCRIPTEN__)
+    munlock(reinterpret_cast<const void*>(begin), end - begin);
+#endif
+}
+
+// A separate frame, so the pages of the array lie below the frame of the caller
+ANIRA_NOINLINE bool lock_stack_frame(MemoryLockStatus& status) {
+    std::byte stack[MemoryLock::k_stack_size];
+    // Writing every page maps it, the pages stay mapped and locked after the function returns.
+    // The stack is never unlocked, so its pages are not counted.
+    std::memset(stack, 0, sizeof(stack));
+    return lock_pages(stack, sizeof(stack), status);
+}
+
+}  // namespace
+
+bool MemoryLockStatus::is_ok() const {
+    return m_failed_bytes == 0 && m_errors.empty();
+}
+
+void MemoryLockStatus::merge(const MemoryLockStatus& other) {
+    m_locked_bytes += other.m_locked_bytes;
+    m_failed_bytes += other.m_failed_bytes;
+    m_errors.insert(m_errors.end(), other.m_errors.begin(), other.m_errors.end());
+}
+
+bool MemoryLock::lock(void* data, size_t bytes, MemoryLockStatus& status) {
+    if (data == nullptr || bytes == 0) { return true; }
+    if (!lock_pages(data, bytes, status)) { return false; }
+
+    size_t const page_size = get_page_size();
+    PageLocks& page_locks = get_page_locks();
+    std::lock_guard<std::mutex> const lock(page_locks.m_mutex);
+    for (uintptr_t page = get_first_page(data); page < get_end_page(data, bytes);
+         page += page_size) {
+        ++page_locks.m_counts[page];
+    }
+    return true;
+}
+
+void MemoryLock::unlock(const void* data, size_t bytes) {
+    if (data == nullptr || bytes == 0) { return; }
+    size_t const page_size = get_page_size();
+    PageLocks& page_locks = get_page_locks();
+    std::lock_guard<std::mutex> const lock(page_locks.m_mutex);
+    // Pages still touched by other locked ranges stay locked, the others are unlocked in runs
+    uintptr_t run_begin = get_first_page(data);
+    uintptr_t const end = get_end_page(data, bytes);
+    for (uintptr_t page = run_begin; page < end; page += page_size) {
+        auto const it = page_locks.m_counts.find(page);
+        bool still_locked = false;
+        if (it != page_locks.m_counts.end()) {
+            if (--it->second > 0) {
+                still_locked = true;
+            } else {
+                page_locks.m_counts.erase(it);
+            }
+        }
+        if (still_locked) {
+            unlock_pages(run_begin, page);
+            run_begin = page + page_size;
+        }
+    }
+    unlock_pages(run_begin, end);
+}
+
+bool MemoryLock::is_locked(const void* data) {
+    PageLocks& page_locks = get_page_locks();
+    std::lock_guard<std::mutex> const lock(page_locks.m_mutex);
+    return page_locks.m_counts.contains(get_first_page(data));
+}
+
+void MemoryLock::prefault(void* data, size_t bytes) {
+    if (data == nullptr || bytes == 0) { return; }
+    size_t const page_size = get_page_size();
+    auto* memory = static_cast<unsigned char*>(data);
+    // Reading an untouched anonymous page only maps the shared zero page, so every page is
+    // written. Adding zero atomically keeps the values concurrent writers store.
+    auto const touch = [](unsigned char& byte) {
+        std::atomic_ref<unsigned char>(byte).fetch_add(0, std::memory_order_relaxed);
+    };
+    for (size_t offset = 0; offset < bytes; offset += page_size) { touch(memory[offset]); }
+    touch(memory[bytes - 1]);
+}
+
+bool MemoryLock::lock_stack(MemoryLockStatus& status) {
+    return lock_stack_frame(status);
+}
+
+size_t MemoryLock::get_page_size() {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return static_cast<size_t>(info.dwPageSize);
+#elif defined(__EMSCRIPTEN__)
+    return 64 * 1024;
+#else
+    long const page_size = sysconf(_SC_PAGESIZE);
+    return page_size > 0 ? static_cast<size_t>(page_size) : 4096;
+#endif
+}
+
+}  // namespace anira
@@ -0,0 +1,224 @@
+#include <anira/utils/AlignedAllocator.h>
+#include <anira/utils/Logger.h>
+#include <anira/utils/MemoryLock.h>
+#include <anira/utils/MirroredRingBuffer.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__linux__) && !defined(__ANDROID__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace anira {
+
+MirroredRingBuffer::~MirroredRingBuffer() {
+    release();
+}
+
+void MirroredRingBuffer::initialize(size_t num_channels, size_t min_num_samples) {
+    release();
+    if (num_channels == 0 || min_num_samples == 0) { return; }
+
+    size_t capacity = std::bit_ceil(min_num_samples);
+#if defined(__linux__) && !defined(__ANDROID__)
+    // Both halves of a mapping are whole pages, page sizes are powers of two as well
+    capacity = std::max(capacity, MemoryLock::get_page_size() / sizeof(float));
+#endif
+    m_capacity = capacity;
+    m_mask = capacity - 1;
+
+    m_channels.resize(num_channels);
+    m_mirrored = true;
+    for (auto& channel : m_channels) { m_mirrored = m_mirrored && map_mirrored(channel); }
+    if (!m_mirrored) {
+        // All channels use the same strategy, so the writes need no branch per channel
+        release();
+        m_capacity = std::bit_ceil(min_num_samples);
+        m_mask = m_capacity - 1;
+        m_channels.resize(num_channels);
+        for (auto& channel : m_channels) {
+            channel.m_data = static_cast<float*>(
+                AlignedAllocator::allocate(2 * m_capacity * sizeof(float), k_cache_line_size));
+        }
+    }
+    clear();
+}
+
+bool MirroredRingBuffer::map_mirrored(Channel& channel) const {
+#if defined(__linux__) && !defined(__ANDROID__)
+    size_t const bytes = m_capacity * sizeof(float);
+    int const fd = memfd_create("anira_ring_buffer", MFD_CLOEXEC);
+    if (fd < 0) { return false; }
+    if (ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+        close(fd);
+        return false;
+    }
+
+    // Reserve both halves first, so no other mapping can take the address range of the mirror
+    void* const reservation =
+        mmap(nullptr, 2 * bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reservation == MAP_FAILED) {
+        close(fd);
+        return false;
+    }
+    auto* const first = static_cast<std::byte*>(reservation);
+    bool const mapped =
+        mmap(first, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED &&
+        mmap(first + bytes, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) !=
+            MAP_FAILED;
+    // The mappings keep the memory alive
+    close(fd);
+    if (!mapped) {
+        munmap(reservation, 2 * bytes);
+        return false;
+    }
+    channel.m_mapping = reservation;
+    channel.m_data = reinterpret_cast<float*>(first);
+    return true;
+#else
+    (void)channel;
+    return false;
+#endif
+}
+
+void MirroredRingBuffer::release() {
+    for (auto& channel : m_channels) {
+        if (channel.m_mapping != nullptr) {
+#if defined(__linux__) && !defined(__ANDROID__)
+            munmap(channel.m_mapping, 2 * m_capacity * sizeof(float));
+#endif
+        } else {
+            AlignedAllocator::deallocate(channel.m_data);
+        }
+    }
+    m_channels.clear();
+    m_capacity = 0;
+    m_mask = 0;
+    m_mirrored = false;
+}
+
+void MirroredRingBuffer::clear() {
+    for (auto& channel : m_channels) {
+        // Clearing the first half clears a mapped mirror as well
+        std::fill_n(channel.m_data, m_mirrored ? m_capacity : 2 * m_capacity, 0.f);
+        channel.m_read = 0;
+        channel.m_write = 0;
+    }
+}
+
+size_t MirroredRingBuffer::get_num_channels() const {
+    return m_channels.size();
+}
+
+size_t MirroredRingBuffer::get_capacity() const {
+    return m_capacity;
+}
+
+bool MirroredRingBuffer::is_mirrored() const {
+    return m_mirrored;
+}
+
+void MirroredRingBuffer::push_sample(size_t channel, float sample) {
+    push_samples(channel, &sample, 1);
+}
+
+void MirroredRingBuffer::push_samples(size_t channel, const float* data, size_t num_samples) {
+    if (m_capacity == 0) {
+        LOG_RT_ERROR("MirroredRingBuffer: Cannot push samples to an empty buffer for channel %zu.",
+                     channel);
+        return;
+    }
+    Channel& state = m_channels[channel];
+
+    // Only the last capacity samples of a larger block survive
+    if (num_samples > m_capacity) {
+        state.m_write += num_samples - m_capacity;
+        data += num_samples - m_capacity;
+        num_samples = m_capacity;
+    }
+
+    size_t const position = state.m_write & m_mask;
+    if (m_mirrored) {
+        // The mirror continues the channel, so the block never wraps
+        std::memcpy(state.m_data + position, data, num_samples * sizeof(float));
+    } else {
+        size_t const num_first_samples = std::min(num_samples, m_capacity - position);
+        std::memcpy(state.m_data + position, data, num_first_samples * sizeof(float));
+        std::memcpy(
+            state.m_data + m_capacity + position, data, num_first_samples * sizeof(float));
+        if (num_first_samples < num_samples) {
+            size_t const num_second_samples = num_samples - num_first_samples;
+            std::memcpy(
+                state.m_data, data + num_first_samples, num_second_samples * sizeof(float));
+            std::memcpy(state.m_data + m_capacity,
+                        data + num_first_samples,
+                        num_second_samples * sizeof(float));
+        }
+    }
+    state.m_write += num_samples;
+
+    if (state.m_write - state.m_read > m_capacity) {
+        LOG_RT_ERROR("MirroredRingBuffer: Buffer overflow detected for channel %zu. Overwriting "
+                     "oldest samples.",
+                     channel);
+        state.m_read = state.m_write - m_capacity;
+    }
+}
+
+float MirroredRingBuffer::pop_sample(size_t channel) {
+    Channel& state = m_channels[channel];
+    if (state.m_read == state.m_write) {
+        LOG_RT_ERROR("MirroredRingBuffer: Attempted to pop sample from empty buffer for channel "
+                     "%zu. Returning silence (0.0f).",
+                     channel);
+        return 0.0f;
+    }
+    return state.m_data[state.m_read++ & m_mask];
+}
+
+const float* MirroredRingBuffer::get_window(size_t channel,
+                                            size_t num_new_samples,
+                                            size_t num_old_samples) const {
+    if (num_new_samples > get_available_samples(channel) ||
+        num_old_samples > get_available_past_samples(channel)) {
+        LOG_RT_ERROR("MirroredRingBuffer: Cannot get a window of %zu new and %zu old samples for "
+                     "channel %zu.",
+                     num_new_samples,
+                     num_old_samples,
+                     channel);
+        return nullptr;
+    }
+    const Channel& state = m_channels[channel];
+    // The counters wrap modulo 2^64, a multiple of the capacity, so the mask stays valid
+    return state.m_data + ((state.m_read - num_old_samples) & m_mask);
+}
+
+void MirroredRingBuffer::advance(size_t channel, size_t num_samples) {
+    Channel& state = m_channels[channel];
+    size_t const available_samples = get_available_samples(channel);
+    if (num_samples > available_samples) {
+        LOG_RT_ERROR("MirroredRingBuffer: Attempted to skip %zu samples for channel %zu, but only "
+                     "%zu samples are available.",
+                     num_samples,
+                     channel,
+                     available_samples);
+        num_samples = available_samples;
+    }
+    state.m_read += num_samples;
+}
+
+size_t MirroredRingBuffer::get_available_samples(size_t channel) const {
+    const Channel& state = m_channels[channel];
+    return static_cast<size_t>(state.m_write - state.m_read);
+}
+
+size_t MirroredRingBuffer::get_available_past_samples(size_t channel) const {
+    return m_capacity - get_available_samples(channel);
+}
+
+}  // namespace anira
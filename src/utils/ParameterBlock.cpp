@@ -0,0 +1,80 @@
+#include <anira/utils/ParameterBlock.h>
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace anira {
+
+ParameterBlock::ParameterBlock(size_t size) {
+    resize(size);
+}
+
+void ParameterBlock::resize(size_t size) {
+    m_data.resize(size);
+    for (size_t i = 0; i < m_data.size(); ++i) { m_data[i].store(0.f, std::memory_order_relaxed); }
+    m_sequence.fetch_add(2, std::memory_order_release);
+}
+
+size_t ParameterBlock::size() const {
+    return m_data.size();
+}
+
+void ParameterBlock::write(const float* data, size_t num_values, size_t offset) {
+    while (!try_write(data, num_values, offset)) { std::this_thread::yield(); }
+}
+
+bool ParameterBlock::try_write(const float* data, size_t num_values, size_t offset) {
+    assert(("Range out of bounds" && offset + num_values <= m_data.size()));
+    // Entering the write section makes the sequence odd. The exchange only fails repeatedly while
+    // single-value writes advance the sequence, an odd sequence means another whole-tensor write
+    // is in its section.
+    uint32_t sequence = m_sequence.load(std::memory_order_relaxed);
+    do {
+        if ((sequence & 1u) != 0u) { return false; }
+    } while (
+        !m_sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_relaxed));
+    // Orders the odd sequence before the values, a reader that sees a new value sees it too
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < num_values; ++i) {
+        m_data[offset + i].store(data[i], std::memory_order_relaxed);
+    }
+    // Not a store, single-value writes may have advanced the sequence in the meantime
+    m_sequence.fetch_add(1, std::memory_order_release);
+    return true;
+}
+
+bool ParameterBlock::read(float* data, size_t num_values, size_t offset) const {
+    assert(("Range out of bounds" && offset + num_values <= m_data.size()));
+    for (size_t attempt = 0; attempt < k_max_read_attempts; ++attempt) {
+        uint32_t const sequence = m_sequence.load(std::memory_order_acquire);
+        for (size_t i = 0; i < num_values; ++i) {
+            data[i] = m_data[offset + i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if ((sequence & 1u) == 0u && m_sequence.load(std::memory_order_relaxed) == sequence) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ParameterBlock::set(size_t index, float value) {
+    assert(("Index out of bounds" && index < m_data.size()));
+    m_sequence.fetch_add(2, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_data[index].store(value, std::memory_order_relaxed);
+}
+
+float ParameterBlock::get(size_t index) const {
+    assert(("Index out of bounds" && index < m_data.size()));
+    return m_data[index].load(std::memory_order_acquire);
+}
+
+uint32_t ParameterBlock::get_sequence() const {
+    return m_sequence.load(std::memory_order_acquire);
+}
+
+}  // namespace anira
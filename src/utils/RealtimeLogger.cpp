@@ -0,0 +1,231 @@
+#include <anira/utils/RealtimeLogger.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace anira {
+
+namespace {
+
+constexpr std::chrono::milliseconds k_drain_interval{10};
+
+struct Slot {
+    std::atomic<size_t> m_sequence{0};
+    LogLevel m_level = LogLevel::Info;
+    std::array<char, RealtimeLogger::k_message_size> m_message{};
+};
+
+// Bounded multi-producer queue after Dmitry Vyukov: every slot carries a sequence number that
+// tells producers whether it is free for their position and the consumer whether it is filled
+struct Ring {
+    Ring() {
+        for (size_t i = 0; i < RealtimeLogger::k_capacity; ++i) {
+            m_slots[i].m_sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    std::array<Slot, RealtimeLogger::k_capacity> m_slots;
+    std::atomic<size_t> m_enqueue_pos{0};
+    size_t m_dequeue_pos = 0;  // Guarded by LoggerState::m_consumer_mutex
+};
+
+// Trivially destructible state can live in constant-initialized globals
+std::atomic<uint8_t> s_level{static_cast<uint8_t>(LogLevel::Info)};
+std::atomic<uint64_t> s_dropped_messages{0};
+std::atomic<bool> s_running{false};
+std::atomic<bool> s_rate_limiting{true};
+
+// The remaining state is created on first use and intentionally never destroyed, so the Context
+// singleton and static destructors in other translation units can still log and stop the thread
+struct LoggerState {
+    Ring m_ring;
+    std::mutex m_consumer_mutex;
+    RealtimeLogger::Sink m_sink;
+    std::mutex m_thread_mutex;
+    size_t m_num_users = 0;
+    std::thread m_drain_thread;
+};
+
+LoggerState& get_state() {
+    static auto* state = new LoggerState();
+    return *state;
+}
+
+int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void default_sink(LogLevel level, const char* message) {
+    switch (level) {
+        case LogLevel::Info:
+            std::cout << "[INFO] " << message << '\n';
+            break;
+        case LogLevel::Warning:
+            std::cout << "[WARNING] " << message << '\n';
+            break;
+        default:
+            std::cerr << "[ERROR] " << message << '\n';
+            break;
+    }
+}
+
+// Creates the state at load time, so the first message does not allocate on a real-time thread,
+// and prints messages that were logged after the last Context was released
+struct FinalFlush {
+    FinalFlush() { get_state(); }
+    FinalFlush(const FinalFlush&) = delete;
+    FinalFlush& operator=(const FinalFlush&) = delete;
+    ~FinalFlush() { RealtimeLogger::flush(); }
+} s_final_flush;
+
+}  // namespace
+
+bool LogRateLimiter::allow(int64_t now_ns, uint32_t& suppressed) {
+    int64_t window_start = m_window_start_ns.load(std::memory_order_relaxed);
+    if (now_ns - window_start >= k_window_ns) {
+        if (m_window_start_ns.compare_exchange_strong(window_start,
+                                                      now_ns,
+                                                      std::memory_order_relaxed)) {
+            m_count.store(0, std::memory_order_relaxed);
+        }
+    }
+    if (m_count.fetch_add(1, std::memory_order_relaxed) < k_burst) {
+        suppressed = m_suppressed.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+    m_suppressed.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void RealtimeLogger::log(LogLevel level, LogRateLimiter* rate_limiter, const char* format, ...) {
+    if (static_cast<uint8_t>(level) < s_level.load(std::memory_order_relaxed)) { return; }
+
+    uint32_t suppressed = 0;
+    if (rate_limiter != nullptr && s_rate_limiting.load(std::memory_order_relaxed) &&
+        !rate_limiter->allow(now_ns(), suppressed)) {
+        return;
+    }
+
+    Ring& ring = get_state().m_ring;
+    size_t pos = ring.m_enqueue_pos.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true) {
+        slot = &ring.m_slots[pos % k_capacity];
+        size_t const sequence = slot->m_sequence.load(std::memory_order_acquire);
+        auto const diff = static_cast<std::ptrdiff_t>(sequence - pos);
+        if (diff == 0) {
+            if (ring.m_enqueue_pos.compare_exchange_weak(pos,
+                                                         pos + 1,
+                                                         std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            s_dropped_messages.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            pos = ring.m_enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->m_level = level;
+    va_list args;
+    va_start(args, format);
+    int length = std::vsnprintf(slot->m_message.data(), k_message_size, format, args);
+    va_end(args);
+    if (suppressed > 0 && length >= 0 && static_cast<size_t>(length) < k_message_size) {
+        std::snprintf(slot->m_message.data() + length,
+                      k_message_size - static_cast<size_t>(length),
+                      " (%u similar messages suppressed)",
+                      suppressed);
+    }
+    slot->m_sequence.store(pos + 1, std::memory_order_release);
+}
+
+void RealtimeLogger::set_level(LogLevel level) {
+    s_level.store(static_cast<uint8_t>(level), std::memory_order_relaxed);
+}
+
+LogLevel RealtimeLogger::get_level() {
+    return static_cast<LogLevel>(s_level.load(std::memory_order_relaxed));
+}
+
+void RealtimeLogger::set_rate_limiting(bool enabled) {
+    s_rate_limiting.store(enabled, std::memory_order_relaxed);
+}
+
+void RealtimeLogger::set_sink(Sink sink) {
+    LoggerState& state = get_state();
+    std::lock_guard<std::mutex> const lock(state.m_consumer_mutex);
+    state.m_sink = std::move(sink);
+}
+
+void RealtimeLogger::start() {
+    LoggerState& state = get_state();
+    std::lock_guard<std::mutex> const lock(state.m_thread_mutex);
+    if (state.m_num_users++ > 0) { return; }
+    s_running.store(true, std::memory_order_release);
+    state.m_drain_thread = std::thread(&RealtimeLogger::drain_loop);
+}
+
+void RealtimeLogger::stop() {
+    LoggerState& state = get_state();
+    std::lock_guard<std::mutex> const lock(state.m_thread_mutex);
+    if (state.m_num_users == 0 || --state.m_num_users > 0) { return; }
+    s_running.store(false, std::memory_order_release);
+    if (state.m_drain_thread.joinable()) { state.m_drain_thread.join(); }
+    flush();
+}
+
+void RealtimeLogger::flush() {
+    LoggerState& state = get_state();
+    Ring& ring = state.m_ring;
+    std::lock_guard<std::mutex> const lock(state.m_consumer_mutex);
+    std::array<char, k_message_size> message{};
+    while (true) {
+        Slot& slot = ring.m_slots[ring.m_dequeue_pos % k_capacity];
+        if (slot.m_sequence.load(std::memory_order_acquire) != ring.m_dequeue_pos + 1) { break; }
+        LogLevel const level = slot.m_level;
+        message = slot.m_message;
+        slot.m_sequence.store(ring.m_dequeue_pos + k_capacity, std::memory_order_release);
+        ++ring.m_dequeue_pos;
+
+        if (state.m_sink) {
+            state.m_sink(level, message.data());
+        } else {
+            default_sink(level, message.data());
+        }
+    }
+
+    uint64_t const dropped = s_dropped_messages.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0) {
+        std::snprintf(message.data(),
+                      k_message_size,
+                      "Realtime logger dropped %llu messages!",
+                      static_cast<unsigned long long>(dropped));
+        if (state.m_sink) {
+            state.m_sink(LogLevel::Warning, message.data());
+        } else {
+            default_sink(LogLevel::Warning, message.data());
+        }
+    }
+}
+
+void RealtimeLogger::drain_loop() {
+    while (s_running.load(std::memory_order_acquire)) {
+        flush();
+        std::this_thread::sleep_for(k_drain_interval);
+    }
+}
+
+}  // namespace anira
@@ -0,0 +1,287 @@
+#include <anira/utils/Logger.h>
+#include <anira/utils/Resampler.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numbers>
+#include <numeric>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64)
+#include <immintrin.h>
+#define ANIRA_RESAMPLER_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define ANIRA_RESAMPLER_NEON
+#endif
+
+namespace anira {
+
+namespace {
+
+struct FilterParameters {
+    size_t m_num_taps;  ///< Taps per phase for ratios that do not downsample
+    double m_beta;      ///< Shape parameter of the Kaiser window
+};
+
+FilterParameters get_filter_parameters(ResamplerQuality quality) {
+    switch (quality) {
+        case LOW_QUALITY:
+            return {32, 6.};
+        case HIGH_QUALITY:
+            return {128, 10.};
+        case MEDIUM_QUALITY:
+        default:
+            return {64, 8.};
+    }
+}
+
+// Zeroth-order modified Bessel function of the first kind, evaluated by its power series
+double bessel_i0(double x) {
+    double const half = x / 2.;
+    double sum = 1.;
+    double term = 1.;
+    for (int k = 1; k < 64 && term > sum * 1e-12; ++k) {
+        term *= (half / k) * (half / k);
+        sum += term;
+    }
+    return sum;
+}
+
+// The number of taps is a multiple of eight, both SIMD paths run two accumulators of four lanes
+float dot(const float* samples, const float* coefficients, size_t num_taps) {
+#if defined(ANIRA_RESAMPLER_SSE)
+    __m128 sum_0 = _mm_setzero_ps();
+    __m128 sum_1 = _mm_setzero_ps();
+    for (size_t i = 0; i < num_taps; i += 8) {
+        sum_0 = _mm_add_ps(
+            sum_0, _mm_mul_ps(_mm_loadu_ps(samples + i), _mm_loadu_ps(coefficients + i)));
+        sum_1 = _mm_add_ps(
+            sum_1, _mm_mul_ps(_mm_loadu_ps(samples + i + 4), _mm_loadu_ps(coefficients + i + 4)));
+    }
+    __m128 sum = _mm_add_ps(sum_0, sum_1);
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    return _mm_cvtss_f32(sum);
+#elif defined(ANIRA_RESAMPLER_NEON)
+    float32x4_t sum_0 = vdupq_n_f32(0.f);
+    float32x4_t sum_1 = vdupq_n_f32(0.f);
+    for (size_t i = 0; i < num_taps; i += 8) {
+        sum_0 = vmlaq_f32(sum_0, vld1q_f32(samples + i), vld1q_f32(coefficients + i));
+        sum_1 = vmlaq_f32(sum_1, vld1q_f32(samples + i + 4), vld1q_f32(coefficients + i + 4));
+    }
+    float32x4_t const sum = vaddq_f32(sum_0, sum_1);
+    float32x2_t const half = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+    return vget_lane_f32(vpadd_f32(half, half), 0);
+#else
+    float sum[8] = {};
+    for (size_t i = 0; i < num_taps; i += 8) {
+        for (size_t lane = 0; lane < 8; ++lane) {
+            sum[lane] += samples[i + lane] * coefficients[i + lane];
+        }
+    }
+    return ((sum[0] + sum[4]) + (sum[1] + sum[5])) + ((sum[2] + sum[6]) + (sum[3] + sum[7]));
+#endif
+}
+
+}  // namespace
+
+void Resampler::prepare(size_t num_channels,
+                        double source_sample_rate,
+                        double target_sample_rate,
+                        ResamplerQuality quality,
+                        size_t max_num_input_samples) {
+    auto const source = static_cast<uint64_t>(std::llround(source_sample_rate));
+    auto const target = static_cast<uint64_t>(std::llround(target_sample_rate));
+    if (source == 0 || target == 0) {
+        LOG_ERROR << "Resampler: Invalid sample rates " << source_sample_rate << " Hz and "
+                  << target_sample_rate << " Hz, passing the samples through." << '\n';
+        m_interpolation = 1;
+        m_decimation = 1;
+    } else {
+        uint64_t const divisor = std::gcd(source, target);
+        m_interpolation = target / divisor;
+        m_decimation = source / divisor;
+    }
+    m_num_phases = std::min(m_interpolation, k_max_num_phases);
+
+    // Downsampling narrows the passband relative to the source rate, the filter spans
+    // proportionally more source samples to keep the transition band as wide in target samples
+    size_t const num_taps = get_num_taps(quality);
+    double const ratio = static_cast<double>(m_decimation) / static_cast<double>(m_interpolation);
+    m_num_taps = num_taps;
+    if (ratio > 1.) {
+        m_num_taps = (static_cast<size_t>(std::ceil(static_cast<double>(num_taps) * ratio)) + 7) /
+                     8 * 8;
+    }
+    design_filter(quality);
+
+    m_max_num_input_samples = max_num_input_samples;
+    m_history.assign(num_channels, std::vector<float>(m_num_taps + max_num_input_samples, 0.f));
+    m_phase_offset = 0;
+    reset();
+}
+
+void Resampler::reset() {
+    for (auto& history : m_history) { std::fill(history.begin(), history.end(), 0.f); }
+    // The history starts with the zeros the first output sample looks back on
+    m_num_history = m_num_taps > 0 ? m_num_taps - 1 : 0;
+    m_time = static_cast<uint64_t>(m_num_history) * m_interpolation + m_phase_offset;
+}
+
+void Resampler::set_phase_offset(uint64_t phase_offset) {
+    m_phase_offset = phase_offset;
+    reset();
+}
+
+size_t Resampler::process(const float* const* input,
+                          size_t num_input_samples,
+                          float* const* output,
+                          size_t max_num_output_samples) {
+    size_t const capacity = m_history.empty() ? 0 : m_history.front().size();
+    if (m_num_history + num_input_samples > capacity) {
+        LOG_RT_ERROR("Resampler: %zu input samples exceed the capacity, dropping %zu samples.",
+                     num_input_samples,
+                     m_num_history + num_input_samples - capacity);
+        num_input_samples = capacity - m_num_history;
+    }
+    if (num_input_samples > 0) {
+        for (size_t channel = 0; channel < m_history.size(); ++channel) {
+            std::memcpy(m_history[channel].data() + m_num_history,
+                        input[channel],
+                        num_input_samples * sizeof(float));
+        }
+    }
+    m_num_history += num_input_samples;
+
+    // An output sample is complete once the newest sample of its window is in the history
+    uint64_t const end = static_cast<uint64_t>(m_num_history) * m_interpolation;
+    size_t num_output_samples = 0;
+    for (; num_output_samples < max_num_output_samples && m_time < end;
+         ++num_output_samples, m_time += m_decimation) {
+        size_t const start = static_cast<size_t>(m_time / m_interpolation) + 1 - m_num_taps;
+        uint64_t const phase = (m_time % m_interpolation) * m_num_phases / m_interpolation;
+        const float* coefficients = m_coefficients.data() + phase * m_num_taps;
+        for (size_t channel = 0; channel < m_history.size(); ++channel) {
+            output[channel][num_output_samples] =
+                dot(m_history[channel].data() + start, coefficients, m_num_taps);
+        }
+    }
+
+    // Drops the samples that are older than the window of the next output sample
+    size_t const first_needed = static_cast<size_t>(m_time / m_interpolation) + 1 - m_num_taps;
+    size_t const num_dropped = std::min(first_needed, m_num_history);
+    if (num_dropped > 0) {
+        for (auto& history : m_history) {
+            std::memmove(history.data(),
+                         history.data() + num_dropped,
+                         (m_num_history - num_dropped) * sizeof(float));
+        }
+        m_num_history -= num_dropped;
+        m_time -= static_cast<uint64_t>(num_dropped) * m_interpolation;
+    }
+    return num_output_samples;
+}
+
+size_t Resampler::get_num_output_samples(size_t num_input_samples) const {
+    uint64_t const end =
+        static_cast<uint64_t>(m_num_history + num_input_samples) * m_interpolation;
+    if (m_time >= end) { return 0; }
+    return static_cast<size_t>((end - m_time + m_decimation - 1) / m_decimation);
+}
+
+size_t Resampler::get_num_input_samples(size_t num_output_samples) const {
+    if (num_output_samples == 0) { return 0; }
+    uint64_t const last = m_time + static_cast<uint64_t>(num_output_samples - 1) * m_decimation;
+    auto const num_needed = static_cast<size_t>(last / m_interpolation) + 1;
+    return num_needed > m_num_history ? num_needed - m_num_history : 0;
+}
+
+size_t Resampler::get_max_num_output_samples(size_t num_input_samples) const {
+    return static_cast<size_t>(
+               (static_cast<uint64_t>(num_input_samples) * m_interpolation + m_decimation - 1) /
+               m_decimation) +
+           1;
+}
+
+double Resampler::get_latency() const {
+    double const group_delay =
+        (static_cast<double>(m_num_taps * m_interpolation) - 1.) / 2.;
+    return (group_delay - static_cast<double>(m_phase_offset)) /
+           static_cast<double>(m_decimation);
+}
+
+uint64_t Resampler::get_interpolation_factor() const {
+    return m_interpolation;
+}
+
+uint64_t Resampler::get_decimation_factor() const {
+    return m_decimation;
+}
+
+size_t Resampler::get_num_taps() const {
+    return m_num_taps;
+}
+
+size_t Resampler::get_max_num_input_samples() const {
+    return m_max_num_input_samples;
+}
+
+size_t Resampler::get_memory_size() const {
+    size_t num_values = m_coefficients.size();
+    for (const auto& history : m_history) { num_values += history.size(); }
+    return num_values * sizeof(float);
+}
+
+size_t Resampler::get_num_taps(ResamplerQuality quality) {
+    return get_filter_parameters(quality).m_num_taps;
+}
+
+void Resampler::design_filter(ResamplerQuality quality) {
+    FilterParameters const parameters = get_filter_parameters(quality);
+
+    // Places the cutoff so that the transition band of the Kaiser window ends at the Nyquist
+    // frequency of the lower of both rates
+    double const attenuation = parameters.m_beta / 0.1102 + 8.7;
+    double const cutoff = 1. - (attenuation - 8.) /
+                                   (14.36 * static_cast<double>(parameters.m_num_taps));
+    double const nyquist =
+        std::min(1., static_cast<double>(m_interpolation) / static_cast<double>(m_decimation));
+    // Cutoff in cycles per sample of the signal upsampled by the number of phases
+    double const frequency = cutoff * nyquist / (2. * static_cast<double>(m_num_phases));
+
+    size_t const length = m_num_taps * m_num_phases;
+    double const center = (static_cast<double>(length) - 1.) / 2.;
+    double const window_norm = bessel_i0(parameters.m_beta);
+    std::vector<double> prototype(length);
+    for (size_t n = 0; n < length; ++n) {
+        double const x = static_cast<double>(n) - center;
+        double const sinc = x == 0. ? 1.
+                                    : std::sin(2. * std::numbers::pi * frequency * x) /
+                                          (2. * std::numbers::pi * frequency * x);
+        double const position = center > 0. ? x / center : 0.;
+        double const window =
+            bessel_i0(parameters.m_beta * std::sqrt(std::max(0., 1. - position * position))) /
+            window_norm;
+        prototype[n] = sinc * window;
+    }
+
+    // Every phase is normalized to unity gain at DC, the reversed taps run forward over the
+    // history
+    m_coefficients.assign(length, 0.f);
+    for (size_t phase = 0; phase < m_num_phases; ++phase) {
+        double sum = 0.;
+        for (size_t tap = 0; tap < m_num_taps; ++tap) {
+            sum += prototype[phase + tap * m_num_phases];
+        }
+        for (size_t tap = 0; tap < m_num_taps; ++tap) {
+            m_coefficients[phase * m_num_taps + m_num_taps - 1 - tap] =
+                static_cast<float>(prototype[phase + tap * m_num_phases] / sum);
+        }
+    }
+}
+
+}  // namespace anira
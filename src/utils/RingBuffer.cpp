@@ -1,14 +1,22 @@
 #include <anira/utils/Logger.h>
 #include <anira/utils/RingBuffer.h>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
 
 namespace anira {
 
 RingBuffer::RingBuffer() = default;
 
-void RingBuffer::initialize_with_positions(size_t num_channels, size_t num_samples) {
-    resize(num_channels, num_samples);
+void RingBuffer::initialize_with_positions(size_t num_channels,
+                                           size_t num_samples,
+                                           float* memory) {
+    if (memory != nullptr) {
+        resize(num_channels, num_samples, memory);
+    } else {
+        resize(num_channels, num_samples);
+    }
     clear();
     m_read_pos.resize(get_num_channels());
     m_write_pos.resize(get_num_channels());
@@ -31,10 +39,18 @@ void RingBuffer::clear_with_positions() {
 }
 
 void RingBuffer::push_sample(size_t channel, float sample) {
+    // An empty buffer holds no memory to write to
+    if (get_num_samples() == 0) {
+        LOG_RT_ERROR("RingBuffer: Cannot push a sample to an empty buffer for channel %zu.",
+                     channel);
+        return;
+    }
+
     // Check if we're about to overwrite unread data (buffer overflow)
     if (m_is_full[channel]) {
-        LOG_ERROR << "RingBuffer: Buffer overflow detected for channel " << channel
-                  << ". Overwriting oldest sample." << '\n';
+        LOG_RT_ERROR("RingBuffer: Buffer overflow detected for channel %zu. Overwriting oldest "
+                     "sample.",
+                     channel);
         // Advance read position to make room (overwrite oldest sample)
         ++m_read_pos[channel];
         if (m_read_pos[channel] >= get_num_samples()) { m_read_pos[channel] = 0; }
@@ -54,8 +70,9 @@ void RingBuffer::push_sample(size_t channel, float sample) {
 float RingBuffer::pop_sample(size_t channel) {
     // Check if buffer is empty
     if (!m_is_full[channel] && m_read_pos[channel] == m_write_pos[channel]) {
-        LOG_ERROR << "RingBuffer: Attempted to pop sample from empty buffer for channel " << channel
-                  << ". Returning silence (0.0f)." << '\n';
+        LOG_RT_ERROR("RingBuffer: Attempted to pop sample from empty buffer for channel %zu. "
+                     "Returning silence (0.0f).",
+                     channel);
         return 0.0f;
     }
 
@@ -72,9 +89,11 @@ float RingBuffer::pop_sample(size_t channel) {
 
 float RingBuffer::get_future_sample(size_t channel, size_t offset) {
     if (offset >= get_available_samples(channel)) {
-        LOG_ERROR << "RingBuffer: Attempted to get sample with offset " << offset << " for channel "
-                  << channel << ", but only " << get_available_samples(channel)
-                  << " samples are available. Returning silence (0.0f)." << '\n';
+        LOG_RT_ERROR("RingBuffer: Attempted to get sample with offset %zu for channel %zu, but only "
+                     "%zu samples are available. Returning silence (0.0f).",
+                     offset,
+                     channel,
+                     get_available_samples(channel));
         return 0.0f;
     }
 
@@ -86,10 +105,11 @@ float RingBuffer::get_future_sample(size_t channel, size_t offset) {
 float RingBuffer::get_past_sample(size_t channel, size_t offset) {
     // offset 0 = the most recently read sample, offset 1 = the sample before that, etc.
     if (offset > get_available_past_samples(channel)) {
-        LOG_ERROR << "RingBuffer: Attempted to get past sample with offset " << offset
-                  << " for channel " << channel << ", but only "
-                  << get_available_past_samples(channel)
-                  << " past samples are available. Returning silence (0.0f)." << '\n';
+        LOG_RT_ERROR("RingBuffer: Attempted to get past sample with offset %zu for channel %zu, but "
+                     "only %zu past samples are available. Returning silence (0.0f).",
+                     offset,
+                     channel,
+                     get_available_past_samples(channel));
         return 0.0f;
     }
 
@@ -104,6 +124,96 @@ float RingBuffer::get_past_sample(size_t channel, size_t offset) {
     return get_sample(channel, sample_pos);
 }
 
+bool RingBuffer::pop_window(size_t channel,
+                            float* destination,
+                            size_t num_new_samples,
+                            size_t num_old_samples) {
+    return pop_windows(channel,
+                       destination,
+                       1,
+                       num_new_samples + num_old_samples,
+                       num_new_samples,
+                       num_new_samples + num_old_samples);
+}
+
+bool RingBuffer::pop_windows(size_t channel,
+                             float* destination,
+                             size_t num_windows,
+                             size_t window_size,
+                             size_t hop_size,
+                             size_t destination_stride) {
+    size_t const num_samples = get_num_samples();
+    size_t const num_new_samples = num_windows * hop_size;
+    size_t const num_old_samples = window_size > hop_size ? window_size - hop_size : 0;
+    size_t const available_samples = get_available_samples(channel);
+    size_t const available_past_samples = get_available_past_samples(channel);
+
+    if (num_new_samples > available_samples || window_size > num_samples) {
+        LOG_RT_ERROR("RingBuffer: Cannot copy %zu windows of %zu samples for channel %zu, only "
+                     "%zu new samples are available. Returning silence (0.0f).",
+                     num_windows,
+                     window_size,
+                     channel,
+                     available_samples);
+        for (size_t window = 0; window < num_windows; ++window) {
+            std::fill_n(destination + window * destination_stride, window_size, 0.f);
+        }
+        size_t const num_skipped_samples = std::min(num_new_samples, available_samples);
+        if (num_skipped_samples > 0) {
+            m_read_pos[channel] = (m_read_pos[channel] + num_skipped_samples) % num_samples;
+            m_is_full[channel] = false;
+        }
+        return false;
+    }
+
+    // Past samples that were overwritten, e.g. all of them when the buffer is full, are the
+    // oldest of the stream and become silence, the new samples are still copied
+    size_t const num_missing_samples =
+        num_old_samples > available_past_samples ? num_old_samples - available_past_samples : 0;
+    if (num_missing_samples > 0) {
+        LOG_RT_ERROR("RingBuffer: Only %zu of %zu past samples are available for channel %zu. "
+                     "Returning silence (0.0f) for the missing ones.",
+                     available_past_samples,
+                     num_old_samples,
+                     channel);
+    }
+
+    const float* samples = get_read_pointer(channel);
+    // Start of the first window, the old samples precede the read position
+    size_t position = num_old_samples <= m_read_pos[channel]
+                          ? m_read_pos[channel] - num_old_samples
+                          : num_samples + m_read_pos[channel] - num_old_samples;
+    // The first window starts hop_size samples early if it holds fewer samples than a hop
+    size_t window_start = hop_size - std::min(hop_size, window_size);
+    position += window_start;
+    if (position >= num_samples) { position -= num_samples; }
+
+    for (size_t window = 0; window < num_windows; ++window) {
+        float* window_destination = destination + window * destination_stride;
+        size_t const num_first_samples = std::min(window_size, num_samples - position);
+        std::memcpy(window_destination, samples + position, num_first_samples * sizeof(float));
+        if (num_first_samples < window_size) {
+            std::memcpy(window_destination + num_first_samples,
+                        samples,
+                        (window_size - num_first_samples) * sizeof(float));
+        }
+        if (window_start < num_missing_samples) {
+            std::fill_n(window_destination,
+                        std::min(window_size, num_missing_samples - window_start),
+                        0.f);
+        }
+        window_start += hop_size;
+        position += hop_size;
+        if (position >= num_samples) { position -= num_samples; }
+    }
+
+    if (num_new_samples > 0) {
+        m_read_pos[channel] = (m_read_pos[channel] + num_new_samples) % num_samples;
+        m_is_full[channel] = false;
+    }
+    return num_missing_samples == 0;
+}
+
 size_t RingBuffer::get_available_samples(size_t channel) {
     if (m_is_full[channel]) {
         return get_num_samples();  // Buffer is completely full
@@ -0,0 +1,257 @@
+#include <anira/utils/SpectralTransform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <numbers>
+#include <vector>
+
+namespace anira {
+
+namespace {
+
+constexpr float k_min_power = 1e-10f;
+
+// HTK mel scale
+double hertz_to_mel(double frequency) {
+    return 2595. * std::log10(1. + frequency / 700.);
+}
+
+double mel_to_hertz(double mel) {
+    return 700. * (std::pow(10., mel / 2595.) - 1.);
+}
+
+}  // namespace
+
+void SpectralTransform::prepare(const SpectralSpec& spec,
+                                size_t num_channels,
+                                size_t num_samples,
+                                float sample_rate) {
+    m_spec = spec;
+    m_num_channels = num_channels;
+    m_num_frames = 0;
+    m_span = 0;
+    m_window.clear();
+    m_synthesis_window.clear();
+    m_mel_first_bin.clear();
+    m_mel_offset.clear();
+    m_mel_weights.clear();
+    if (!spec.is_enabled() || spec.m_hop_size == 0) {
+        m_spec = SpectralSpec();
+        return;
+    }
+
+    size_t const fft_size = spec.m_fft_size;
+    size_t const hop_size = spec.m_hop_size;
+    m_fft.prepare(fft_size);
+    if (m_fft.get_size() != fft_size) {
+        m_spec = SpectralSpec();
+        return;
+    }
+    m_num_frames = num_samples / hop_size;
+    m_span = m_num_frames > 0 ? (m_num_frames - 1) * hop_size + fft_size : 0;
+
+    m_window.resize(fft_size);
+    for (size_t n = 0; n < fft_size; ++n) {
+        m_window[n] = static_cast<float>(
+            0.5 - 0.5 * std::cos(2. * std::numbers::pi * static_cast<double>(n) /
+                                 static_cast<double>(fft_size)));
+    }
+
+    // Every sample is covered by the frames whose window positions are congruent modulo the hop
+    std::vector<double> norm(hop_size, 0.);
+    for (size_t n = 0; n < fft_size; ++n) {
+        norm[n % hop_size] += static_cast<double>(m_window[n]) * static_cast<double>(m_window[n]);
+    }
+    m_synthesis_window.resize(fft_size);
+    for (size_t n = 0; n < fft_size; ++n) {
+        double const weight = norm[n % hop_size];
+        m_synthesis_window[n] =
+            weight > 1e-6 ? static_cast<float>(static_cast<double>(m_window[n]) / weight) : 0.f;
+    }
+
+    if (spec.m_feature == LOG_MEL_SPECTRUM) { prepare_mel_filters(sample_rate); }
+}
+
+bool SpectralTransform::is_enabled() const {
+    return m_spec.is_enabled();
+}
+
+const SpectralSpec& SpectralTransform::get_spec() const {
+    return m_spec;
+}
+
+size_t SpectralTransform::get_num_frames() const {
+    return m_num_frames;
+}
+
+size_t SpectralTransform::get_overlap() const {
+    return m_spec.get_overlap();
+}
+
+size_t SpectralTransform::get_signal_size() const {
+    return m_num_channels * m_span;
+}
+
+size_t SpectralTransform::get_feature_size() const {
+    return m_num_channels * m_num_frames * m_spec.get_frame_size();
+}
+
+size_t SpectralTransform::get_work_size() const {
+    if (!is_enabled()) { return 0; }
+    return m_spec.m_fft_size + 2 * m_spec.get_num_bins();
+}
+
+size_t SpectralTransform::get_tail_size() const {
+    return m_num_channels * get_overlap();
+}
+
+void SpectralTransform::analyze(const float* signal, float* features, float* work) const {
+    size_t const fft_size = m_spec.m_fft_size;
+    size_t const hop_size = m_spec.m_hop_size;
+    size_t const num_bins = m_spec.get_num_bins();
+    size_t const frame_size = m_spec.get_frame_size();
+    float* windowed = work;
+    float* real = work + fft_size;
+    float* imag = real + num_bins;
+
+    for (size_t channel = 0; channel < m_num_channels; ++channel) {
+        const float* channel_signal = signal + channel * m_span;
+        for (size_t frame = 0; frame < m_num_frames; ++frame) {
+            const float* frame_signal = channel_signal + frame * hop_size;
+            for (size_t n = 0; n < fft_size; ++n) { windowed[n] = frame_signal[n] * m_window[n]; }
+            m_fft.forward(windowed, real, imag);
+
+            float* frame_features = features + (channel * m_num_frames + frame) * frame_size;
+            switch (m_spec.m_feature) {
+                case COMPLEX_SPECTRUM:
+                    for (size_t k = 0; k < num_bins; ++k) {
+                        frame_features[2 * k] = real[k];
+                        frame_features[2 * k + 1] = imag[k];
+                    }
+                    break;
+                case MAGNITUDE_SPECTRUM:
+                    for (size_t k = 0; k < num_bins; ++k) {
+                        frame_features[k] = std::sqrt(real[k] * real[k] + imag[k] * imag[k]);
+                    }
+                    break;
+                case LOG_MEL_SPECTRUM:
+                    // The power overwrites the windowed frame, which is no longer needed
+                    for (size_t k = 0; k < num_bins; ++k) {
+                        windowed[k] = real[k] * real[k] + imag[k] * imag[k];
+                    }
+                    for (size_t mel = 0; mel < m_spec.m_num_mels; ++mel) {
+                        const float* power = windowed + m_mel_first_bin[mel];
+                        float energy = 0.f;
+                        for (size_t w = m_mel_offset[mel]; w < m_mel_offset[mel + 1]; ++w) {
+                            energy += m_mel_weights[w] * *power++;
+                        }
+                        frame_features[mel] = std::log(std::max(energy, k_min_power));
+                    }
+                    break;
+                case NO_SPECTRAL_FEATURE:
+                default:
+                    break;
+            }
+        }
+    }
+}
+
+void SpectralTransform::synthesize(const float* features, float* signal, float* work) const {
+    size_t const fft_size = m_spec.m_fft_size;
+    size_t const hop_size = m_spec.m_hop_size;
+    size_t const num_bins = m_spec.get_num_bins();
+    float* samples = work;
+    float* real = work + fft_size;
+    float* imag = real + num_bins;
+
+    std::fill_n(signal, get_signal_size(), 0.f);
+    for (size_t channel = 0; channel < m_num_channels; ++channel) {
+        float* channel_signal = signal + channel * m_span;
+        for (size_t frame = 0; frame < m_num_frames; ++frame) {
+            const float* spectrum = features + (channel * m_num_frames + frame) * 2 * num_bins;
+            for (size_t k = 0; k < num_bins; ++k) {
+                real[k] = spectrum[2 * k];
+                imag[k] = spectrum[2 * k + 1];
+            }
+            m_fft.inverse(real, imag, samples);
+
+            float* frame_signal = channel_signal + frame * hop_size;
+            for (size_t n = 0; n < fft_size; ++n) {
+                frame_signal[n] += samples[n] * m_synthesis_window[n];
+            }
+        }
+    }
+}
+
+void SpectralTransform::overlap_add(float* signal, float* tail) const {
+    size_t const overlap = get_overlap();
+    size_t const num_samples = m_num_frames * m_spec.m_hop_size;
+    // Channels move towards the front, so packing them in increasing order never overwrites a
+    // channel that is not packed yet
+    for (size_t channel = 0; channel < m_num_channels; ++channel) {
+        float* channel_signal = signal + channel * m_span;
+        float* channel_tail = tail + channel * overlap;
+        for (size_t n = 0; n < overlap; ++n) { channel_signal[n] += channel_tail[n]; }
+        std::memcpy(channel_tail, channel_signal + num_samples, overlap * sizeof(float));
+        std::memmove(
+            signal + channel * num_samples, channel_signal, num_samples * sizeof(float));
+    }
+}
+
+size_t SpectralTransform::get_memory_size() const {
+    return m_fft.get_memory_size() +
+           (m_window.size() + m_synthesis_window.size() + m_mel_weights.size()) * sizeof(float) +
+           (m_mel_first_bin.size() + m_mel_offset.size()) * sizeof(size_t);
+}
+
+void SpectralTransform::prepare_mel_filters(float sample_rate) {
+    size_t const num_mels = m_spec.m_num_mels;
+    size_t const num_bins = m_spec.get_num_bins();
+    double const nyquist = static_cast<double>(sample_rate) / 2.;
+    double const max_frequency =
+        m_spec.m_max_frequency > 0.f
+            ? std::min(static_cast<double>(m_spec.m_max_frequency), nyquist)
+            : nyquist;
+    double const min_mel = hertz_to_mel(static_cast<double>(m_spec.m_min_frequency));
+    double const max_mel = hertz_to_mel(max_frequency);
+
+    // Band m rises from edge m to edge m + 1 and falls to edge m + 2
+    std::vector<double> edges(num_mels + 2);
+    for (size_t i = 0; i < edges.size(); ++i) {
+        edges[i] = mel_to_hertz(min_mel + (max_mel - min_mel) * static_cast<double>(i) /
+                                              static_cast<double>(num_mels + 1));
+    }
+
+    double const bin_width = static_cast<double>(sample_rate) /
+                             static_cast<double>(m_spec.m_fft_size);
+    m_mel_first_bin.resize(num_mels);
+    m_mel_offset.resize(num_mels + 1);
+    m_mel_offset[0] = 0;
+    for (size_t mel = 0; mel < num_mels; ++mel) {
+        double const lower = edges[mel];
+        double const center = edges[mel + 1];
+        double const upper = edges[mel + 2];
+        m_mel_first_bin[mel] = 0;
+        bool found = false;
+        for (size_t k = 0; k < num_bins; ++k) {
+            double const frequency = static_cast<double>(k) * bin_width;
+            double const rising = (frequency - lower) / std::max(center - lower, 1e-9);
+            double const falling = (upper - frequency) / std::max(upper - center, 1e-9);
+            double const weight = std::min(rising, falling);
+            if (weight <= 0.) {
+                if (found) { break; }
+                continue;
+            }
+            if (!found) {
+                m_mel_first_bin[mel] = k;
+                found = true;
+            }
+            m_mel_weights.push_back(static_cast<float>(weight));
+        }
+        m_mel_offset[mel + 1] = m_mel_weights.size();
+    }
+}
+
+}  // namespace anira
@@ -0,0 +1,227 @@
+#include <anira/utils/Logger.h>
+#include <anira/utils/Tracer.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace anira {
+
+namespace {
+
+// Single-producer single-consumer ring, written by the thread that claimed it and drained by the
+// flush thread
+struct ThreadBuffer {
+    std::array<TraceEvent, Tracer::k_buffer_capacity> m_events;
+    std::atomic<size_t> m_write{0};
+    std::atomic<size_t> m_read{0};
+    std::atomic<bool> m_claimed{false};
+};
+
+// The buffers are allocated on the first start and intentionally never freed, since threads keep
+// a pointer to their claimed buffer until they exit
+ThreadBuffer* s_buffers = nullptr;
+std::atomic<uint32_t> s_next_thread_id{0};
+std::atomic<uint64_t> s_num_released_buffers{0};
+std::atomic<bool> s_running{false};
+std::atomic<uint64_t> s_dropped_events{0};
+std::atomic<int64_t> s_start_time_ns{0};
+
+std::mutex s_mutex;
+std::ofstream s_file;
+bool s_first_event = true;
+std::thread s_flush_thread;
+
+// Claims a free buffer on the first event of a thread and hands it back when the thread exits, so
+// short-lived threads do not exhaust the buffers
+struct ThreadBufferClaim {
+    ThreadBufferClaim() : m_thread_id(s_next_thread_id.fetch_add(1, std::memory_order_relaxed)) {
+        claim();
+    }
+    ~ThreadBufferClaim() {
+        if (m_buffer != nullptr) {
+            m_buffer->m_claimed.store(false, std::memory_order_release);
+            s_num_released_buffers.fetch_add(1, std::memory_order_release);
+        }
+    }
+    ThreadBufferClaim(const ThreadBufferClaim&) = delete;
+    ThreadBufferClaim& operator=(const ThreadBufferClaim&) = delete;
+
+    // A thread that found no free buffer only scans them again once another thread released one
+    ThreadBuffer* get_buffer() {
+        if (m_buffer == nullptr &&
+            m_num_released_buffers != s_num_released_buffers.load(std::memory_order_acquire)) {
+            claim();
+        }
+        return m_buffer;
+    }
+
+    ThreadBuffer* m_buffer = nullptr;
+    uint32_t m_thread_id = 0;
+    uint64_t m_num_released_buffers = 0;
+
+private:
+    void claim() {
+        // Read before scanning, so a buffer released during the scan triggers another one
+        m_num_released_buffers = s_num_released_buffers.load(std::memory_order_acquire);
+        for (size_t i = 0; i < Tracer::k_max_threads; ++i) {
+            if (!s_buffers[i].m_claimed.exchange(true, std::memory_order_acquire)) {
+                m_buffer = &s_buffers[i];
+                return;
+            }
+        }
+    }
+};
+
+void push(TraceEvent event) {
+    thread_local ThreadBufferClaim claim;
+    ThreadBuffer* buffer = claim.get_buffer();
+    if (buffer == nullptr) {
+        s_dropped_events.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    size_t const write = buffer->m_write.load(std::memory_order_relaxed);
+    if (write - buffer->m_read.load(std::memory_order_acquire) >= Tracer::k_buffer_capacity) {
+        s_dropped_events.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    event.m_thread_id = claim.m_thread_id;
+    buffer->m_events[write % Tracer::k_buffer_capacity] = event;
+    buffer->m_write.store(write + 1, std::memory_order_release);
+}
+
+void write_event(const TraceEvent& event) {
+    s_file << (s_first_event ? "\n" : ",\n");
+    s_first_event = false;
+    bool const is_instant = event.m_end_ns == event.m_begin_ns;
+    s_file << R"({"name":")" << event.m_name << R"(","cat":"anira","ph":")"
+           << (is_instant ? "i" : "X") << R"(","ts":)"
+           << static_cast<double>(event.m_begin_ns) / 1000.;
+    if (is_instant) {
+        s_file << R"(,"s":"t")";
+    } else {
+        s_file << R"(,"dur":)" << static_cast<double>(event.m_end_ns - event.m_begin_ns) / 1000.;
+    }
+    s_file << R"(,"pid":1,"tid":)" << event.m_thread_id << R"(,"args":{"session":)"
+           << event.m_session_id << R"(,"seq":)" << event.m_sequence << "}}";
+}
+
+// Finishes the trace file if the host never called stop(), declared last so it is destroyed before
+// the state it uses
+struct TracerShutdown {
+    TracerShutdown() = default;
+    TracerShutdown(const TracerShutdown&) = delete;
+    TracerShutdown& operator=(const TracerShutdown&) = delete;
+    ~TracerShutdown() { Tracer::stop(); }
+} s_shutdown;
+
+}  // namespace
+
+bool Tracer::start(const std::string& file_path) {
+#ifndef ENABLE_TRACING
+    LOG_ERROR << "[ERROR] Tracing is not available, build anira with ANIRA_WITH_TRACING=ON!"
+              << '\n';
+    (void)file_path;
+    return false;
+#else
+    std::lock_guard<std::mutex> const lock(s_mutex);
+    if (s_running.load(std::memory_order_relaxed)) { return false; }
+
+    s_file.open(file_path, std::ios::out | std::ios::trunc);
+    if (!s_file.is_open()) {
+        LOG_ERROR << "[ERROR] Could not open trace file " << file_path << '\n';
+        return false;
+    }
+    s_file << R"({"displayTimeUnit":"ms","traceEvents":[)";
+    s_first_event = true;
+
+    if (s_buffers == nullptr) { s_buffers = new ThreadBuffer[k_max_threads]; }
+    // Discard events that were pushed after the previous stop
+    for (size_t i = 0; i < k_max_threads; ++i) {
+        s_buffers[i].m_read.store(s_buffers[i].m_write.load(std::memory_order_acquire),
+                                  std::memory_order_release);
+    }
+
+    s_dropped_events.store(0, std::memory_order_relaxed);
+    s_start_time_ns.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now().time_since_epoch())
+                              .count(),
+                          std::memory_order_relaxed);
+    s_running.store(true, std::memory_order_release);
+    s_flush_thread = std::thread(&Tracer::flush_loop);
+    return true;
+#endif
+}
+
+void Tracer::stop() {
+    std::lock_guard<std::mutex> const lock(s_mutex);
+    if (!s_running.exchange(false, std::memory_order_acq_rel)) { return; }
+    if (s_flush_thread.joinable()) { s_flush_thread.join(); }
+    flush();
+    s_file << "\n]}\n";
+    s_file.close();
+    if (s_dropped_events.load(std::memory_order_relaxed) > 0) {
+        LOG_INFO << "[WARNING] Tracer dropped " << s_dropped_events.load(std::memory_order_relaxed)
+                 << " events!" << '\n';
+    }
+}
+
+bool Tracer::is_running() {
+    return s_running.load(std::memory_order_acquire);
+}
+
+uint64_t Tracer::now() {
+    int64_t const now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               std::chrono::steady_clock::now().time_since_epoch())
+                               .count();
+    return static_cast<uint64_t>(now_ns - s_start_time_ns.load(std::memory_order_relaxed));
+}
+
+void Tracer::record(const char* name, uint64_t begin_ns, int session_id, long sequence) {
+    if (!is_running()) { return; }
+    push(TraceEvent{.m_name = name,
+                    .m_begin_ns = begin_ns,
+                    .m_end_ns = now(),
+                    .m_session_id = session_id,
+                    .m_sequence = sequence});
+}
+
+void Tracer::record_instant(const char* name, int session_id, long sequence) {
+    if (!is_running()) { return; }
+    uint64_t const time = now();
+    push(TraceEvent{.m_name = name,
+                    .m_begin_ns = time,
+                    .m_end_ns = time,
+                    .m_session_id = session_id,
+                    .m_sequence = sequence});
+}
+
+uint64_t Tracer::get_dropped_events() {
+    return s_dropped_events.load(std::memory_order_relaxed);
+}
+
+void Tracer::flush() {
+    for (size_t i = 0; i < k_max_threads; ++i) {
+        ThreadBuffer& buffer = s_buffers[i];
+        size_t const write = buffer.m_write.load(std::memory_order_acquire);
+        size_t read = buffer.m_read.load(std::memory_order_relaxed);
+        for (; read < write; ++read) { write_event(buffer.m_events[read % k_buffer_capacity]); }
+        buffer.m_read.store(read, std::memory_order_release);
+    }
+    s_file.flush();
+}
+
+void Tracer::flush_loop() {
+    while (s_running.load(std::memory_order_acquire)) {
+        std::this_thread::sleep_for(k_flush_interval);
+        flush();
+    }
+}
+
+}  // namespace anira
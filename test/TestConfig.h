@@ -0,0 +1,48 @@
+#ifndef ANIRA_TEST_CONFIG_H
+#define ANIRA_TEST_CONFIG_H
+
+#include <anira/InferenceConfig.h>
+#include <anira/utils/InferenceBackend.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Configs of models that run on the CUSTOM backend without a model file. The default BackendBase
+// copies its inputs to its outputs, so these models are identities.
+
+inline std::vector<anira::ModelData> make_placeholder_model_data() {
+    return {anira::ModelData("placeholder", anira::InferenceBackend::CUSTOM)};
+}
+
+// One mono streamable tensor of num_samples samples in and out of every inference
+inline anira::InferenceConfig make_identity_config(
+    size_t num_samples,
+    anira::ProcessingSpec processing_spec,
+    float max_inference_time = 5.f,
+    unsigned int num_parallel_processors =
+        anira::InferenceConfig::Defaults::m_num_parallel_processors) {
+    auto const size = static_cast<int64_t>(num_samples);
+    std::vector<anira::TensorShape> const tensor_shape = {{{{1, 1, size}}, {{1, 1, size}}}};
+    return anira::InferenceConfig(make_placeholder_model_data(),
+                                  tensor_shape,
+                                  processing_spec,
+                                  max_inference_time,
+                                  anira::InferenceConfig::Defaults::k_warm_up,
+                                  anira::InferenceConfig::Defaults::k_session_exclusive_processor,
+                                  anira::InferenceConfig::Defaults::k_blocking_ratio,
+                                  num_parallel_processors);
+}
+
+inline anira::InferenceConfig make_identity_config(
+    size_t num_samples,
+    float max_inference_time = 5.f,
+    unsigned int num_parallel_processors =
+        anira::InferenceConfig::Defaults::m_num_parallel_processors) {
+    return make_identity_config(num_samples,
+                                anira::ProcessingSpec({1}, {1}, {num_samples}, {num_samples}),
+                                max_inference_time,
+                                num_parallel_processors);
+}
+
+#endif  // ANIRA_TEST_CONFIG_H
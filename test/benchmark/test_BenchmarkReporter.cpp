@@ -0,0 +1,100 @@
+#include <anira/benchmark/BenchmarkReporter.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace anira::benchmark;
+
+TEST(BenchmarkReporterTest, Summary) {
+    std::vector<double> samples;
+    for (size_t i = 1; i <= 100; ++i) { samples.push_back(static_cast<double>(i)); }
+    samples.push_back(1000.);
+
+    BenchmarkSummary const summary = BenchmarkReporter::summarize("bm", samples);
+    EXPECT_EQ(summary.m_num_samples, 101u);
+    EXPECT_DOUBLE_EQ(summary.m_min, 1.);
+    EXPECT_DOUBLE_EQ(summary.m_max, 1000.);
+    EXPECT_DOUBLE_EQ(summary.m_p50, 51.);
+    EXPECT_DOUBLE_EQ(summary.m_p90, 91.);
+    EXPECT_NEAR(summary.m_mean, (5050. + 1000.) / 101., 1e-9);
+    // Consecutive samples differ by 1, except for the jump to the outlier
+    EXPECT_NEAR(summary.m_jitter, (99. + 900.) / 100., 1e-9);
+    EXPECT_EQ(summary.m_num_outliers, 1u);
+}
+
+TEST(BenchmarkReporterTest, MannWhitney) {
+    std::vector<double> baseline;
+    std::vector<double> same;
+    std::vector<double> slower;
+    for (size_t i = 0; i < 50; ++i) {
+        baseline.push_back(1. + 0.01 * static_cast<double>(i % 10));
+        same.push_back(1. + 0.01 * static_cast<double>((i + 5) % 10));
+        slower.push_back(1.2 + 0.01 * static_cast<double>(i % 10));
+    }
+    EXPECT_GT(BenchmarkReporter::mann_whitney_p_value(same, baseline), 0.1);
+    EXPECT_LT(BenchmarkReporter::mann_whitney_p_value(slower, baseline), 1e-6);
+    // The test is one-sided, faster samples are no regression
+    EXPECT_GT(BenchmarkReporter::mann_whitney_p_value(baseline, slower), 0.99);
+}
+
+TEST(BenchmarkReporterTest, JsonRoundTripAndComparison) {
+    BenchmarkReporter baseline;
+    BenchmarkReporter current;
+    for (size_t i = 0; i < 50; ++i) {
+        double const noise = 0.01 * static_cast<double>(i % 10);
+        baseline.add_sample("unchanged", 1. + noise);
+        baseline.add_sample("regressed", 1. + noise);
+        baseline.add_sample("improved", 1. + noise);
+        current.add_sample("unchanged", 1. + 0.01 * static_cast<double>((i + 3) % 10));
+        current.add_sample("regressed", 1.5 + noise);
+        current.add_sample("improved", 0.5 + noise);
+        current.add_sample("new", 1.);
+    }
+
+    std::string const path =
+        (std::filesystem::temp_directory_path() / "anira_benchmark_baseline.json").string();
+    ASSERT_TRUE(baseline.write_json(path));
+    BenchmarkReporter loaded;
+    ASSERT_TRUE(loaded.read_json(path));
+    std::filesystem::remove(path);
+    EXPECT_EQ(loaded.get_samples(), baseline.get_samples());
+
+    std::vector<BenchmarkComparison> const comparisons = current.compare(loaded);
+    ASSERT_EQ(comparisons.size(), 3u);
+    // Comparisons are ordered by name and skip benchmarks without baseline
+    EXPECT_EQ(comparisons[0].m_name, "improved");
+    EXPECT_TRUE(comparisons[0].m_improvement);
+    EXPECT_FALSE(comparisons[0].m_regression);
+    EXPECT_EQ(comparisons[1].m_name, "regressed");
+    EXPECT_TRUE(comparisons[1].m_regression);
+    // Medians of 1.045 and 1.545
+    EXPECT_NEAR(comparisons[1].m_relative_change, 0.5 / 1.045, 1e-9);
+    EXPECT_EQ(comparisons[2].m_name, "unchanged");
+    EXPECT_FALSE(comparisons[2].m_regression);
+    EXPECT_FALSE(comparisons[2].m_improvement);
+
+    std::ostringstream stream;
+    BenchmarkReporter::print_comparison(stream, comparisons);
+    EXPECT_NE(stream.str().find("REGRESSION"), std::string::npos);
+}
+
+TEST(BenchmarkReporterTest, ReadInvalidJson) {
+    std::string const path =
+        (std::filesystem::temp_directory_path() / "anira_benchmark_invalid.json").string();
+    {
+        std::ofstream file(path);
+        file << "{\"benchmarks\": [{\"name\": 1}]}";
+    }
+    BenchmarkReporter reporter;
+    reporter.add_sample("kept", 1.);
+    EXPECT_FALSE(reporter.read_json(path));
+    std::filesystem::remove(path);
+    EXPECT_EQ(reporter.get_samples().size(), 1u);
+    EXPECT_FALSE(reporter.read_json(path));
+}
@@ -0,0 +1,105 @@
+#include <anira/ContextConfig.h>
+#include <anira/InferenceConfig.h>
+#include <anira/InferenceHandler.h>
+#include <anira/PrePostProcessor.h>
+#include <anira/backends/BackendBase.h>
+#include <anira/benchmark/RealtimeHarness.h>
+#include <anira/utils/Buffer.h>
+#include <anira/utils/HostConfig.h>
+#include <anira/utils/InferenceBackend.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../TestConfig.h"
+#include "gtest/gtest.h"
+
+using namespace anira;
+using namespace anira::benchmark;
+
+namespace {
+
+constexpr size_t k_buffer_size = 512;
+constexpr float k_sample_rate = 48000.f;
+constexpr std::chrono::milliseconds k_duration{300};
+
+// Copies the input and sleeps, so the inference takes a known share of the host period
+class SleepingBackend : public BackendBase {
+public:
+    SleepingBackend(InferenceConfig& inference_config, std::chrono::microseconds inference_time)
+        : BackendBase(inference_config), m_inference_time(inference_time) {}
+
+    void process(std::vector<BufferF>& input,
+                 std::vector<BufferF>& output,
+                 std::shared_ptr<SessionElement> session) override {
+        BackendBase::process(input, output, session);
+        std::this_thread::sleep_for(m_inference_time);
+    }
+
+private:
+    std::chrono::microseconds m_inference_time;
+};
+
+}  // namespace
+
+TEST(RealtimeHarnessTest, DefaultLatencyIsSafe) {
+    InferenceConfig config = make_identity_config(k_buffer_size, 8.f);
+    PrePostProcessor pp_processor(config);
+    SleepingBackend backend(config, std::chrono::microseconds(500));
+    InferenceHandler handler(pp_processor, config, backend, ContextConfig(1));
+    handler.set_inference_backend(InferenceBackend::CUSTOM);
+
+    RealtimeHarness harness(handler, config);
+    HostConfig const host_config(k_buffer_size, k_sample_rate);
+    handler.prepare(host_config);
+    RealtimeRunResult const result = harness.measure(host_config, handler.get_latency(), k_duration);
+
+    // 300 ms at 512 samples and 48 kHz are 28.125 periods
+    EXPECT_EQ(result.m_num_callbacks, 29u);
+    EXPECT_EQ(result.m_callback_time.m_count, 29u);
+    EXPECT_EQ(result.m_underruns, 0u);
+    EXPECT_TRUE(result.is_safe());
+}
+
+TEST(RealtimeHarnessTest, ZeroLatencyUnderruns) {
+    InferenceConfig config = make_identity_config(k_buffer_size, 8.f);
+    PrePostProcessor pp_processor(config);
+    SleepingBackend backend(config, std::chrono::milliseconds(2));
+    InferenceHandler handler(pp_processor, config, backend, ContextConfig(1));
+    handler.set_inference_backend(InferenceBackend::CUSTOM);
+
+    RealtimeHarness harness(handler, config);
+    RealtimeRunResult const result =
+        harness.measure(HostConfig(k_buffer_size, k_sample_rate), 0, k_duration);
+
+    // Without latency the inference can never be done when process() returns
+    EXPECT_GT(result.m_underruns, 0u);
+    EXPECT_EQ(result.m_missing_samples, result.m_underruns * k_buffer_size);
+    EXPECT_FALSE(result.is_safe());
+}
+
+TEST(RealtimeHarnessTest, FindsMinSafeLatency) {
+    InferenceConfig config = make_identity_config(k_buffer_size, 8.f);
+    PrePostProcessor pp_processor(config);
+    SleepingBackend backend(config, std::chrono::milliseconds(2));
+    InferenceHandler handler(pp_processor, config, backend, ContextConfig(1));
+    handler.set_inference_backend(InferenceBackend::CUSTOM);
+
+    RealtimeHarness harness(handler, config);
+    std::vector<LatencySearchResult> const results =
+        harness.sweep(k_sample_rate, {static_cast<float>(k_buffer_size)}, k_duration, 128);
+
+    ASSERT_EQ(results.size(), 1u);
+    LatencySearchResult const& result = results[0];
+    ASSERT_TRUE(result.m_found);
+    ASSERT_FALSE(result.m_runs.empty());
+    EXPECT_EQ(result.m_runs.front().m_latency, result.m_default_latency);
+    EXPECT_GT(result.m_min_safe_latency, 0u);
+    EXPECT_LE(result.m_min_safe_latency, result.m_default_latency);
+    EXPECT_FLOAT_EQ(RealtimeHarness::get_min_safe_buffer_size(results),
+                    static_cast<float>(k_buffer_size));
+}
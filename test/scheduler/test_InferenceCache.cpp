@@ -0,0 +1,153 @@
+#include <anira/ContextConfig.h>
+#include <anira/InferenceConfig.h>
+#include <anira/InferenceHandler.h>
+#include <anira/PrePostProcessor.h>
+#include <anira/backends/BackendBase.h>
+#include <anira/scheduler/InferenceCache.h>
+#include <anira/scheduler/SessionElement.h>
+#include <anira/utils/Buffer.h>
+#include <anira/utils/HostConfig.h>
+#include <anira/utils/InferenceBackend.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "../TestConfig.h"
+#include "gtest/gtest.h"
+
+using namespace anira;
+
+namespace {
+
+constexpr size_t k_hop_size = 64;
+constexpr size_t k_num_parameters = 4;
+
+// Scales the audio by the first parameter and counts the inferences
+class GainBackend : public BackendBase {
+public:
+    GainBackend(InferenceConfig& config) : BackendBase(config) {}
+
+    void process(std::vector<BufferF>& input,
+                 std::vector<BufferF>& output,
+                 [[maybe_unused]] std::shared_ptr<SessionElement> session) override {
+        float const gain = input[1].get_sample(0, 0);
+        for (size_t i = 0; i < output[0].get_num_samples(); ++i) {
+            output[0].set_sample(0, i, input[0].get_sample(0, i) * gain);
+        }
+        m_num_inferences.fetch_add(1);
+    }
+
+    std::atomic<size_t> m_num_inferences{0};
+};
+
+void fill(std::vector<BufferF>& tensors, float value) {
+    for (auto& tensor : tensors) {
+        for (size_t i = 0; i < tensor.get_num_samples(); ++i) { tensor.set_sample(0, i, value); }
+    }
+}
+
+}  // namespace
+
+TEST(InferenceCacheTest, ReusesOutputsOfEqualInputs) {
+    InferenceCache cache;
+    std::vector<BufferF> input = {BufferF(1, 8)};
+    std::vector<BufferF> output = {BufferF(1, 2)};
+    InferenceCache::Ticket ticket;
+
+    // Disabled caches never hit
+    EXPECT_FALSE(cache.is_enabled());
+    EXPECT_FALSE(cache.lookup(input, output, InferenceBackend::CUSTOM, ticket));
+    EXPECT_EQ(ticket.m_entry, InferenceCache::k_no_entry);
+
+    cache.prepare(2, {8}, {2});
+    ASSERT_TRUE(cache.is_enabled());
+    fill(input, 1.f);
+    ASSERT_FALSE(cache.lookup(input, output, InferenceBackend::CUSTOM, ticket));
+    ASSERT_NE(ticket.m_entry, InferenceCache::k_no_entry);
+
+    // An entry waiting for its outputs does not match
+    InferenceCache::Ticket pending;
+    EXPECT_FALSE(cache.lookup(input, output, InferenceBackend::CUSTOM, pending));
+
+    fill(output, 3.f);
+    cache.store(ticket, output);
+    fill(output, 0.f);
+    InferenceCache::Ticket hit;
+    ASSERT_TRUE(cache.lookup(input, output, InferenceBackend::CUSTOM, hit));
+    EXPECT_EQ(output[0].get_sample(0, 1), 3.f);
+    EXPECT_EQ(hit.m_entry, InferenceCache::k_no_entry);
+
+    // Other inputs miss and replace the least recently used entries
+    input[0].set_sample(0, 7, 2.f);
+    EXPECT_FALSE(cache.lookup(input, output, InferenceBackend::CUSTOM, pending));
+    input[0].set_sample(0, 7, 3.f);
+    EXPECT_FALSE(cache.lookup(input, output, InferenceBackend::CUSTOM, pending));
+
+    // Outputs of replaced reservations are dropped
+    input[0].set_sample(0, 7, 1.f);
+    cache.store(ticket, output);
+    EXPECT_FALSE(cache.lookup(input, output, InferenceBackend::CUSTOM, pending));
+}
+
+TEST(InferenceCacheTest, HashDependsOnEveryValue) {
+    std::vector<BufferF> a = {BufferF(1, 16), BufferF(1, 3)};
+    std::vector<BufferF> b = {BufferF(1, 16), BufferF(1, 3)};
+    fill(a, 0.5f);
+    fill(b, 0.5f);
+    EXPECT_EQ(InferenceCache::calculate_hash(a), InferenceCache::calculate_hash(b));
+    b[1].set_sample(0, 2, 0.25f);
+    EXPECT_NE(InferenceCache::calculate_hash(a), InferenceCache::calculate_hash(b));
+}
+
+// A constant signal and constant parameters feed every inference the same inputs, so only the
+// inferences submitted before the first result came back run the model
+TEST(InferenceCacheTest, SkipsInferencesOfUnchangedInputs) {
+    std::vector<ModelData> const model_data = make_placeholder_model_data();
+    std::vector<TensorShape> const tensor_shape = {
+        {{{1, 1, static_cast<int64_t>(k_hop_size)}, {1, static_cast<int64_t>(k_num_parameters)}},
+         {{1, 1, static_cast<int64_t>(k_hop_size)}}}};
+    ProcessingSpec const processing_spec({1, 1}, {1}, {k_hop_size, 0}, {k_hop_size});
+    InferenceConfig config(model_data, tensor_shape, processing_spec, 5.f);
+
+    PrePostProcessor pp_processor(config);
+    GainBackend backend(config);
+    InferenceHandler handler(pp_processor, config, backend, ContextConfig(2));
+    handler.set_inference_backend(InferenceBackend::CUSTOM);
+    handler.set_memoization_cache_size(4);
+    handler.prepare(HostConfig(512, 48000));
+
+    std::vector<float> const parameters = {0.5f, 0.f, 0.f, 0.f};
+    pp_processor.set_input_tensor(parameters.data(), 1, parameters.size());
+
+    constexpr size_t k_num_samples = 64 * k_hop_size;
+    BufferF input(1, k_num_samples);
+    BufferF output(1, k_num_samples);
+    for (size_t i = 0; i < k_num_samples; ++i) { input.set_sample(0, i, 1.f); }
+
+    size_t const rendered = handler.render(input.get_array_of_read_pointers(),
+                                           k_num_samples,
+                                           output.get_array_of_write_pointers(),
+                                           k_num_samples);
+    ASSERT_EQ(rendered, k_num_samples);
+    for (size_t i = 0; i < k_num_samples; ++i) {
+        ASSERT_FLOAT_EQ(output.get_sample(0, i), 0.5f) << "sample " << i;
+    }
+
+    uint64_t const memoized = handler.get_statistics().m_memoized_inferences;
+    EXPECT_GT(memoized, 0u);
+    EXPECT_LT(backend.m_num_inferences.load(), k_num_samples / k_hop_size);
+
+    // A moved control runs the model again
+    std::vector<float> const moved = {2.f, 0.f, 0.f, 0.f};
+    pp_processor.set_input_tensor(moved.data(), 1, moved.size());
+    size_t const num_inferences = backend.m_num_inferences.load();
+    handler.render(input.get_array_of_read_pointers(),
+                   k_hop_size,
+                   output.get_array_of_write_pointers(),
+                   k_hop_size);
+    EXPECT_GT(backend.m_num_inferences.load(), num_inferences);
+    EXPECT_FLOAT_EQ(output.get_sample(0, 0), 2.f);
+}
@@ -0,0 +1,92 @@
+#include <anira/ContextConfig.h>
+#include <anira/InferenceConfig.h>
+#include <anira/InferenceHandler.h>
+#include <anira/PrePostProcessor.h>
+#include <anira/backends/BackendBase.h>
+#include <anira/scheduler/Context.h>
+#include <anira/scheduler/MemoryFootprint.h>
+#include <anira/utils/HostConfig.h>
+#include <anira/utils/InferenceBackend.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../TestConfig.h"
+#include "gtest/gtest.h"
+
+using namespace anira;
+
+namespace {
+
+constexpr size_t k_buffer_size = 256;
+
+// Custom backend that reports a fixed amount of memory
+class FootprintBackend : public BackendBase {
+public:
+    using BackendBase::BackendBase;
+
+    BackendMemoryFootprint get_memory_footprint() const override {
+        return BackendMemoryFootprint{
+            .m_num_instances = 1,
+            .m_tensor_bytes = 100,
+            .m_model_bytes = 1000,
+        };
+    }
+};
+
+}  // namespace
+
+TEST(MemoryFootprintTest, SessionBuffers) {
+    InferenceConfig config = make_identity_config(k_buffer_size);
+    PrePostProcessor pp_processor(config);
+    InferenceHandler handler(pp_processor, config, ContextConfig(1));
+    handler.prepare(HostConfig(k_buffer_size, 48000));
+
+    MemoryFootprint const footprint = handler.get_memory_footprint();
+    EXPECT_EQ(footprint.m_session_id, handler.get_statistics().m_session_id);
+    EXPECT_GE(footprint.m_send_buffer_bytes, k_buffer_size * sizeof(float));
+    EXPECT_GE(footprint.m_receive_buffer_bytes, k_buffer_size * sizeof(float));
+    EXPECT_GT(footprint.m_num_structs, 0u);
+    // Every struct holds one mono input and output tensor of the buffer size
+    EXPECT_EQ(footprint.m_struct_tensor_bytes,
+              footprint.m_num_structs * 2 * k_buffer_size * sizeof(float));
+    // The default processor holds no memory
+    EXPECT_TRUE(footprint.m_backends.empty());
+    EXPECT_EQ(footprint.get_total_bytes(),
+              footprint.m_send_buffer_bytes + footprint.m_receive_buffer_bytes +
+                  footprint.m_struct_tensor_bytes);
+
+    // A larger host buffer needs larger ring buffers
+    handler.prepare(HostConfig(4 * k_buffer_size, 48000));
+    EXPECT_GT(handler.get_memory_footprint().m_send_buffer_bytes, footprint.m_send_buffer_bytes);
+}
+
+TEST(MemoryFootprintTest, SharedCustomProcessorIsCountedOnce) {
+    InferenceConfig config = make_identity_config(k_buffer_size);
+    PrePostProcessor first_pp_processor(config);
+    PrePostProcessor second_pp_processor(config);
+    FootprintBackend backend(config);
+
+    InferenceHandler first(first_pp_processor, config, backend, ContextConfig(1));
+    InferenceHandler second(second_pp_processor, config, backend, ContextConfig(1));
+    first.prepare(HostConfig(k_buffer_size, 48000));
+    second.prepare(HostConfig(k_buffer_size, 48000));
+
+    MemoryFootprint const session = first.get_memory_footprint();
+    ASSERT_EQ(session.m_backends.size(), 1u);
+    EXPECT_EQ(session.m_backends[0].m_backend, InferenceBackend::CUSTOM);
+    EXPECT_EQ(session.m_backends[0].get_total_bytes(), 1100u);
+    EXPECT_EQ(session.m_backends[0].m_num_sessions, 2u);
+
+    ContextMemoryFootprint const context = Context::get_memory_footprint();
+    ASSERT_EQ(context.m_sessions.size(), 2u);
+    ASSERT_EQ(context.m_processors.size(), 1u);
+    EXPECT_EQ(context.m_processors[0].m_num_sessions, 2u);
+
+    size_t session_bytes = 0;
+    for (const auto& footprint : context.m_sessions) {
+        session_bytes += footprint.get_total_bytes() - 1100;
+    }
+    EXPECT_EQ(context.get_total_bytes(), session_bytes + 1100);
+}
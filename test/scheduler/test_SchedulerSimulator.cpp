@@ -0,0 +1,93 @@
+#include <anira/ContextConfig.h>
+#include <anira/InferenceConfig.h>
+#include <anira/PrePostProcessor.h>
+#include <anira/scheduler/SchedulerSimulator.h>
+#include <anira/scheduler/SessionElement.h>
+#include <anira/utils/HostConfig.h>
+#include <anira/utils/InferenceBackend.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../TestConfig.h"
+#include "gtest/gtest.h"
+
+using namespace anira;
+
+namespace {
+
+constexpr size_t k_buffer_size = 256;
+constexpr float k_sample_rate = 48000.f;
+
+}  // namespace
+
+// A session whose inferences are well within the budget must run without misses, with the
+// latency and number of structs a real session would use.
+TEST(SchedulerSimulatorTest, LightLoadHasNoMisses) {
+    InferenceConfig config = make_identity_config(k_buffer_size, 5.f, 1);
+    HostConfig const host_config(k_buffer_size, k_sample_rate);
+
+    PrePostProcessor pp_processor(config);
+    SessionElement session_element(0, pp_processor, config);
+    session_element.prepare(host_config);
+
+    SchedulerSimulator simulator(ContextConfig(1));
+    simulator.add_session(config, host_config, InferenceTimeDistribution::normal(1., 0.2));
+    SimulationResult const result = simulator.run(std::chrono::seconds(2));
+
+    ASSERT_EQ(result.m_sessions.size(), 1u);
+    const SimulatedSessionResult& session = result.m_sessions[0];
+    EXPECT_EQ(session.m_latency, session_element.m_latency[0]);
+    EXPECT_EQ(session.m_num_structs, session_element.m_num_structs);
+    EXPECT_EQ(session.m_num_callbacks, 375u);
+    EXPECT_GE(session.m_num_inferences, 374u);
+    EXPECT_EQ(session.m_underruns, 0u);
+    EXPECT_EQ(session.m_deadline_misses, 0u);
+    EXPECT_EQ(session.m_dropped_inferences, 0u);
+    EXPECT_GT(result.m_thread_utilization, 0.1);
+    EXPECT_LT(result.m_thread_utilization, 0.3);
+}
+
+// Inferences slower than the host period cannot keep up, regardless of the latency.
+TEST(SchedulerSimulatorTest, OverloadCausesUnderruns) {
+    SchedulerSimulator simulator(ContextConfig(1));
+    simulator.add_session(make_identity_config(k_buffer_size, 5.f, 1),
+                          HostConfig(k_buffer_size, k_sample_rate),
+                          InferenceTimeDistribution::constant(8.));
+    SimulationResult const result = simulator.run(std::chrono::seconds(2));
+
+    EXPECT_GT(result.get_underrun_rate(), 0.1);
+    EXPECT_GT(result.get_deadline_miss_rate(), 0.5);
+    EXPECT_GT(result.m_sessions[0].m_missing_samples, 0u);
+    EXPECT_GT(result.m_thread_utilization, 0.9);
+}
+
+// More threads and processor instances must fit more sessions, and runs with equal seeds must
+// give equal results.
+TEST(SchedulerSimulatorTest, FindsMaxSessions) {
+    HostConfig const host_config(k_buffer_size, k_sample_rate);
+    auto const inference_time = InferenceTimeDistribution::log_normal(1., 0.2);
+
+    SchedulerSimulator single_thread(ContextConfig(1));
+    size_t const single_thread_sessions = single_thread.find_max_sessions(
+        make_identity_config(k_buffer_size, 5.f, 1), host_config, inference_time, std::chrono::seconds(1));
+    SchedulerSimulator four_threads(ContextConfig(4));
+    size_t const four_thread_sessions = four_threads.find_max_sessions(
+        make_identity_config(k_buffer_size, 5.f, 4), host_config, inference_time, std::chrono::seconds(1));
+
+    // One inference per period of 5.3 ms and thread fits at most five sessions of 1 ms
+    EXPECT_GE(single_thread_sessions, 1u);
+    EXPECT_LE(single_thread_sessions, 5u);
+    EXPECT_GT(four_thread_sessions, single_thread_sessions * 2);
+
+    SchedulerSimulator simulator(ContextConfig(2), 42);
+    for (size_t i = 0; i < 8; ++i) {
+        simulator.add_session(make_identity_config(k_buffer_size, 5.f, 2), host_config, inference_time);
+    }
+    SimulationResult const first = simulator.run(std::chrono::seconds(1));
+    SimulationResult const second = simulator.run(std::chrono::seconds(1));
+    EXPECT_EQ(first.get_underrun_rate(), second.get_underrun_rate());
+    EXPECT_EQ(first.m_sessions[7].m_completion.m_sum, second.m_sessions[7].m_completion.m_sum);
+}
@@ -1,6 +1,7 @@
 #include <anira/InferenceConfig.h>
 #include <anira/PrePostProcessor.h>
 #include <anira/scheduler/SessionElement.h>
+#include <anira/utils/Arena.h>
 #include <anira/utils/HostConfig.h>
 #include <anira/utils/InferenceBackend.h>
 
@@ -8,6 +9,7 @@
 #include <cstddef>
 #include <iomanip>
 #include <ios>
+#include <memory>
 #include <ostream>
 #include <sstream>
 #include <string>
@@ -95,6 +97,54 @@ TEST_P(SessionElementTest, LatencyStructAndRingbuffers) {
     }
 }
 
+TEST_P(SessionElementTest, ArenaHoldsAllBuffers) {
+    auto test_params = GetParam();
+
+    PrePostProcessor pp_processor(test_params.m_inference_config);
+
+    SessionElement session_element(0,  // session_id
+                                   pp_processor,
+                                   test_params.m_inference_config);
+    session_element.m_use_arena = true;
+
+    // Preparing again replaces the slab, the second one must be sized the same
+    for (int i = 0; i < 2; ++i) {
+        session_element.prepare(test_params.m_host_config);
+        ASSERT_NE(session_element.m_arena, nullptr);
+        const Arena& arena = session_element.m_arena->m_arena;
+        EXPECT_EQ(arena.get_used(), arena.get_capacity());
+        ASSERT_EQ(session_element.m_num_structs, test_params.m_expected_num_structs);
+        ASSERT_EQ(session_element.m_inference_queue.size(), test_params.m_expected_num_structs);
+
+        for (auto& buffer : session_element.m_send_buffer) {
+            if (buffer.get_num_samples() > 0) { EXPECT_TRUE(arena.contains(buffer.data())); }
+        }
+        for (auto& buffer : session_element.m_receive_buffer) {
+            if (buffer.get_num_samples() > 0) { EXPECT_TRUE(arena.contains(buffer.data())); }
+        }
+        for (auto& thread_safe_struct : session_element.m_inference_queue) {
+            EXPECT_TRUE(arena.contains(thread_safe_struct.get()));
+            for (auto& tensor : thread_safe_struct->m_tensor_input_data) {
+                EXPECT_TRUE(arena.contains(tensor.data()));
+            }
+            for (auto& tensor : thread_safe_struct->m_tensor_output_data) {
+                EXPECT_TRUE(arena.contains(tensor.data()));
+            }
+        }
+    }
+
+    // The structures keep the slab alive after the session released it
+    std::shared_ptr<SessionElement::ThreadSafeStruct> const held_struct =
+        session_element.m_inference_queue.front();
+    session_element.m_use_arena = false;
+    session_element.prepare(test_params.m_host_config);
+    EXPECT_EQ(session_element.m_arena, nullptr);
+    for (auto& buffer : session_element.m_receive_buffer) {
+        EXPECT_TRUE(buffer.get_memory_block().is_owned());
+    }
+    for (auto& tensor : held_struct->m_tensor_output_data) { tensor.clear(); }
+}
+
 namespace {
 std::string build_test_name(const testing::TestParamInfo<SessionElementTest::ParamType>& info) {
     std::stringstream ss_sample_rate, ss_buffer_size, ss_max_inference_time, ss_tensor_index;
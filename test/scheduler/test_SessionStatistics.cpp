@@ -0,0 +1,80 @@
+#include <anira/ContextConfig.h>
+#include <anira/InferenceConfig.h>
+#include <anira/InferenceHandler.h>
+#include <anira/PrePostProcessor.h>
+#include <anira/backends/BackendBase.h>
+#include <anira/scheduler/SessionStatistics.h>
+#include <anira/utils/Buffer.h>
+#include <anira/utils/HostConfig.h>
+#include <anira/utils/InferenceBackend.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "../TestConfig.h"
+#include "gtest/gtest.h"
+
+using namespace anira;
+
+TEST(SessionStatisticsTest, DeadlineMissesAndBackendSlots) {
+    SessionStatistics statistics;
+    statistics.record_inference(InferenceBackend::CUSTOM, 100, 400, 1000);
+    statistics.record_inference(InferenceBackend::CUSTOM, 800, 400, 1000);
+    statistics.record_missing_samples(64);
+
+    InferenceStatistics const snapshot = statistics.snapshot(7, 1000);
+    EXPECT_EQ(snapshot.m_session_id, 7);
+    EXPECT_EQ(snapshot.m_deadline_misses, 1u);
+    ASSERT_EQ(snapshot.m_backends.size(), 1u);
+    EXPECT_EQ(snapshot.m_backends[0].m_backend, InferenceBackend::CUSTOM);
+    EXPECT_EQ(snapshot.m_backends[0].m_inference.m_count, 2u);
+    EXPECT_EQ(snapshot.m_backends[0].m_queue_wait.m_max, 800u);
+    EXPECT_EQ(snapshot.m_completion.m_min, 50u);
+    EXPECT_EQ(snapshot.m_completion.m_max, 120u);
+    EXPECT_EQ(snapshot.m_missing_samples.m_sum, 64u);
+
+    statistics.reset();
+    InferenceStatistics const cleared = statistics.snapshot(7, 1000);
+    EXPECT_TRUE(cleared.m_backends.empty());
+    EXPECT_EQ(cleared.m_deadline_misses, 0u);
+}
+
+// Processing a few blocks through a handler must populate every timing histogram of its session.
+TEST(SessionStatisticsTest, HandlerRecordsTimings) {
+    constexpr size_t k_buffer_size = 256;
+    constexpr size_t k_num_blocks = 64;
+
+    InferenceConfig config = make_identity_config(k_buffer_size);
+
+    PrePostProcessor pp_processor(config);
+    BackendBase backend(config);
+    ContextConfig context_config;
+    context_config.m_num_threads = 2;
+
+    InferenceHandler handler(pp_processor, config, backend, context_config);
+    handler.prepare(HostConfig(k_buffer_size, 48000));
+    handler.set_inference_backend(InferenceBackend::CUSTOM);
+
+    BufferF buffer(1, k_buffer_size);
+    for (size_t block = 0; block < k_num_blocks; ++block) {
+        handler.process(buffer.get_array_of_write_pointers(), k_buffer_size);
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+    // Let in-flight inferences finish recording
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    InferenceStatistics const statistics = handler.get_statistics();
+    EXPECT_GT(statistics.m_deadline_ns, 0u);
+    EXPECT_EQ(statistics.m_pre_process.m_count, k_num_blocks);
+    EXPECT_GT(statistics.m_post_process.m_count, 0u);
+    ASSERT_EQ(statistics.m_backends.size(), 1u);
+    EXPECT_EQ(statistics.m_backends[0].m_backend, InferenceBackend::CUSTOM);
+    EXPECT_GE(statistics.m_backends[0].m_inference.m_count, statistics.m_post_process.m_count);
+    EXPECT_EQ(statistics.m_completion.m_count, statistics.m_backends[0].m_inference.m_count);
+
+    handler.reset_statistics();
+    EXPECT_EQ(handler.get_statistics().m_pre_process.m_count, 0u);
+}
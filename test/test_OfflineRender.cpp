@@ -0,0 +1,125 @@
+#include <anira/ContextConfig.h>
+#include <anira/InferenceConfig.h>
+#include <anira/InferenceHandler.h>
+#include <anira/PrePostProcessor.h>
+#include <anira/backends/BackendBase.h>
+#include <anira/utils/Buffer.h>
+#include <anira/utils/HostConfig.h>
+#include <anira/utils/InferenceBackend.h>
+#include <anira/utils/RingBuffer.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "TestConfig.h"
+#include "gtest/gtest.h"
+
+using namespace anira;
+
+struct OfflineRenderTestParams {
+    size_t m_hop_size;
+    size_t m_num_samples;
+    unsigned int m_num_parallel_processors;
+};
+
+class OfflineRenderTest : public ::testing::TestWithParam<OfflineRenderTestParams> {};
+
+// The default BackendBase copies input to output, so a rendered span must reproduce the input
+// sample by sample, without the latency padding that process() would add.
+TEST_P(OfflineRenderTest, OutputIsAlignedWithInput) {
+    auto const& params = GetParam();
+
+    InferenceConfig config =
+        make_identity_config(params.m_hop_size, 5.f, params.m_num_parallel_processors);
+
+    PrePostProcessor pp_processor(config);
+    BackendBase backend(config);
+
+    ContextConfig context_config;
+    context_config.m_num_threads = 4;
+
+    InferenceHandler handler(pp_processor, config, backend, context_config);
+    handler.prepare(HostConfig(512, 48000));
+    handler.set_inference_backend(InferenceBackend::CUSTOM);
+
+    BufferF input(1, params.m_num_samples);
+    BufferF output(1, params.m_num_samples);
+    for (size_t i = 0; i < params.m_num_samples; ++i) {
+        input.set_sample(0, i, static_cast<float>(i + 1));
+    }
+
+    size_t const rendered = handler.render(input.get_array_of_read_pointers(),
+                                           params.m_num_samples,
+                                           output.get_array_of_write_pointers(),
+                                           params.m_num_samples);
+
+    ASSERT_EQ(rendered, params.m_num_samples);
+    for (size_t i = 0; i < params.m_num_samples; ++i) {
+        ASSERT_FLOAT_EQ(output.get_sample(0, i), input.get_sample(0, i)) << "sample " << i;
+    }
+
+    // The real-time configuration is restored after rendering
+    EXPECT_EQ(handler.get_available_samples(0), handler.get_latency());
+}
+
+INSTANTIATE_TEST_SUITE_P(OfflineRender,
+                         OfflineRenderTest,
+                         ::testing::Values(OfflineRenderTestParams{128, 48000, 1},
+                                           OfflineRenderTestParams{128, 48000, 4},
+                                           OfflineRenderTestParams{480, 10007, 4},
+                                           OfflineRenderTestParams{2048, 1000, 2}));
+
+// Prepends the previous internal_latency samples to every window, so the identity backend outputs
+// the input delayed by the internal model latency
+class DelayPrePostProcessor : public PrePostProcessor {
+public:
+    using PrePostProcessor::PrePostProcessor;
+
+    void pre_process(std::vector<RingBuffer>& input,
+                     std::vector<BufferF>& output,
+                     [[maybe_unused]] InferenceBackend current_inference_backend) override {
+        pop_samples_from_buffer(input[0],
+                                output[0],
+                                m_inference_config.get_preprocess_input_size()[0],
+                                m_inference_config.get_internal_model_latency()[0]);
+    }
+};
+
+// render() must skip the internal model latency, so the delayed output still lines up with the
+// input
+TEST(OfflineRenderTest, OutputIsAlignedWithInputDespiteInternalLatency) {
+    constexpr size_t k_hop_size = 256;
+    constexpr size_t k_internal_latency = 100;
+    constexpr size_t k_num_samples = 10000;
+
+    auto const window_size = static_cast<int64_t>(k_hop_size + k_internal_latency);
+    InferenceConfig config(
+        make_placeholder_model_data(),
+        {{{{1, 1, window_size}}, {{1, 1, window_size}}}},
+        ProcessingSpec({1}, {1}, {k_hop_size}, {k_hop_size}, {k_internal_latency}),
+        5.f);
+
+    DelayPrePostProcessor pp_processor(config);
+    BackendBase backend(config);
+
+    InferenceHandler handler(pp_processor, config, backend, ContextConfig(2));
+    handler.prepare(HostConfig(512, 48000));
+    handler.set_inference_backend(InferenceBackend::CUSTOM);
+
+    BufferF input(1, k_num_samples);
+    BufferF output(1, k_num_samples);
+    for (size_t i = 0; i < k_num_samples; ++i) {
+        input.set_sample(0, i, static_cast<float>(i + 1));
+    }
+
+    size_t const rendered = handler.render(input.get_array_of_read_pointers(),
+                                           k_num_samples,
+                                           output.get_array_of_write_pointers(),
+                                           k_num_samples);
+
+    ASSERT_EQ(rendered, k_num_samples);
+    for (size_t i = 0; i < k_num_samples; ++i) {
+        ASSERT_FLOAT_EQ(output.get_sample(0, i), input.get_sample(0, i)) << "sample " << i;
+    }
+}
@@ -1,7 +1,10 @@
+#include <anira/utils/AlignedAllocator.h>
+#include <anira/utils/Arena.h>
 #include <anira/utils/Buffer.h>
 #include <anira/utils/MemoryBlock.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
 
 #include "gtest/gtest.h"
@@ -134,3 +137,85 @@ TEST(Buffer, InvalidChannelsSwap) {
         output,
         std::string("Cannot swap data, buffers have different number of channels or sizes!\n"));
 }
+
+TEST(Buffer, AlignedMemory) {
+    auto const is_aligned = [](const void* data, size_t alignment) {
+        return reinterpret_cast<uintptr_t>(data) % alignment == 0;
+    };
+
+    for (size_t const size : {1, 3, 64, 1000}) {
+        BufferF buffer(2, size);
+        EXPECT_TRUE(is_aligned(buffer.data(), k_cache_line_size));
+    }
+
+    MemoryBlock<float, 256> block(5);
+    EXPECT_TRUE(is_aligned(block.data(), 256));
+    for (size_t i = 0; i < block.size(); i++) { block[i] = static_cast<float>(i); }
+
+    // Resizing keeps the elements and the alignment
+    block.resize(1000);
+    EXPECT_TRUE(is_aligned(block.data(), 256));
+    for (size_t i = 0; i < 5; i++) { EXPECT_FLOAT_EQ(block[i], static_cast<float>(i)); }
+    block.resize(2);
+    EXPECT_FLOAT_EQ(block[1], 1.f);
+    block.resize(0);
+    EXPECT_EQ(block.data(), nullptr);
+    EXPECT_EQ(block.size(), 0u);
+}
+
+TEST(Buffer, HugePageMemory) {
+    AlignedAllocator::set_huge_pages_enabled(true);
+    MemoryBlock<float> large(AlignedAllocator::k_huge_page_size);
+    MemoryBlock<float> small(1024);
+    AlignedAllocator::set_huge_pages_enabled(false);
+
+    ASSERT_NE(large.data(), nullptr);
+    large.clear();
+    EXPECT_FLOAT_EQ(large[AlignedAllocator::k_huge_page_size - 1], 0.f);
+#if defined(__linux__)
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(large.data()) % AlignedAllocator::k_huge_page_size, 0u);
+#endif
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(small.data()) % k_cache_line_size, 0u);
+}
+
+TEST(Buffer, ArenaViews) {
+    int const block_size = 10;
+    Arena arena(2 * Arena::get_aligned_size(block_size * sizeof(float)));
+    BufferF view(1, block_size, arena.allocate<float>(block_size));
+    float* view_ptr = view.data();
+    EXPECT_TRUE(arena.contains(view_ptr));
+    EXPECT_FALSE(view.get_memory_block().is_owned());
+    EXPECT_EQ(arena.get_used(), Arena::get_aligned_size(block_size * sizeof(float)));
+
+    BufferF owned(1, block_size);
+    float* owned_ptr = owned.data();
+    for (int i = 0; i < block_size; i++) {
+        view.set_sample(0, i, static_cast<float>(i));
+        owned.set_sample(0, i, static_cast<float>(i + block_size));
+    }
+
+    // Swapping with a view exchanges the elements, each buffer keeps its memory
+    owned.swap_data(view.get_memory_block());
+    EXPECT_EQ(view.data(), view_ptr);
+    EXPECT_EQ(owned.data(), owned_ptr);
+    view.swap_data(owned);
+    view.swap_data(owned);
+    EXPECT_EQ(view.data(), view_ptr);
+    for (int i = 0; i < block_size; i++) {
+        EXPECT_FLOAT_EQ(view.get_sample(0, i), static_cast<float>(i + block_size));
+        EXPECT_FLOAT_EQ(owned.get_sample(0, i), static_cast<float>(i));
+    }
+
+    // Copies and resized views own their memory
+    BufferF copy(view);
+    EXPECT_TRUE(copy.get_memory_block().is_owned());
+    EXPECT_FLOAT_EQ(copy.get_sample(0, 1), static_cast<float>(1 + block_size));
+    view.resize(1, block_size);
+    EXPECT_TRUE(view.get_memory_block().is_owned());
+    EXPECT_FALSE(arena.contains(view.data()));
+
+    EXPECT_NE(arena.allocate<float>(block_size), nullptr);
+    EXPECT_EQ(arena.allocate<float>(1), nullptr);
+    arena.reset();
+    EXPECT_EQ(arena.get_used(), 0u);
+}
@@ -0,0 +1,115 @@
+#include <anira/utils/Histogram.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace anira;
+
+// Every value must land in a bucket whose upper bound is at least the value and whose
+// predecessor's upper bound is below it.
+TEST(HistogramTest, BucketBoundsContainValue) {
+    std::vector<uint64_t> values;
+    for (uint64_t i = 0; i < 4096; ++i) { values.push_back(i); }
+    for (uint64_t shift = 12; shift < 40; ++shift) {
+        values.push_back((uint64_t{1} << shift) - 1);
+        values.push_back(uint64_t{1} << shift);
+        values.push_back((uint64_t{1} << shift) + 12345);
+    }
+    for (uint64_t const value : values) {
+        size_t const index = Histogram::bucket_index(value);
+        ASSERT_LT(index, Histogram::k_num_buckets);
+        EXPECT_GE(Histogram::bucket_upper_bound(index), value) << "value " << value;
+        if (index > 0) {
+            EXPECT_LT(Histogram::bucket_upper_bound(index - 1), value) << "value " << value;
+        }
+    }
+}
+
+TEST(HistogramTest, LargeValuesAreClampedIntoLastBucket) {
+    EXPECT_EQ(Histogram::bucket_index(UINT64_MAX), Histogram::k_num_buckets - 1);
+}
+
+TEST(HistogramTest, SnapshotSummary) {
+    Histogram histogram;
+    for (uint64_t i = 1; i <= 100; ++i) { histogram.record(i); }
+
+    HistogramSnapshot const snapshot = histogram.snapshot();
+    EXPECT_EQ(snapshot.m_count, 100u);
+    EXPECT_EQ(snapshot.m_sum, 5050u);
+    EXPECT_EQ(snapshot.m_min, 1u);
+    EXPECT_EQ(snapshot.m_max, 100u);
+    EXPECT_DOUBLE_EQ(snapshot.get_mean(), 50.5);
+}
+
+// Percentiles are reported as bucket upper bounds, so they may overestimate by at most one
+// sub-bucket (25%) but never underestimate.
+TEST(HistogramTest, PercentilesAreUpperBounds) {
+    Histogram histogram;
+    for (uint64_t i = 1; i <= 1000; ++i) { histogram.record(i * 1000); }
+
+    HistogramSnapshot const snapshot = histogram.snapshot();
+    for (double const percentile : {1., 50., 90., 99., 99.9}) {
+        auto const exact = static_cast<double>(percentile * 10. * 1000.);
+        auto const reported = static_cast<double>(snapshot.get_percentile(percentile));
+        EXPECT_GE(reported, exact) << "p" << percentile;
+        EXPECT_LE(reported, exact * 1.25) << "p" << percentile;
+    }
+    EXPECT_EQ(snapshot.get_percentile(100.), 1000000u);
+}
+
+TEST(HistogramTest, EmptyAndReset) {
+    Histogram histogram;
+    HistogramSnapshot snapshot = histogram.snapshot();
+    EXPECT_EQ(snapshot.m_count, 0u);
+    EXPECT_EQ(snapshot.m_min, 0u);
+    EXPECT_EQ(snapshot.get_percentile(99.), 0u);
+    EXPECT_DOUBLE_EQ(snapshot.get_mean(), 0.);
+
+    histogram.record(42);
+    histogram.reset();
+    snapshot = histogram.snapshot();
+    EXPECT_EQ(snapshot.m_count, 0u);
+    EXPECT_EQ(snapshot.m_max, 0u);
+}
+
+TEST(HistogramTest, ConcurrentRecordsAreNotLost) {
+    constexpr size_t k_num_threads = 4;
+    constexpr uint64_t k_records_per_thread = 100000;
+
+    Histogram histogram;
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < k_num_threads; ++t) {
+        threads.emplace_back([&histogram, t] {
+            for (uint64_t i = 0; i < k_records_per_thread; ++i) { histogram.record(i + t); }
+        });
+    }
+    for (auto& thread : threads) { thread.join(); }
+
+    HistogramSnapshot const snapshot = histogram.snapshot();
+    EXPECT_EQ(snapshot.m_count, k_num_threads * k_records_per_thread);
+    EXPECT_EQ(snapshot.m_min, 0u);
+    EXPECT_EQ(snapshot.m_max, k_records_per_thread - 1 + k_num_threads - 1);
+}
+
+TEST(HistogramTest, MergeCombinesSnapshots) {
+    Histogram first;
+    Histogram second;
+    for (uint64_t i = 10; i <= 20; ++i) { first.record(i); }
+    for (uint64_t i = 100; i <= 110; ++i) { second.record(i); }
+
+    HistogramSnapshot merged;
+    merged.merge(first.snapshot());
+    merged.merge(second.snapshot());
+    merged.merge(Histogram().snapshot());
+
+    EXPECT_EQ(merged.m_count, 22u);
+    EXPECT_EQ(merged.m_min, 10u);
+    EXPECT_EQ(merged.m_max, 110u);
+    EXPECT_DOUBLE_EQ(merged.get_mean(), 60.);
+    EXPECT_LT(merged.get_percentile(50.), 100u);
+    EXPECT_GE(merged.get_percentile(100.), 100u);
+}
@@ -0,0 +1,151 @@
+#include <anira/ContextConfig.h>
+#include <anira/InferenceConfig.h>
+#include <anira/InferenceHandler.h>
+#include <anira/PrePostProcessor.h>
+#include <anira/backends/BackendBase.h>
+#include <anira/utils/Buffer.h>
+#include <anira/utils/HostConfig.h>
+#include <anira/utils/InferenceBackend.h>
+#include <anira/utils/InferenceTimeCalibration.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../TestConfig.h"
+#include "gtest/gtest.h"
+
+using namespace anira;
+
+namespace {
+
+constexpr size_t k_buffer_size = 128;
+
+// Copies the input and sleeps, so the inference takes a known time
+class SleepingBackend : public BackendBase {
+public:
+    SleepingBackend(InferenceConfig& inference_config, std::chrono::microseconds inference_time)
+        : BackendBase(inference_config), m_inference_time(inference_time) {}
+
+    void process(std::vector<BufferF>& input,
+                 std::vector<BufferF>& output,
+                 std::shared_ptr<SessionElement> session) override {
+        BackendBase::process(input, output, session);
+        std::this_thread::sleep_for(m_inference_time);
+        m_num_calls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::atomic<size_t> m_num_calls{0};
+
+private:
+    std::chrono::microseconds m_inference_time;
+};
+
+}  // namespace
+
+// The percentile plus margin of the measured times must be stored and reused until a
+// recalibration is requested.
+TEST(InferenceTimeCalibrationTest, MeasuresAndCachesTimes) {
+    std::filesystem::path const directory =
+        std::filesystem::temp_directory_path() / "anira_calibration_test";
+    std::filesystem::remove_all(directory);
+    InferenceTimeCalibration calibration{.m_enabled = true,
+                                         .m_percentile = 50.,
+                                         .m_margin = 0.5f,
+                                         .m_num_inferences = 8,
+                                         .m_cache_path = (directory / "times.json").string()};
+
+    InferenceConfig config = make_identity_config(k_buffer_size, 20.f);
+    SleepingBackend backend(config, std::chrono::milliseconds(2));
+    float const calibrated =
+        InferenceTimeCalibrator::calibrate(calibration, backend, InferenceBackend::CUSTOM);
+    EXPECT_EQ(backend.m_num_calls, 9u);
+    EXPECT_GE(calibrated, 3.f);
+    EXPECT_LT(calibrated, 6.f);
+
+    std::vector<double> samples_ms;
+    ASSERT_TRUE(InferenceTimeCalibrator::load(
+        calibration.m_cache_path,
+        InferenceTimeCalibrator::get_machine_id(),
+        InferenceTimeCalibrator::get_model_id(backend, InferenceBackend::CUSTOM),
+        samples_ms));
+    EXPECT_EQ(samples_ms.size(), 8u);
+
+    // A processor of the same type and model reuses the stored times without running inferences
+    SleepingBackend cached_backend(config, std::chrono::microseconds(0));
+    EXPECT_EQ(
+        InferenceTimeCalibrator::calibrate(calibration, cached_backend, InferenceBackend::CUSTOM),
+        calibrated);
+    EXPECT_EQ(cached_backend.m_num_calls, 0u);
+
+    calibration.m_recalibrate = true;
+    EXPECT_LT(
+        InferenceTimeCalibrator::calibrate(calibration, cached_backend, InferenceBackend::CUSTOM),
+        calibrated);
+    EXPECT_EQ(cached_backend.m_num_calls, 9u);
+
+    // Other models have their own entries
+    InferenceConfig other_config = make_identity_config(k_buffer_size, 20.f);
+    other_config.set_model_path("other", InferenceBackend::CUSTOM);
+    SleepingBackend other_backend(other_config, std::chrono::microseconds(0));
+    EXPECT_FALSE(InferenceTimeCalibrator::load(
+        calibration.m_cache_path,
+        InferenceTimeCalibrator::get_machine_id(),
+        InferenceTimeCalibrator::get_model_id(other_backend, InferenceBackend::CUSTOM),
+        samples_ms));
+
+    std::filesystem::remove_all(directory);
+}
+
+// A model file replaced at the same path must get another identifier, so it is measured again.
+TEST(InferenceTimeCalibrationTest, ModelIdChangesWithTheModelFile) {
+    std::filesystem::path const path =
+        std::filesystem::temp_directory_path() / "anira_calibration_model_test.onnx";
+    std::ofstream(path) << "model";
+
+    InferenceConfig config = make_identity_config(k_buffer_size, 20.f);
+    config.set_model_path(path.string(), InferenceBackend::CUSTOM);
+    SleepingBackend backend(config, std::chrono::microseconds(0));
+    std::string const model_id =
+        InferenceTimeCalibrator::get_model_id(backend, InferenceBackend::CUSTOM);
+    EXPECT_NE(model_id.find(path.string()), std::string::npos);
+    EXPECT_EQ(InferenceTimeCalibrator::get_model_id(backend, InferenceBackend::CUSTOM), model_id);
+
+    std::ofstream(path) << "retrained model";
+    EXPECT_NE(InferenceTimeCalibrator::get_model_id(backend, InferenceBackend::CUSTOM), model_id);
+
+    std::filesystem::remove(path);
+}
+
+// A calibrated prepare must base the latency on the measured instead of the configured time.
+TEST(InferenceTimeCalibrationTest, PrepareUsesCalibratedTime) {
+    InferenceConfig config = make_identity_config(k_buffer_size, 20.f);
+    PrePostProcessor pp_processor(config);
+    SleepingBackend backend(config, std::chrono::milliseconds(1));
+    InferenceHandler handler(pp_processor, config, backend, ContextConfig(1));
+    handler.set_inference_backend(InferenceBackend::CUSTOM);
+
+    HostConfig const host_config(k_buffer_size, 48000);
+    handler.prepare(host_config);
+    unsigned int const configured_latency = handler.get_latency();
+    EXPECT_FLOAT_EQ(handler.get_max_inference_time(), 20.f);
+
+    handler.set_inference_time_calibration(
+        {.m_enabled = true, .m_num_inferences = 16, .m_cache_path = ""});
+    handler.prepare(host_config);
+    EXPECT_GE(handler.get_max_inference_time(), 1.f);
+    EXPECT_LT(handler.get_max_inference_time(), 10.f);
+    EXPECT_LT(handler.get_latency(), configured_latency);
+
+    handler.set_inference_time_calibration({});
+    handler.prepare(host_config);
+    EXPECT_FLOAT_EQ(handler.get_max_inference_time(), 20.f);
+    EXPECT_EQ(handler.get_latency(), configured_latency);
+}
@@ -0,0 +1,153 @@
+#include <anira/ContextConfig.h>
+#include <anira/InferenceConfig.h>
+#include <anira/InferenceHandler.h>
+#include <anira/PrePostProcessor.h>
+#include <anira/backends/BackendBase.h>
+#include <anira/utils/Buffer.h>
+#include <anira/utils/HostConfig.h>
+#include <anira/utils/InferenceBackend.h>
+#include <anira/utils/InputRecorder.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "../TestConfig.h"
+#include "gtest/gtest.h"
+
+using namespace anira;
+
+namespace {
+
+constexpr size_t k_buffer_size = 128;
+
+// A uniquely named file in the temp directory that is removed at the end of the test, also if an
+// assertion fails
+class TempFile {
+public:
+    explicit TempFile(const std::string& prefix)
+        : m_path(std::filesystem::temp_directory_path() /
+                 (prefix + "_" + std::to_string(std::random_device{}()) + ".bin")) {}
+    ~TempFile() {
+        std::error_code error;
+        std::filesystem::remove(m_path, error);
+    }
+    TempFile(const TempFile&) = delete;
+    TempFile& operator=(const TempFile&) = delete;
+
+    std::string get_path() const { return m_path.string(); }
+
+private:
+    std::filesystem::path m_path;
+};
+
+}  // namespace
+
+// Records captured on several threads must be read back with their tags, timings and samples.
+TEST(InputRecorderTest, WritesAndReadsRecords) {
+    constexpr size_t k_num_threads = 4;
+    constexpr uint64_t k_records_per_thread = 50;
+
+    TempFile const file("anira_input_recorder_test");
+    std::string const path = file.get_path();
+    ASSERT_TRUE(InputRecorder::start(path));
+    EXPECT_FALSE(InputRecorder::start(path));
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < k_num_threads; ++t) {
+        threads.emplace_back([t] {
+            std::vector<BufferF> inputs;
+            inputs.emplace_back(1, 16);
+            inputs.emplace_back(2, 4);
+            for (uint64_t i = 0; i < k_records_per_thread; ++i) {
+                inputs[0].set_sample(0, 0, static_cast<float>(i));
+                inputs[1].set_sample(1, 3, static_cast<float>(t));
+                RecordedInference* record = nullptr;
+                while ((record = InputRecorder::capture(inputs)) == nullptr) {
+                    std::this_thread::yield();
+                }
+                InputRecorder::commit(record,
+                                      static_cast<int>(t),
+                                      InferenceBackend::CUSTOM,
+                                      i,
+                                      static_cast<int64_t>(i),
+                                      static_cast<int64_t>(i) * 2);
+            }
+        });
+    }
+    for (auto& thread : threads) { thread.join(); }
+    InputRecorder::stop();
+    EXPECT_FALSE(InputRecorder::is_running());
+
+    std::vector<RecordedInference> records;
+    ASSERT_TRUE(InputRecorder::read(path, records));
+    ASSERT_EQ(records.size(), k_num_threads * k_records_per_thread);
+
+    std::vector<uint64_t> records_per_session(k_num_threads, 0);
+    for (const auto& record : records) {
+        ASSERT_LT(record.m_session_id, static_cast<int>(k_num_threads));
+        EXPECT_EQ(record.m_backend, InferenceBackend::CUSTOM);
+        EXPECT_EQ(record.m_queue_wait_ns, static_cast<int64_t>(record.m_sequence));
+        EXPECT_EQ(record.m_inference_ns, static_cast<int64_t>(record.m_sequence) * 2);
+        ASSERT_EQ(record.m_inputs.size(), 2u);
+        EXPECT_EQ(record.m_inputs[0].get_num_samples(), 16u);
+        EXPECT_EQ(record.m_inputs[1].get_num_channels(), 2u);
+        EXPECT_EQ(record.m_inputs[0].get_sample(0, 0), static_cast<float>(record.m_sequence));
+        EXPECT_EQ(record.m_inputs[1].get_sample(1, 3), static_cast<float>(record.m_session_id));
+        records_per_session[static_cast<size_t>(record.m_session_id)]++;
+    }
+    for (uint64_t const count : records_per_session) { EXPECT_EQ(count, k_records_per_thread); }
+
+    // A truncated file keeps the records read before the error
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    EXPECT_FALSE(InputRecorder::read(path, records));
+    EXPECT_EQ(records.size(), k_num_threads * k_records_per_thread - 1);
+}
+
+// Inferences of a session must be recorded by the inference threads and replay on a backend
+// without the scheduler.
+TEST(InputRecorderTest, RecordsSessionAndReplays) {
+    InferenceConfig config = make_identity_config(k_buffer_size);
+    PrePostProcessor pp_processor(config);
+    InferenceHandler handler(pp_processor, config, ContextConfig(1));
+    handler.prepare(HostConfig(k_buffer_size, 48000));
+    handler.set_inference_backend(InferenceBackend::CUSTOM);
+
+    TempFile const file("anira_input_recorder_session_test");
+    std::string const path = file.get_path();
+    ASSERT_TRUE(InputRecorder::start(path));
+
+    BufferF buffer(1, k_buffer_size);
+    constexpr size_t k_num_blocks = 20;
+    for (size_t block = 0; block < k_num_blocks; ++block) {
+        for (size_t i = 0; i < k_buffer_size; ++i) {
+            buffer.set_sample(0, i, static_cast<float>(block));
+        }
+        handler.process(buffer.get_array_of_write_pointers(), k_buffer_size);
+        std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    InputRecorder::stop();
+
+    std::vector<RecordedInference> records;
+    ASSERT_TRUE(InputRecorder::read(path, records));
+    ASSERT_GT(records.size(), 0u);
+    for (const auto& record : records) {
+        EXPECT_EQ(record.m_session_id, handler.get_statistics().m_session_id);
+        EXPECT_EQ(record.m_backend, InferenceBackend::CUSTOM);
+        EXPECT_GE(record.m_queue_wait_ns, 0);
+        ASSERT_EQ(record.m_inputs.size(), 1u);
+        EXPECT_EQ(record.m_inputs[0].get_num_samples(), k_buffer_size);
+    }
+
+    BackendBase backend(config);
+    std::vector<int64_t> const durations = InputRecorder::replay(backend, records);
+    ASSERT_EQ(durations.size(), records.size());
+    for (int64_t const duration : durations) { EXPECT_GE(duration, 0); }
+}
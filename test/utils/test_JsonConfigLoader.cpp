@@ -62,6 +62,8 @@ void expect_inference_config_eq(const InferenceConfig& a, const InferenceConfig&
         if (!tensor_shape_a.m_universal && !tensor_shape_b.m_universal) {
             EXPECT_EQ(tensor_shape_a.m_backend, tensor_shape_b.m_backend)
                 << "Mismatch in m_backend for tensor_shape[" << i << "]";
+            EXPECT_EQ(tensor_shape_a.m_layout, tensor_shape_b.m_layout)
+                << "Mismatch in m_layout for tensor_shape[" << i << "]";
         }
 
         EXPECT_EQ(tensor_shape_a.m_tensor_input_shape, tensor_shape_b.m_tensor_input_shape)
@@ -0,0 +1,152 @@
+#include <anira/ContextConfig.h>
+#include <anira/InferenceConfig.h>
+#include <anira/InferenceHandler.h>
+#include <anira/PrePostProcessor.h>
+#include <anira/backends/BackendBase.h>
+#include <anira/scheduler/SessionElement.h>
+#include <anira/utils/Buffer.h>
+#include <anira/utils/HostConfig.h>
+#include <anira/utils/InferenceBackend.h>
+#include <anira/utils/LayoutTransform.h>
+#include <anira/utils/TensorLayout.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../TestConfig.h"
+#include "gtest/gtest.h"
+
+using namespace anira;
+
+namespace {
+
+constexpr size_t k_num_channels = 2;
+constexpr size_t k_num_samples = 16;
+
+std::vector<float> make_ramp(size_t size) {
+    std::vector<float> values(size);
+    for (size_t i = 0; i < size; ++i) { values[i] = static_cast<float>(i) + 0.5f; }
+    return values;
+}
+
+// Expects channels-last inputs and negates the second channel, so a planar tensor passed as is
+// negates the wrong samples
+class ChannelsLastBackend : public BackendBase {
+public:
+    ChannelsLastBackend(InferenceConfig& config) : BackendBase(config) {}
+
+    void process(std::vector<BufferF>& input,
+                 std::vector<BufferF>& output,
+                 [[maybe_unused]] std::shared_ptr<SessionElement> session) override {
+        for (size_t sample = 0; sample < k_num_samples; ++sample) {
+            for (size_t channel = 0; channel < k_num_channels; ++channel) {
+                size_t const index = sample * k_num_channels + channel;
+                float const value = input[0].get_sample(0, index);
+                output[0].set_sample(0, index, channel == 0 ? value : -value);
+            }
+        }
+    }
+};
+
+}  // namespace
+
+TEST(LayoutTransformTest, TransposesAnyShape) {
+    std::vector<std::pair<size_t, size_t>> const shapes = {
+        {1, 7}, {7, 1}, {2, 9}, {9, 2}, {4, 4}, {5, 13}, {37, 70}, {150, 3}};
+    for (auto const& [num_rows, num_columns] : shapes) {
+        std::vector<float> const source = make_ramp(num_rows * num_columns);
+        std::vector<float> destination(source.size(), 0.f);
+        LayoutTransform::transpose(source.data(), destination.data(), num_rows, num_columns);
+        for (size_t row = 0; row < num_rows; ++row) {
+            for (size_t column = 0; column < num_columns; ++column) {
+                ASSERT_EQ(destination[column * num_rows + row], source[row * num_columns + column])
+                    << num_rows << "x" << num_columns << " at " << row << ", " << column;
+            }
+        }
+    }
+}
+
+TEST(LayoutTransformTest, InterleavesAndDeinterleaves) {
+    constexpr size_t k_length = 13;
+    for (size_t const num_channels : {1, 2, 3, 4, 5, 8}) {
+        BufferF planar(num_channels, k_length);
+        std::vector<float> const ramp = make_ramp(num_channels * k_length);
+        for (size_t channel = 0; channel < num_channels; ++channel) {
+            for (size_t sample = 0; sample < k_length; ++sample) {
+                planar.set_sample(channel, sample, ramp[channel * k_length + sample]);
+            }
+        }
+
+        std::vector<float> interleaved(num_channels * k_length, 0.f);
+        LayoutTransform::interleave(
+            planar.get_array_of_read_pointers(), interleaved.data(), num_channels, k_length);
+        for (size_t channel = 0; channel < num_channels; ++channel) {
+            for (size_t sample = 0; sample < k_length; ++sample) {
+                ASSERT_EQ(interleaved[sample * num_channels + channel],
+                          planar.get_sample(channel, sample))
+                    << num_channels << " channels at " << channel << ", " << sample;
+            }
+        }
+
+        BufferF deinterleaved(num_channels, k_length);
+        LayoutTransform::deinterleave(interleaved.data(),
+                                      deinterleaved.get_array_of_write_pointers(),
+                                      num_channels,
+                                      k_length);
+        for (size_t channel = 0; channel < num_channels; ++channel) {
+            for (size_t sample = 0; sample < k_length; ++sample) {
+                ASSERT_EQ(deinterleaved.get_sample(channel, sample),
+                          planar.get_sample(channel, sample));
+            }
+        }
+    }
+}
+
+// The pre- and post-processing stay planar while the backend sees channels-last tensors
+TEST(LayoutTransformTest, ConvertsTensorsOfChannelsLastBackends) {
+    constexpr auto k_channels = static_cast<int64_t>(k_num_channels);
+    constexpr auto k_samples = static_cast<int64_t>(k_num_samples);
+    std::vector<ModelData> const model_data = make_placeholder_model_data();
+    std::vector<TensorShape> const tensor_shape = {
+        {{{1, k_channels, k_samples}}, {{1, k_channels, k_samples}}},
+        {{{1, k_samples, k_channels}},
+         {{1, k_samples, k_channels}},
+         InferenceBackend::CUSTOM,
+         CHANNELS_LAST}};
+    ProcessingSpec const processing_spec({k_num_channels},
+                                         {k_num_channels},
+                                         {k_num_samples},
+                                         {k_num_samples});
+    InferenceConfig config(model_data, tensor_shape, processing_spec, 5.f);
+    EXPECT_EQ(config.get_tensor_layout(InferenceBackend::CUSTOM), CHANNELS_LAST);
+
+    PrePostProcessor pp_processor(config);
+    ChannelsLastBackend backend(config);
+    InferenceHandler handler(pp_processor, config, backend, ContextConfig(1));
+    handler.set_inference_backend(InferenceBackend::CUSTOM);
+    handler.prepare(HostConfig(k_num_samples, 48000));
+
+    constexpr size_t k_length = 32 * k_num_samples;
+    BufferF input(k_num_channels, k_length);
+    BufferF output(k_num_channels, k_length);
+    for (size_t channel = 0; channel < k_num_channels; ++channel) {
+        for (size_t sample = 0; sample < k_length; ++sample) {
+            input.set_sample(channel, sample, static_cast<float>(channel * k_length + sample + 1));
+        }
+    }
+
+    size_t const rendered = handler.render(input.get_array_of_read_pointers(),
+                                           k_length,
+                                           output.get_array_of_write_pointers(),
+                                           k_length);
+    ASSERT_EQ(rendered, k_length);
+
+    // Rendered samples are aligned with the input
+    for (size_t sample = 0; sample < k_length; ++sample) {
+        ASSERT_EQ(output.get_sample(0, sample), input.get_sample(0, sample)) << "sample " << sample;
+        ASSERT_EQ(output.get_sample(1, sample), -input.get_sample(1, sample)) << "sample " << sample;
+    }
+}
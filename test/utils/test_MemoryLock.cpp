@@ -0,0 +1,114 @@
+#include <anira/ContextConfig.h>
+#include <anira/InferenceConfig.h>
+#include <anira/InferenceHandler.h>
+#include <anira/PrePostProcessor.h>
+#include <anira/scheduler/Context.h>
+#include <anira/scheduler/MemoryFootprint.h>
+#include <anira/utils/HostConfig.h>
+#include <anira/utils/InferenceBackend.h>
+#include <anira/utils/MemoryBlock.h>
+#include <anira/utils/MemoryLock.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "../TestConfig.h"
+#include "gtest/gtest.h"
+
+using namespace anira;
+
+namespace {
+
+constexpr size_t k_buffer_size = 256;
+
+// Locking may exceed the limits of the machine running the tests, every byte must be accounted
+// either way
+void expect_accounted(const MemoryLockStatus& status, size_t bytes) {
+    EXPECT_EQ(status.m_locked_bytes + status.m_failed_bytes, bytes);
+    EXPECT_EQ(status.is_ok(), status.m_failed_bytes == 0);
+    EXPECT_EQ(status.m_errors.empty(), status.m_failed_bytes == 0);
+}
+
+}  // namespace
+
+TEST(MemoryLockTest, LocksAndUnlocksRanges) {
+    size_t const bytes = 4 * MemoryLock::get_page_size() + 3;
+    MemoryBlock<std::byte> block(bytes);
+    block.clear();
+
+    MemoryLockStatus status;
+    bool const locked = MemoryLock::lock(block.data(), bytes, status);
+    expect_accounted(status, bytes);
+    EXPECT_EQ(locked, status.is_ok());
+    if (locked) { MemoryLock::unlock(block.data(), bytes); }
+
+    // Empty ranges are ignored
+    MemoryLockStatus empty_status;
+    EXPECT_TRUE(MemoryLock::lock(nullptr, bytes, empty_status));
+    EXPECT_TRUE(MemoryLock::lock(block.data(), 0, empty_status));
+    expect_accounted(empty_status, 0);
+
+    MemoryLockStatus merged;
+    merged.merge(status);
+    merged.merge(status);
+    EXPECT_EQ(merged.m_locked_bytes, 2 * status.m_locked_bytes);
+    EXPECT_EQ(merged.m_errors.size(), 2 * status.m_errors.size());
+}
+
+// Ranges sharing a page, e.g. heap buffers of different sessions, keep it locked until the last
+// one is unlocked
+TEST(MemoryLockTest, CountsLocksOfSharedPages) {
+    size_t const page_size = MemoryLock::get_page_size();
+    MemoryBlock<std::byte> block(2 * page_size);
+    std::byte* const first = block.data();
+    std::byte* const second = block.data() + page_size / 2;
+
+    MemoryLockStatus status;
+    if (!MemoryLock::lock(first, page_size / 4, status)) {
+        GTEST_SKIP() << "Memory locking is not permitted: " << status.m_errors.back();
+    }
+    ASSERT_TRUE(MemoryLock::lock(second, page_size, status));
+    EXPECT_TRUE(MemoryLock::is_locked(first));
+    EXPECT_TRUE(MemoryLock::is_locked(second + page_size - 1));
+
+    MemoryLock::unlock(second, page_size);
+    EXPECT_TRUE(MemoryLock::is_locked(first));
+    EXPECT_FALSE(MemoryLock::is_locked(second + page_size - 1));
+
+    MemoryLock::unlock(first, page_size / 4);
+    EXPECT_FALSE(MemoryLock::is_locked(first));
+}
+
+// Every session buffer, or the slab in arena mode, and the stacks of the pool threads are locked
+TEST(MemoryLockTest, ContextLocksSessionsAndThreads) {
+    InferenceConfig config = make_identity_config(k_buffer_size);
+    PrePostProcessor pp_processor(config);
+    ContextConfig context_config(1);
+    context_config.m_lock_memory = true;
+    InferenceHandler handler(pp_processor, config, context_config);
+    handler.set_inference_backend(InferenceBackend::CUSTOM);
+    handler.prepare(HostConfig(k_buffer_size, 48000));
+
+    MemoryFootprint const footprint = handler.get_memory_footprint();
+    expect_accounted(handler.get_memory_lock_status(),
+                     footprint.m_send_buffer_bytes + footprint.m_receive_buffer_bytes +
+                         footprint.m_struct_tensor_bytes);
+
+    handler.set_arena_enabled(true);
+    handler.prepare(HostConfig(k_buffer_size, 48000));
+    const auto& arena = Context::get_sessions().front()->m_arena;
+    ASSERT_NE(arena, nullptr);
+    expect_accounted(handler.get_memory_lock_status(), arena->m_arena.get_capacity());
+
+    // The threads lock their stacks asynchronously when they start
+    MemoryLockStatus thread_status;
+    for (int i = 0; i < 1000 && thread_status.m_locked_bytes + thread_status.m_failed_bytes == 0;
+         ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        thread_status = Context::get_memory_lock_status();
+    }
+    expect_accounted(thread_status, MemoryLock::k_stack_size);
+}
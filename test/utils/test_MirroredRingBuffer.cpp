@@ -0,0 +1,82 @@
+#include <anira/utils/MirroredRingBuffer.h>
+#include <anira/utils/RealtimeLogger.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace anira;
+
+TEST(MirroredRingBufferTest, RoundsCapacityToPowerOfTwo) {
+    MirroredRingBuffer ring_buffer;
+    ring_buffer.initialize(2, 1000);
+    EXPECT_EQ(ring_buffer.get_num_channels(), 2);
+    EXPECT_GE(ring_buffer.get_capacity(), 1024);
+    EXPECT_EQ(ring_buffer.get_capacity() & (ring_buffer.get_capacity() - 1), 0);
+    for (size_t channel = 0; channel < 2; ++channel) {
+        EXPECT_EQ(ring_buffer.get_available_samples(channel), 0);
+        EXPECT_EQ(ring_buffer.get_available_past_samples(channel), ring_buffer.get_capacity());
+    }
+}
+
+// Windows crossing the end of the channel are contiguous and hold the samples in order
+TEST(MirroredRingBufferTest, WindowsAcrossTheWrapAreContiguous) {
+    MirroredRingBuffer ring_buffer;
+    ring_buffer.initialize(1, 1000);
+    size_t const capacity = ring_buffer.get_capacity();
+    size_t const block_size = capacity / 4 + 3;
+    size_t const num_old_samples = capacity / 2;
+
+    std::vector<float> block(block_size);
+    float value = 1.f;
+    size_t num_pushed = 0;
+    for (size_t i = 0; i < 20; ++i) {
+        for (float& sample : block) { sample = value++; }
+        ring_buffer.push_samples(0, block.data(), block_size);
+        num_pushed += block_size;
+
+        size_t const num_old = std::min(num_old_samples, num_pushed - block_size);
+        const float* window = ring_buffer.get_window(0, block_size, num_old);
+        ASSERT_NE(window, nullptr);
+        // Sample values count up from 1, so the window must count up from the first old one
+        float const first = static_cast<float>(num_pushed - block_size - num_old + 1);
+        for (size_t j = 0; j < num_old + block_size; ++j) {
+            ASSERT_EQ(window[j], first + static_cast<float>(j)) << "block " << i << " index " << j;
+        }
+        ring_buffer.advance(0, block_size);
+    }
+    EXPECT_EQ(ring_buffer.get_available_samples(0), 0);
+}
+
+TEST(MirroredRingBufferTest, OverflowAndUnderflow) {
+    RealtimeLogger::set_rate_limiting(false);
+    MirroredRingBuffer ring_buffer;
+    ring_buffer.initialize(1, 1000);
+    size_t const capacity = ring_buffer.get_capacity();
+
+    testing::internal::CaptureStderr();
+    for (size_t i = 0; i < capacity + 2; ++i) {
+        ring_buffer.push_sample(0, static_cast<float>(i));
+    }
+    EXPECT_EQ(ring_buffer.get_available_samples(0), capacity);
+    EXPECT_EQ(ring_buffer.pop_sample(0), 2.f);
+
+    EXPECT_EQ(ring_buffer.get_window(0, capacity, 0), nullptr);
+    ring_buffer.advance(0, capacity);
+    EXPECT_EQ(ring_buffer.pop_sample(0), 0.f);
+    RealtimeLogger::flush();
+    std::string const output = testing::internal::GetCapturedStderr();
+    EXPECT_NE(output.find("MirroredRingBuffer: Buffer overflow"), std::string::npos);
+    EXPECT_NE(output.find("MirroredRingBuffer: Attempted to pop sample from empty buffer"),
+              std::string::npos);
+
+    ring_buffer.clear();
+    EXPECT_EQ(ring_buffer.get_available_samples(0), 0);
+    const float* window = ring_buffer.get_window(0, 0, capacity);
+    ASSERT_NE(window, nullptr);
+    for (size_t i = 0; i < capacity; ++i) { ASSERT_EQ(window[i], 0.f); }
+    RealtimeLogger::set_rate_limiting(true);
+}
@@ -0,0 +1,140 @@
+#include <anira/InferenceConfig.h>
+#include <anira/PrePostProcessor.h>
+#include <anira/utils/Buffer.h>
+#include <anira/utils/InferenceBackend.h>
+#include <anira/utils/ParameterBlock.h>
+#include <anira/utils/RingBuffer.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "../TestConfig.h"
+#include "gtest/gtest.h"
+
+using namespace anira;
+
+TEST(ParameterBlockTest, WritesAndReadsRanges) {
+    ParameterBlock block(8);
+    ASSERT_EQ(block.size(), 8);
+
+    std::vector<float> values(8, 1.f);
+    ASSERT_TRUE(block.read(values.data(), values.size()));
+    for (float const value : values) { EXPECT_EQ(value, 0.f); }
+
+    uint32_t const sequence = block.get_sequence();
+    std::vector<float> const published = {1.f, 2.f, 3.f};
+    block.write(published.data(), published.size(), 4);
+    EXPECT_NE(block.get_sequence(), sequence);
+    EXPECT_EQ(block.get_sequence() % 2, 0u);
+
+    std::vector<float> snapshot(3);
+    ASSERT_TRUE(block.read(snapshot.data(), snapshot.size(), 4));
+    EXPECT_EQ(snapshot, published);
+    EXPECT_EQ(block.get(3), 0.f);
+    EXPECT_EQ(block.get(5), 2.f);
+
+    uint32_t const before_set = block.get_sequence();
+    block.set(7, 9.f);
+    EXPECT_EQ(block.get(7), 9.f);
+    EXPECT_EQ(block.get_sequence(), before_set + 2);
+}
+
+// Every snapshot reported as consistent holds the values of exactly one write
+TEST(ParameterBlockTest, SnapshotsAreConsistent) {
+    constexpr size_t k_size = 4096;
+    constexpr int k_num_writes = 2000;
+    ParameterBlock block(k_size);
+    std::atomic<bool> done{false};
+
+    std::thread writer([&]() {
+        std::vector<float> tensor(k_size);
+        for (int write = 1; write <= k_num_writes; ++write) {
+            std::fill(tensor.begin(), tensor.end(), static_cast<float>(write));
+            block.write(tensor.data(), tensor.size());
+        }
+        done.store(true);
+    });
+
+    std::vector<float> snapshot(k_size);
+    size_t num_consistent = 0;
+    while (!done.load() || num_consistent == 0) {
+        if (!block.read(snapshot.data(), snapshot.size())) { continue; }
+        num_consistent++;
+        for (float const value : snapshot) { ASSERT_EQ(value, snapshot.front()); }
+    }
+    writer.join();
+
+    ASSERT_TRUE(block.read(snapshot.data(), snapshot.size()));
+    EXPECT_EQ(snapshot.front(), static_cast<float>(k_num_writes));
+    EXPECT_GT(num_consistent, 0u);
+}
+
+// try_write() never waits, it either publishes all values or none while another thread writes
+TEST(ParameterBlockTest, TryWriteNeverWaitsForOtherWriters) {
+    constexpr size_t k_size = 4096;
+    constexpr int k_num_writes = 2000;
+    ParameterBlock block(k_size);
+
+    std::vector<float> tensor(k_size, 1.f);
+    EXPECT_TRUE(block.try_write(tensor.data(), tensor.size()));
+
+    std::thread writer([&]() {
+        std::vector<float> values(k_size, -1.f);
+        for (int write = 0; write < k_num_writes; ++write) {
+            block.write(values.data(), values.size());
+        }
+    });
+
+    std::vector<float> snapshot(k_size);
+    for (int write = 0; write < k_num_writes; ++write) {
+        block.try_write(tensor.data(), tensor.size());
+        if (!block.read(snapshot.data(), snapshot.size())) { continue; }
+        for (float const value : snapshot) { ASSERT_EQ(value, snapshot.front()); }
+    }
+    writer.join();
+
+    EXPECT_TRUE(block.try_write(tensor.data(), tensor.size()));
+    ASSERT_TRUE(block.read(snapshot.data(), snapshot.size()));
+    EXPECT_EQ(snapshot.front(), 1.f);
+    EXPECT_EQ(block.get_sequence() % 2, 0u);
+}
+
+TEST(ParameterBlockTest, PrePostProcessorCopiesWholeTensors) {
+    constexpr size_t k_buffer_size = 64;
+    constexpr size_t k_latent_size = 512;
+    std::vector<ModelData> const model_data = make_placeholder_model_data();
+    std::vector<TensorShape> const tensor_shape = {
+        {{{1, 1, static_cast<int64_t>(k_buffer_size)}, {1, static_cast<int64_t>(k_latent_size)}},
+         {{1, 1, static_cast<int64_t>(k_buffer_size)}, {1, static_cast<int64_t>(k_latent_size)}}}};
+    ProcessingSpec const processing_spec({1, 1}, {1, 1}, {k_buffer_size, 0}, {k_buffer_size, 0});
+    InferenceConfig config(model_data, tensor_shape, processing_spec, 5.f);
+    PrePostProcessor pp_processor(config);
+
+    std::vector<float> latents(k_latent_size);
+    for (size_t i = 0; i < k_latent_size; ++i) { latents[i] = static_cast<float>(i); }
+    pp_processor.set_input_tensor(latents.data(), 1, k_latent_size);
+    pp_processor.set_input(-1.f, 1, 3);
+    EXPECT_EQ(pp_processor.get_input(1, 2), 2.f);
+
+    std::vector<RingBuffer> send_buffer(2);
+    send_buffer[0].initialize_with_positions(1, k_buffer_size);
+    for (size_t i = 0; i < k_buffer_size; ++i) { send_buffer[0].push_sample(0, 0.f); }
+    std::vector<BufferF> tensors = {BufferF(1, k_buffer_size), BufferF(1, k_latent_size)};
+    pp_processor.pre_process(send_buffer, tensors, InferenceBackend::CUSTOM);
+    latents[3] = -1.f;
+    for (size_t i = 0; i < k_latent_size; ++i) {
+        EXPECT_EQ(tensors[1].get_sample(0, i), latents[i]);
+    }
+
+    std::vector<RingBuffer> receive_buffer(2);
+    receive_buffer[0].initialize_with_positions(1, k_buffer_size);
+    pp_processor.post_process(tensors, receive_buffer, InferenceBackend::CUSTOM);
+    std::vector<float> output(k_latent_size);
+    ASSERT_TRUE(pp_processor.get_output_tensor(output.data(), 1, k_latent_size));
+    EXPECT_EQ(output, latents);
+    EXPECT_EQ(pp_processor.get_output(1, 3), -1.f);
+}
@@ -0,0 +1,124 @@
+#include <anira/utils/RealtimeLogger.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace anira;
+
+namespace {
+
+// Collects drained messages and restores the default logger configuration afterwards
+class RealtimeLoggerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        RealtimeLogger::flush();
+        RealtimeLogger::set_sink([this](LogLevel level, const char* message) {
+            m_messages.emplace_back(level, message);
+        });
+    }
+
+    void TearDown() override {
+        RealtimeLogger::set_sink({});
+        RealtimeLogger::set_level(LogLevel::Info);
+    }
+
+    std::vector<std::pair<LogLevel, std::string>> m_messages;
+};
+
+}  // namespace
+
+TEST_F(RealtimeLoggerTest, FormatsMessages) {
+    RealtimeLogger::log(LogLevel::Warning,
+                        nullptr,
+                        "Missing samples: %zu in session: %d",
+                        size_t{512},
+                        3);
+    RealtimeLogger::flush();
+
+    ASSERT_EQ(m_messages.size(), 1u);
+    EXPECT_EQ(m_messages[0].first, LogLevel::Warning);
+    EXPECT_EQ(m_messages[0].second, "Missing samples: 512 in session: 3");
+}
+
+TEST_F(RealtimeLoggerTest, FiltersBySeverity) {
+    RealtimeLogger::set_level(LogLevel::Warning);
+    RealtimeLogger::log(LogLevel::Info, nullptr, "info");
+    RealtimeLogger::log(LogLevel::Warning, nullptr, "warning");
+    RealtimeLogger::log(LogLevel::Error, nullptr, "error");
+    RealtimeLogger::set_level(LogLevel::None);
+    RealtimeLogger::log(LogLevel::Error, nullptr, "suppressed");
+    RealtimeLogger::flush();
+
+    ASSERT_EQ(m_messages.size(), 2u);
+    EXPECT_EQ(m_messages[0].second, "warning");
+    EXPECT_EQ(m_messages[1].second, "error");
+}
+
+// Only a burst per window passes a call site, the next message that passes reports how many
+// were suppressed in between.
+TEST_F(RealtimeLoggerTest, RateLimitsPerCallSite) {
+    LogRateLimiter rate_limiter;
+    for (int i = 0; i < 100; ++i) {
+        RealtimeLogger::log(LogLevel::Warning, &rate_limiter, "message %d", i);
+    }
+    RealtimeLogger::flush();
+    ASSERT_EQ(m_messages.size(), LogRateLimiter::k_burst);
+
+    // The first message of the next window reports the suppressed ones
+    int64_t const next_window_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                       std::chrono::steady_clock::now().time_since_epoch())
+                                       .count() +
+                                   LogRateLimiter::k_window_ns;
+    uint32_t suppressed = 0;
+    EXPECT_TRUE(rate_limiter.allow(next_window_ns, suppressed));
+    EXPECT_EQ(suppressed, 100u - LogRateLimiter::k_burst);
+}
+
+TEST_F(RealtimeLoggerTest, DropsAndReportsOverflow) {
+    for (size_t i = 0; i < RealtimeLogger::k_capacity + 10; ++i) {
+        RealtimeLogger::log(LogLevel::Info, nullptr, "message %zu", i);
+    }
+    RealtimeLogger::flush();
+
+    ASSERT_EQ(m_messages.size(), RealtimeLogger::k_capacity + 1);
+    EXPECT_EQ(m_messages.back().second, "Realtime logger dropped 10 messages!");
+}
+
+TEST_F(RealtimeLoggerTest, ConcurrentProducersWithBackgroundDrain) {
+    constexpr size_t k_num_threads = 4;
+    constexpr size_t k_messages_per_thread = 1000;
+
+    RealtimeLogger::start();
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < k_num_threads; ++t) {
+        threads.emplace_back([t] {
+            for (size_t i = 0; i < k_messages_per_thread; ++i) {
+                RealtimeLogger::log(LogLevel::Info, nullptr, "thread %zu message %zu", t, i);
+                if (i % 32 == 0) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+            }
+        });
+    }
+    for (auto& thread : threads) { thread.join(); }
+    RealtimeLogger::stop();
+
+    // Every message was either delivered or reported as dropped
+    size_t delivered = 0;
+    size_t dropped = 0;
+    for (const auto& [level, message] : m_messages) {
+        unsigned long long count = 0;
+        if (std::sscanf(message.c_str(), "Realtime logger dropped %llu messages!", &count) == 1) {
+            dropped += count;
+        } else {
+            delivered++;
+        }
+    }
+    EXPECT_EQ(delivered + dropped, k_num_threads * k_messages_per_thread);
+}
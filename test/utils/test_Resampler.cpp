@@ -0,0 +1,243 @@
+#include <anira/ContextConfig.h>
+#include <anira/InferenceConfig.h>
+#include <anira/InferenceHandler.h>
+#include <anira/PrePostProcessor.h>
+#include <anira/backends/BackendBase.h>
+#include <anira/utils/Buffer.h>
+#include <anira/utils/HostConfig.h>
+#include <anira/utils/InferenceBackend.h>
+#include <anira/utils/Resampler.h>
+#include <anira/utils/ResamplerQuality.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "../TestConfig.h"
+#include "gtest/gtest.h"
+
+using namespace anira;
+
+namespace {
+
+constexpr double k_host_sample_rate = 44100.;
+constexpr double k_model_sample_rate = 48000.;
+constexpr double k_frequency = 441.;
+
+float sine(double time_in_seconds) {
+    if (time_in_seconds < 0.) { return 0.f; }
+    return static_cast<float>(0.5 * std::sin(2. * std::numbers::pi * k_frequency * time_in_seconds));
+}
+
+BufferF make_sine(size_t num_samples, double sample_rate) {
+    BufferF buffer(1, num_samples);
+    for (size_t i = 0; i < num_samples; ++i) {
+        buffer.set_sample(0, i, sine(static_cast<double>(i) / sample_rate));
+    }
+    return buffer;
+}
+
+// Streams a sine through an identity model running at 48 kHz behind a 44.1 kHz host
+void expect_delayed_sine(const std::vector<unsigned int>& custom_latency) {
+    constexpr size_t k_hop_size = 256;
+    constexpr size_t k_buffer_size = 512;
+    constexpr size_t k_num_blocks = 64;
+
+    ProcessingSpec processing_spec({1}, {1}, {k_hop_size}, {k_hop_size});
+    processing_spec.m_model_sample_rate = static_cast<float>(k_model_sample_rate);
+    InferenceConfig config = make_identity_config(k_hop_size, processing_spec);
+
+    PrePostProcessor pp_processor(config);
+    BackendBase backend(config);
+    InferenceHandler handler(pp_processor, config, backend, ContextConfig(2));
+    handler.set_inference_backend(InferenceBackend::CUSTOM);
+    HostConfig const host_config(k_buffer_size, static_cast<float>(k_host_sample_rate));
+    if (custom_latency.empty()) {
+        handler.prepare(host_config);
+    } else {
+        handler.prepare(host_config, custom_latency);
+    }
+    handler.set_non_realtime(true);
+
+    size_t const latency = handler.get_latency();
+    if (!custom_latency.empty()) { EXPECT_EQ(latency, custom_latency[0]); }
+
+    BufferF const input = make_sine(k_num_blocks * k_buffer_size, k_host_sample_rate);
+    BufferF block(1, k_buffer_size);
+    for (size_t b = 0; b < k_num_blocks; ++b) {
+        std::copy_n(input.get_read_pointer(0, b * k_buffer_size),
+                    k_buffer_size,
+                    block.get_write_pointer(0));
+        ASSERT_EQ(handler.process(block.get_array_of_write_pointers(), k_buffer_size),
+                  k_buffer_size);
+        for (size_t i = 0; i < k_buffer_size; ++i) {
+            size_t const n = b * k_buffer_size + i;
+            // The filters ring briefly where the sine starts
+            if (n < latency + k_hop_size) { continue; }
+            ASSERT_NEAR(block.get_sample(0, i), input.get_sample(0, n - latency), 2e-3f)
+                << "sample " << n;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(ResamplerTest, ConvertsSineWithReportedLatency) {
+    for (auto const quality : {LOW_QUALITY, MEDIUM_QUALITY, HIGH_QUALITY}) {
+        constexpr size_t k_num_samples = 4410;
+        Resampler resampler;
+        resampler.prepare(1, k_host_sample_rate, k_model_sample_rate, quality, k_num_samples);
+        EXPECT_EQ(resampler.get_interpolation_factor(), 160u);
+        EXPECT_EQ(resampler.get_decimation_factor(), 147u);
+
+        BufferF const input = make_sine(k_num_samples, k_host_sample_rate);
+        BufferF output(1, resampler.get_max_num_output_samples(k_num_samples));
+        size_t const num_output_samples = resampler.process(input.get_array_of_read_pointers(),
+                                                            k_num_samples,
+                                                            output.get_array_of_write_pointers(),
+                                                            output.get_num_samples());
+        EXPECT_EQ(num_output_samples, 4800u);
+
+        double const latency = resampler.get_latency();
+        EXPECT_GT(latency, 0.);
+        float const tolerance = quality == LOW_QUALITY ? 5e-3f : 1e-3f;
+        for (size_t i = static_cast<size_t>(2. * latency) + 1; i < num_output_samples; ++i) {
+            float const expected =
+                sine((static_cast<double>(i) - latency) / k_model_sample_rate);
+            ASSERT_NEAR(output.get_sample(0, i), expected, tolerance)
+                << "quality " << quality << " sample " << i;
+        }
+    }
+}
+
+TEST(ResamplerTest, DownsamplingUsesLongerFilters) {
+    Resampler resampler;
+    resampler.prepare(1, 96000., 44100., MEDIUM_QUALITY, 64);
+    EXPECT_EQ(resampler.get_interpolation_factor(), 147u);
+    EXPECT_EQ(resampler.get_decimation_factor(), 320u);
+    EXPECT_GT(resampler.get_num_taps(), Resampler::get_num_taps(MEDIUM_QUALITY));
+    EXPECT_EQ(resampler.get_num_taps() % 8, 0u);
+}
+
+// Blocks of any size produce the same samples as one block, and pull mode completes exactly the
+// requested output
+TEST(ResamplerTest, StreamingMatchesOneShot) {
+    constexpr size_t k_num_samples = 8192;
+    constexpr size_t k_max_block_size = 300;
+    BufferF input(2, k_num_samples);
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    for (size_t channel = 0; channel < 2; ++channel) {
+        for (size_t i = 0; i < k_num_samples; ++i) {
+            input.set_sample(channel, i, distribution(generator));
+        }
+    }
+
+    Resampler one_shot;
+    one_shot.prepare(2, k_model_sample_rate, k_host_sample_rate, HIGH_QUALITY, k_num_samples);
+    BufferF expected(2, one_shot.get_max_num_output_samples(k_num_samples));
+    size_t const num_expected = one_shot.process(input.get_array_of_read_pointers(),
+                                                 k_num_samples,
+                                                 expected.get_array_of_write_pointers(),
+                                                 expected.get_num_samples());
+
+    Resampler push;
+    push.prepare(2, k_model_sample_rate, k_host_sample_rate, HIGH_QUALITY, k_max_block_size);
+    BufferF output(2, num_expected + k_max_block_size);
+    std::uniform_int_distribution<size_t> block_sizes(0, k_max_block_size);
+    size_t num_input = 0;
+    size_t num_output = 0;
+    while (num_input < k_num_samples) {
+        size_t const block_size = std::min(block_sizes(generator), k_num_samples - num_input);
+        std::vector<const float*> block = {input.get_read_pointer(0, num_input),
+                                           input.get_read_pointer(1, num_input)};
+        std::vector<float*> destination = {output.get_write_pointer(0, num_output),
+                                           output.get_write_pointer(1, num_output)};
+        size_t const num_predicted = push.get_num_output_samples(block_size);
+        size_t const num_produced =
+            push.process(block.data(), block_size, destination.data(), k_max_block_size * 2);
+        ASSERT_EQ(num_produced, num_predicted);
+        ASSERT_LE(num_produced, push.get_max_num_output_samples(block_size));
+        num_input += block_size;
+        num_output += num_produced;
+    }
+    ASSERT_EQ(num_output, num_expected);
+    for (size_t channel = 0; channel < 2; ++channel) {
+        for (size_t i = 0; i < num_expected; ++i) {
+            ASSERT_EQ(output.get_sample(channel, i), expected.get_sample(channel, i))
+                << "channel " << channel << " sample " << i;
+        }
+    }
+
+    Resampler pull;
+    pull.prepare(2, k_model_sample_rate, k_host_sample_rate, HIGH_QUALITY, k_max_block_size);
+    num_input = 0;
+    num_output = 0;
+    while (num_output + k_max_block_size / 2 < num_expected) {
+        size_t const block_size = block_sizes(generator) / 2;
+        size_t const num_required = pull.get_num_input_samples(block_size);
+        ASSERT_LE(num_required, k_max_block_size);
+        std::vector<const float*> block = {input.get_read_pointer(0, num_input),
+                                           input.get_read_pointer(1, num_input)};
+        std::vector<float*> destination = {output.get_write_pointer(0, num_output),
+                                           output.get_write_pointer(1, num_output)};
+        ASSERT_EQ(pull.process(block.data(), num_required, destination.data(), block_size),
+                  block_size);
+        num_input += num_required;
+        num_output += block_size;
+    }
+    for (size_t i = 0; i < num_output; ++i) {
+        ASSERT_EQ(output.get_sample(0, i), expected.get_sample(0, i)) << "sample " << i;
+    }
+}
+
+TEST(ResamplerTest, PhaseOffsetAdvancesOutput) {
+    Resampler resampler;
+    resampler.prepare(1, k_host_sample_rate, k_model_sample_rate, MEDIUM_QUALITY, 64);
+    double const latency = resampler.get_latency();
+    resampler.set_phase_offset(147);
+    EXPECT_DOUBLE_EQ(resampler.get_latency(), latency - 1.);
+}
+
+TEST(ResamplerTest, ProcessesAtModelSampleRate) {
+    expect_delayed_sine({});
+}
+
+TEST(ResamplerTest, ProcessesAtModelSampleRateWithCustomLatency) {
+    expect_delayed_sine({2000});
+}
+
+TEST(ResamplerTest, RendersAtModelSampleRate) {
+    constexpr size_t k_hop_size = 256;
+    constexpr size_t k_num_samples = 44100;
+
+    ProcessingSpec processing_spec({1}, {1}, {k_hop_size}, {k_hop_size});
+    processing_spec.m_model_sample_rate = static_cast<float>(k_model_sample_rate);
+    InferenceConfig config = make_identity_config(k_hop_size, processing_spec);
+
+    PrePostProcessor pp_processor(config);
+    BackendBase backend(config);
+    InferenceHandler handler(pp_processor, config, backend, ContextConfig(2));
+    handler.set_inference_backend(InferenceBackend::CUSTOM);
+    handler.prepare(HostConfig(512, static_cast<float>(k_host_sample_rate)));
+    size_t const latency = handler.get_latency();
+
+    BufferF const input = make_sine(k_num_samples, k_host_sample_rate);
+    BufferF output(1, k_num_samples);
+    size_t const rendered = handler.render(input.get_array_of_read_pointers(),
+                                           k_num_samples,
+                                           output.get_array_of_write_pointers(),
+                                           k_num_samples);
+    ASSERT_EQ(rendered, k_num_samples);
+    // The filters ring briefly where the sine starts and where it is cut off
+    for (size_t i = k_hop_size; i < k_num_samples - k_hop_size; ++i) {
+        ASSERT_NEAR(output.get_sample(0, i), input.get_sample(0, i), 2e-3f) << "sample " << i;
+    }
+
+    // The real-time configuration is restored after rendering
+    EXPECT_EQ(handler.get_latency(), latency);
+}
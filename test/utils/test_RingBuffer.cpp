@@ -1,4 +1,5 @@
 #include <anira/utils/Buffer.h>
+#include <anira/utils/RealtimeLogger.h>
 #include <anira/utils/RingBuffer.h>
 
 #include <array>
@@ -14,10 +15,13 @@ protected:
     void SetUp() override {
         // Set up a 2-channel, 5-sample ring buffer for most tests
         m_ring_buffer.initialize_with_positions(2, 5);
+        // Every error message is checked, so none may be rate limited
+        RealtimeLogger::set_rate_limiting(false);
     }
 
     void TearDown() override {
         // Clean up after each test
+        RealtimeLogger::set_rate_limiting(true);
     }
 
     RingBuffer m_ring_buffer;
@@ -97,6 +101,8 @@ TEST_F(RingBufferTest, BufferOverflow) {
     // Push one more sample (should cause overflow)
     m_ring_buffer.push_sample(channel, 6.0f);
 
+    RealtimeLogger::flush();
+
     std::string const output = testing::internal::GetCapturedStderr();
     EXPECT_TRUE(output.find("Buffer overflow detected") != std::string::npos);
 
@@ -121,6 +127,8 @@ TEST_F(RingBufferTest, PopFromEmptyBuffer) {
 
     float const popped = m_ring_buffer.pop_sample(channel);
 
+    RealtimeLogger::flush();
+
     std::string const output = testing::internal::GetCapturedStderr();
     EXPECT_TRUE(output.find("Attempted to pop sample from empty buffer") != std::string::npos);
     EXPECT_FLOAT_EQ(popped, 0.0f);
@@ -153,6 +161,8 @@ TEST_F(RingBufferTest, GetSampleInvalidOffset) {
     // Try to get sample with offset beyond available samples
     float const sample = m_ring_buffer.get_future_sample(channel, 5);
 
+    RealtimeLogger::flush();
+
     std::string const output = testing::internal::GetCapturedStderr();
     EXPECT_TRUE(output.find("Attempted to get sample with offset") != std::string::npos);
     EXPECT_FLOAT_EQ(sample, 0.0f);
@@ -179,6 +189,8 @@ TEST_F(RingBufferTest, GetPastSample) {
     testing::internal::CaptureStderr();
     EXPECT_FLOAT_EQ(m_ring_buffer.get_past_sample(channel, 3), 0.0f);  // No sample available
 
+    RealtimeLogger::flush();
+
     std::string const output = testing::internal::GetCapturedStderr();
     EXPECT_TRUE(output.find("RingBuffer: Attempted to get past sample with offset") !=
                 std::string::npos);
@@ -273,11 +285,14 @@ TEST(RingBufferSingleSample, EdgeCases) {
 
     // Test overflow with single sample
     small_buffer.push_sample(channel, 1.0f);
+    RealtimeLogger::set_rate_limiting(false);
 
     testing::internal::CaptureStderr();
     small_buffer.push_sample(channel, 2.0f);  // Should overflow
+    RealtimeLogger::flush();
     std::string const output = testing::internal::GetCapturedStderr();
     EXPECT_TRUE(output.find("Buffer overflow detected") != std::string::npos);
+    RealtimeLogger::set_rate_limiting(true);
 
     // Should get the newer value
     EXPECT_FLOAT_EQ(small_buffer.pop_sample(channel), 2.0f);
@@ -297,6 +312,7 @@ TEST(RingBufferZeroSize, EdgeCase) {
     // Pushing to zero-sized buffer should be handled
     testing::internal::CaptureStderr();
     zero_buffer.push_sample(channel, 1.0f);
+    RealtimeLogger::flush();
     testing::internal::GetCapturedStderr();
     // May or may not produce an error, depends on implementation
 }
@@ -317,4 +333,91 @@ TEST_F(RingBufferTest, BufferInheritance) {
     EXPECT_NE(write_ptr, nullptr);
     EXPECT_NE(read_ptr, nullptr);
     EXPECT_EQ(write_ptr, read_ptr);  // Should point to same location
-}
\ No newline at end of file
+}
+
+// Test that windows hold the past samples followed by the popped ones
+TEST_F(RingBufferTest, PopWindow) {
+    const size_t channel = 0;
+
+    // Wraps around: 1 and 2 are read, 6 and 7 sit at the start of the buffer
+    for (int i = 1; i <= 5; ++i) { m_ring_buffer.push_sample(channel, static_cast<float>(i)); }
+    m_ring_buffer.pop_sample(channel);
+    m_ring_buffer.pop_sample(channel);
+    m_ring_buffer.push_sample(channel, 6.0f);
+    m_ring_buffer.push_sample(channel, 7.0f);
+    m_ring_buffer.pop_sample(channel);
+    m_ring_buffer.pop_sample(channel);
+
+    std::array<float, 4> window = {};
+    ASSERT_TRUE(m_ring_buffer.pop_window(channel, window.data(), 2, 2));
+    EXPECT_EQ(window, (std::array<float, 4>{3.0f, 4.0f, 5.0f, 6.0f}));
+    EXPECT_EQ(m_ring_buffer.get_available_samples(channel), 1);
+    EXPECT_FLOAT_EQ(m_ring_buffer.pop_sample(channel), 7.0f);
+
+    // Missing new samples return silence
+    testing::internal::CaptureStderr();
+    EXPECT_FALSE(m_ring_buffer.pop_window(channel, window.data(), 1, 1));
+    RealtimeLogger::flush();
+    std::string const output = testing::internal::GetCapturedStderr();
+    EXPECT_TRUE(output.find("RingBuffer: Cannot copy") != std::string::npos);
+    EXPECT_EQ(window[0], 0.0f);
+    EXPECT_EQ(window[1], 0.0f);
+}
+
+// Test that batched windows match popping and fetching past samples one at a time
+TEST_F(RingBufferTest, PopWindowsMatchesSampleAccess) {
+    constexpr size_t k_num_windows = 6;
+    constexpr size_t k_window_size = 9;
+    constexpr size_t k_hop_size = 2;
+    constexpr size_t k_num_new_samples = k_num_windows * k_hop_size;
+    constexpr size_t k_num_old_samples = k_window_size - k_hop_size;
+
+    RingBuffer ring_buffer;
+    ring_buffer.initialize_with_positions(1, 23);
+    float value = 0.f;
+    for (size_t block = 0; block < 10; ++block) {
+        for (size_t i = 0; i < k_num_new_samples; ++i) { ring_buffer.push_sample(0, value++); }
+
+        RingBuffer reference = ring_buffer;
+        std::array<float, k_num_windows * k_window_size> expected = {};
+        for (size_t window = 0; window < k_num_windows; ++window) {
+            float* destination = expected.data() + window * k_window_size;
+            for (size_t i = 0; i < k_hop_size; ++i) {
+                destination[k_num_old_samples + i] = reference.pop_sample(0);
+            }
+            for (size_t i = 0; i < k_num_old_samples; ++i) {
+                destination[i] = reference.get_past_sample(0, k_window_size - i);
+            }
+        }
+
+        std::array<float, k_num_windows * k_window_size> windows = {};
+        ASSERT_TRUE(ring_buffer.pop_windows(
+            0, windows.data(), k_num_windows, k_window_size, k_hop_size, k_window_size));
+        EXPECT_EQ(windows, expected) << "block " << block;
+        EXPECT_EQ(ring_buffer.get_available_samples(0), reference.get_available_samples(0));
+    }
+}
+
+// Test that missing past samples are silence while the new samples are still popped
+TEST_F(RingBufferTest, PopWindowsWithMissingPastSamples) {
+    RingBuffer ring_buffer;
+    ring_buffer.initialize_with_positions(1, 8);
+
+    // A full buffer has no past samples
+    for (int i = 1; i <= 8; ++i) { ring_buffer.push_sample(0, static_cast<float>(i)); }
+    std::array<float, 10> windows = {};
+    testing::internal::CaptureStderr();
+    EXPECT_FALSE(ring_buffer.pop_windows(0, windows.data(), 2, 5, 2, 5));
+    RealtimeLogger::flush();
+    std::string const output = testing::internal::GetCapturedStderr();
+    EXPECT_TRUE(output.find("past samples are available") != std::string::npos);
+    EXPECT_EQ(windows,
+              (std::array<float, 10>{0.0f, 0.0f, 0.0f, 1.0f, 2.0f, 0.0f, 1.0f, 2.0f, 3.0f, 4.0f}));
+    EXPECT_EQ(ring_buffer.get_available_samples(0), 4);
+
+    // Four past samples are available now, only the oldest of five is missing
+    std::array<float, 7> window = {};
+    EXPECT_FALSE(ring_buffer.pop_window(0, window.data(), 2, 5));
+    EXPECT_EQ(window, (std::array<float, 7>{0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f}));
+    EXPECT_EQ(ring_buffer.get_available_samples(0), 2);
+}
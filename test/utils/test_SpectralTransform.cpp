@@ -0,0 +1,254 @@
+#include <anira/ContextConfig.h>
+#include <anira/InferenceConfig.h>
+#include <anira/InferenceHandler.h>
+#include <anira/PrePostProcessor.h>
+#include <anira/backends/BackendBase.h>
+#include <anira/utils/Buffer.h>
+#include <anira/utils/FFT.h>
+#include <anira/utils/HostConfig.h>
+#include <anira/utils/InferenceBackend.h>
+#include <anira/utils/SpectralSpec.h>
+#include <anira/utils/SpectralTransform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../TestConfig.h"
+#include "gtest/gtest.h"
+
+using namespace anira;
+
+namespace {
+
+std::vector<float> make_noise(size_t num_samples, unsigned int seed) {
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    std::vector<float> noise(num_samples);
+    for (auto& sample : noise) { sample = distribution(generator); }
+    return noise;
+}
+
+float sine(size_t sample, double frequency, double sample_rate) {
+    return static_cast<float>(
+        0.5 * std::sin(2. * std::numbers::pi * frequency * static_cast<double>(sample) /
+                       sample_rate));
+}
+
+InferenceConfig make_complex_config(size_t fft_size, size_t hop_size, size_t num_samples) {
+    std::vector<ModelData> const model_data = make_placeholder_model_data();
+    auto const num_frames = static_cast<int64_t>(num_samples / hop_size);
+    auto const num_bins = static_cast<int64_t>(fft_size / 2 + 1);
+    std::vector<TensorShape> const tensor_shape = {
+        {{{1, num_frames, num_bins, 2}}, {{1, num_frames, num_bins, 2}}}};
+    ProcessingSpec processing_spec({1}, {1}, {num_samples}, {num_samples});
+    processing_spec.m_input_spectral_spec = {{COMPLEX_SPECTRUM, fft_size, hop_size}};
+    processing_spec.m_output_spectral_spec = {{COMPLEX_SPECTRUM, fft_size, hop_size}};
+    return InferenceConfig(model_data, tensor_shape, processing_spec, 5.f);
+}
+
+}  // namespace
+
+TEST(FFTTest, MatchesNaiveDft) {
+    for (size_t const size : {4, 8, 16, 64, 1024}) {
+        FFT fft;
+        fft.prepare(size);
+        ASSERT_EQ(fft.get_size(), size);
+        std::vector<float> const input = make_noise(size, static_cast<unsigned int>(size));
+        std::vector<float> real(size / 2 + 1);
+        std::vector<float> imag(size / 2 + 1);
+        fft.forward(input.data(), real.data(), imag.data());
+
+        float const tolerance = 1e-5f * static_cast<float>(size);
+        for (size_t k = 0; k <= size / 2; ++k) {
+            double expected_real = 0.;
+            double expected_imag = 0.;
+            for (size_t n = 0; n < size; ++n) {
+                double const angle = -2. * std::numbers::pi * static_cast<double>(k * n) /
+                                     static_cast<double>(size);
+                expected_real += input[n] * std::cos(angle);
+                expected_imag += input[n] * std::sin(angle);
+            }
+            ASSERT_NEAR(real[k], expected_real, tolerance) << "size " << size << " bin " << k;
+            ASSERT_NEAR(imag[k], expected_imag, tolerance) << "size " << size << " bin " << k;
+        }
+
+        std::vector<float> output(size);
+        fft.inverse(real.data(), imag.data(), output.data());
+        for (size_t n = 0; n < size; ++n) {
+            ASSERT_NEAR(output[n], input[n], 1e-5f) << "size " << size << " sample " << n;
+        }
+    }
+}
+
+TEST(FFTTest, RejectsInvalidSizes) {
+    FFT fft;
+    fft.prepare(48);
+    EXPECT_EQ(fft.get_size(), 0u);
+    fft.prepare(2);
+    EXPECT_EQ(fft.get_size(), 0u);
+}
+
+// The hop is a quarter of the frame and the frames overlap more than one inference, so the tail
+// carries the sum of several inferences
+TEST(SpectralTransformTest, ReconstructsStreamDelayedByOverlap) {
+    constexpr size_t k_fft_size = 512;
+    constexpr size_t k_hop_size = 128;
+    constexpr size_t k_num_samples = 256;
+    constexpr size_t k_num_channels = 2;
+    constexpr size_t k_num_inferences = 32;
+
+    SpectralTransform transform;
+    transform.prepare(
+        {COMPLEX_SPECTRUM, k_fft_size, k_hop_size}, k_num_channels, k_num_samples, 48000.f);
+    ASSERT_TRUE(transform.is_enabled());
+    size_t const overlap = transform.get_overlap();
+    size_t const span = k_num_samples + overlap;
+    EXPECT_EQ(overlap, k_fft_size - k_hop_size);
+    EXPECT_EQ(transform.get_num_frames(), 2u);
+    EXPECT_EQ(transform.get_signal_size(), k_num_channels * span);
+    EXPECT_EQ(transform.get_feature_size(), k_num_channels * 2 * (k_fft_size + 2));
+
+    std::vector<std::vector<float>> const input = {make_noise(k_num_inferences * k_num_samples, 1),
+                                                   make_noise(k_num_inferences * k_num_samples, 2)};
+    std::vector<float> signal(transform.get_signal_size());
+    std::vector<float> features(transform.get_feature_size());
+    std::vector<float> work(transform.get_work_size());
+    std::vector<float> tail(transform.get_tail_size(), 0.f);
+    for (size_t inference = 0; inference < k_num_inferences; ++inference) {
+        // The new samples are preceded by the overlap, zeros before the stream starts
+        for (size_t channel = 0; channel < k_num_channels; ++channel) {
+            for (size_t n = 0; n < span; ++n) {
+                size_t const position = inference * k_num_samples + n;
+                signal[channel * span + n] =
+                    position >= overlap ? input[channel][position - overlap] : 0.f;
+            }
+        }
+        transform.analyze(signal.data(), features.data(), work.data());
+        transform.synthesize(features.data(), signal.data(), work.data());
+        transform.overlap_add(signal.data(), tail.data());
+
+        for (size_t channel = 0; channel < k_num_channels; ++channel) {
+            for (size_t n = 0; n < k_num_samples; ++n) {
+                size_t const position = inference * k_num_samples + n;
+                float const expected = position >= overlap ? input[channel][position - overlap]
+                                                           : 0.f;
+                ASSERT_NEAR(signal[channel * k_num_samples + n], expected, 1e-4f)
+                    << "channel " << channel << " sample " << position;
+            }
+        }
+    }
+}
+
+TEST(SpectralTransformTest, FeaturesPeakAtSineFrequency) {
+    constexpr size_t k_fft_size = 512;
+    constexpr size_t k_num_mels = 40;
+    constexpr double k_sample_rate = 16000.;
+    // Exactly bin 32
+    constexpr double k_frequency = 1000.;
+
+    std::vector<float> signal(k_fft_size);
+    for (size_t n = 0; n < k_fft_size; ++n) { signal[n] = sine(n, k_frequency, k_sample_rate); }
+
+    SpectralTransform magnitude;
+    magnitude.prepare({MAGNITUDE_SPECTRUM, k_fft_size, k_fft_size}, 1, k_fft_size, 16000.f);
+    std::vector<float> spectrum(magnitude.get_feature_size());
+    std::vector<float> work(magnitude.get_work_size());
+    magnitude.analyze(signal.data(), spectrum.data(), work.data());
+    ASSERT_EQ(spectrum.size(), k_fft_size / 2 + 1);
+    EXPECT_EQ(std::max_element(spectrum.begin(), spectrum.end()) - spectrum.begin(), 32);
+    // The sine has the magnitude 0.5 * N / 2, which the Hann window halves
+    EXPECT_NEAR(spectrum[32], 0.25f * 0.5f * static_cast<float>(k_fft_size), 1e-2f);
+
+    SpectralTransform mel;
+    mel.prepare({LOG_MEL_SPECTRUM, k_fft_size, k_fft_size, k_num_mels}, 1, k_fft_size, 16000.f);
+    std::vector<float> bands(mel.get_feature_size());
+    mel.analyze(signal.data(), bands.data(), work.data());
+    ASSERT_EQ(bands.size(), k_num_mels);
+    auto const peak =
+        static_cast<size_t>(std::max_element(bands.begin(), bands.end()) - bands.begin());
+
+    // The band whose center on the HTK mel scale is closest to the sine
+    auto const to_mel = [](double frequency) { return 2595. * std::log10(1. + frequency / 700.); };
+    double const mel_step = to_mel(k_sample_rate / 2.) / static_cast<double>(k_num_mels + 1);
+    auto const expected_peak =
+        static_cast<size_t>(std::lround(to_mel(k_frequency) / mel_step)) - 1;
+    EXPECT_LE(std::max(peak, expected_peak) - std::min(peak, expected_peak), 1u);
+    // Bands far from the sine only see the leakage of the window
+    EXPECT_LT(bands[k_num_mels - 1], bands[peak] - 10.f);
+}
+
+TEST(SpectralTransformTest, ValidatesProcessingSpec) {
+    // Hops larger than half the frame leave gaps in the synthesis
+    EXPECT_THROW(make_complex_config(256, 256, 512), std::invalid_argument);
+    // The tensor shape does not match the frames
+    std::vector<ModelData> const model_data = make_placeholder_model_data();
+    std::vector<TensorShape> const tensor_shape = {{{{1, 512}}, {{1, 512}}}};
+    ProcessingSpec processing_spec({1}, {1}, {512}, {512});
+    processing_spec.m_input_spectral_spec = {{MAGNITUDE_SPECTRUM, 256, 128}};
+    EXPECT_THROW(InferenceConfig(model_data, tensor_shape, processing_spec, 5.f),
+                 std::invalid_argument);
+    // Non-power-of-two FFT sizes
+    processing_spec.m_input_spectral_spec = {{MAGNITUDE_SPECTRUM, 96, 32}};
+    EXPECT_THROW(InferenceConfig(model_data, tensor_shape, processing_spec, 5.f),
+                 std::invalid_argument);
+}
+
+// An identity model between the STFT and the iSTFT returns the input delayed by the latency
+TEST(SpectralTransformTest, ProcessesThroughIdentityModel) {
+    constexpr size_t k_fft_size = 256;
+    constexpr size_t k_hop_size = 64;
+    constexpr size_t k_num_samples = 256;
+    constexpr size_t k_buffer_size = 512;
+    constexpr size_t k_num_blocks = 32;
+
+    InferenceConfig config = make_complex_config(k_fft_size, k_hop_size, k_num_samples);
+    PrePostProcessor pp_processor(config);
+    BackendBase backend(config);
+    InferenceHandler handler(pp_processor, config, backend, ContextConfig(2));
+    handler.set_inference_backend(InferenceBackend::CUSTOM);
+    handler.prepare(HostConfig(k_buffer_size, 48000.f));
+    handler.set_non_realtime(true);
+
+    size_t const latency = handler.get_latency();
+    EXPECT_GE(latency, k_fft_size - k_hop_size);
+
+    std::vector<float> const input = make_noise(k_num_blocks * k_buffer_size, 3);
+    BufferF block(1, k_buffer_size);
+    for (size_t b = 0; b < k_num_blocks; ++b) {
+        std::copy_n(input.data() + b * k_buffer_size, k_buffer_size, block.get_write_pointer(0));
+        ASSERT_EQ(handler.process(block.get_array_of_write_pointers(), k_buffer_size),
+                  k_buffer_size);
+        for (size_t i = 0; i < k_buffer_size; ++i) {
+            size_t const n = b * k_buffer_size + i;
+            float const expected = n >= latency ? input[n - latency] : 0.f;
+            ASSERT_NEAR(block.get_sample(0, i), expected, 1e-4f) << "sample " << n;
+        }
+    }
+}
+
+TEST(SpectralTransformTest, RendersThroughIdentityModel) {
+    constexpr size_t k_num_samples = 10000;
+
+    InferenceConfig config = make_complex_config(512, 128, 512);
+    PrePostProcessor pp_processor(config);
+    BackendBase backend(config);
+    InferenceHandler handler(pp_processor, config, backend, ContextConfig(2));
+    handler.set_inference_backend(InferenceBackend::CUSTOM);
+    handler.prepare(HostConfig(256, 44100.f));
+
+    std::vector<float> const input = make_noise(k_num_samples, 4);
+    BufferF output(1, k_num_samples);
+    const float* input_pointer = input.data();
+    size_t const rendered = handler.render(
+        &input_pointer, k_num_samples, output.get_array_of_write_pointers(), k_num_samples);
+    ASSERT_EQ(rendered, k_num_samples);
+    for (size_t i = 0; i < k_num_samples; ++i) {
+        ASSERT_NEAR(output.get_sample(0, i), input[i], 1e-4f) << "sample " << i;
+    }
+}
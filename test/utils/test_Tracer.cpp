@@ -0,0 +1,122 @@
+#include <anira/utils/Tracer.h>
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <latch>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace anira;
+
+#ifdef ENABLE_TRACING
+
+// Events recorded on several threads must all end up in a valid Chrome trace file with their
+// session and sequence tags.
+TEST(TracerTest, WritesChromeTraceJson) {
+    constexpr size_t k_num_threads = 4;
+    constexpr long k_events_per_thread = 100;
+
+    std::string const path =
+        (std::filesystem::temp_directory_path() / "anira_tracer_test.json").string();
+    ASSERT_TRUE(Tracer::start(path));
+    EXPECT_FALSE(Tracer::start(path));
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < k_num_threads; ++t) {
+        threads.emplace_back([t] {
+            for (long i = 0; i < k_events_per_thread; ++i) {
+                ANIRA_TRACE_SCOPE("scope", static_cast<int>(t), i);
+                ANIRA_TRACE_INSTANT("instant", static_cast<int>(t), i);
+            }
+        });
+    }
+    for (auto& thread : threads) { thread.join(); }
+    Tracer::stop();
+    EXPECT_EQ(Tracer::get_dropped_events(), 0u);
+
+    std::ifstream file(path);
+    nlohmann::json const trace = nlohmann::json::parse(file);
+    ASSERT_TRUE(trace.contains("traceEvents"));
+    auto const& events = trace["traceEvents"];
+    ASSERT_EQ(events.size(), k_num_threads * k_events_per_thread * 2);
+
+    std::vector<long> scopes_per_session(k_num_threads, 0);
+    for (const auto& event : events) {
+        if (event["name"] == "scope") {
+            EXPECT_EQ(event["ph"], "X");
+            EXPECT_GE(event["dur"].get<double>(), 0.);
+            scopes_per_session[event["args"]["session"].get<size_t>()]++;
+        } else {
+            EXPECT_EQ(event["name"], "instant");
+            EXPECT_EQ(event["ph"], "i");
+        }
+        EXPECT_LT(event["args"]["seq"].get<long>(), k_events_per_thread);
+    }
+    for (long const count : scopes_per_session) { EXPECT_EQ(count, k_events_per_thread); }
+
+    std::filesystem::remove(path);
+}
+
+// A thread that found all buffers claimed must record once another thread released its buffer.
+TEST(TracerTest, ClaimsBufferReleasedByAnotherThread) {
+    std::string const path =
+        (std::filesystem::temp_directory_path() / "anira_tracer_claim_test.json").string();
+    ASSERT_TRUE(Tracer::start(path));
+
+    std::latch buffers_claimed(Tracer::k_max_threads);
+    std::latch release_buffers(1);
+    std::vector<std::thread> holders;
+    for (size_t t = 0; t < Tracer::k_max_threads; ++t) {
+        holders.emplace_back([&] {
+            ANIRA_TRACE_INSTANT("holder", 0, 0);
+            buffers_claimed.count_down();
+            release_buffers.wait();
+        });
+    }
+    buffers_claimed.wait();
+
+    std::latch first_recorded(1);
+    std::latch buffers_released(1);
+    std::thread late([&] {
+        ANIRA_TRACE_INSTANT("dropped", 1, 0);
+        first_recorded.count_down();
+        buffers_released.wait();
+        ANIRA_TRACE_INSTANT("late", 1, 1);
+    });
+    first_recorded.wait();
+    uint64_t const dropped_events = Tracer::get_dropped_events();
+    EXPECT_GE(dropped_events, 1u);
+
+    release_buffers.count_down();
+    for (auto& holder : holders) { holder.join(); }
+    buffers_released.count_down();
+    late.join();
+    Tracer::stop();
+    EXPECT_EQ(Tracer::get_dropped_events(), dropped_events);
+
+    std::ifstream file(path);
+    nlohmann::json const trace = nlohmann::json::parse(file);
+    size_t num_late_events = 0;
+    for (const auto& event : trace["traceEvents"]) {
+        EXPECT_NE(event["name"], "dropped");
+        if (event["name"] == "late") { ++num_late_events; }
+    }
+    EXPECT_EQ(num_late_events, 1u);
+
+    std::filesystem::remove(path);
+}
+
+#else
+
+TEST(TracerTest, StartFailsWhenNotCompiledIn) {
+    EXPECT_FALSE(Tracer::start("anira_tracer_test.json"));
+    EXPECT_FALSE(Tracer::is_running());
+}
+
+#endif
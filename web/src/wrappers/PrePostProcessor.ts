@@ -132,6 +132,24 @@ export class PrePostProcessor extends BaseWrapper {
     )
   }
 
+  /** Mirrors :cpp:func:`anira::PrePostProcessor::pop_windows_from_buffer`. */
+  popWindowsFromBuffer(
+    ringBuffer: PossiblePointer<RingBuffer>,
+    buffer: PossiblePointer<BufferF>,
+    numWindows: number,
+    windowSize: number,
+    hopSize: number
+  ): void {
+    this.wasmInstance._prepostprocessor_pop_windows_from_buffer(
+      this.ptr,
+      resolvePtr(ringBuffer),
+      resolvePtr(buffer),
+      numWindows,
+      windowSize,
+      hopSize
+    )
+  }
+
   /** Mirrors :cpp:func:`anira::PrePostProcessor::push_samples_to_buffer`. */
   pushSamplesToBuffer(
     buffer: PossiblePointer<BufferF>,
@@ -145,6 +145,11 @@ export class ProcessingSpec extends BaseWrapper {
     )
   }
 
+  /** Mirrors the :cpp:member:`anira::ProcessingSpec::m_model_sample_rate` field. */
+  getModelSampleRate(): number {
+    return this.wasmInstance._processingspec_get_model_sample_rate(this.ptr)
+  }
+
   /** Mirrors the :cpp:member:`anira::ProcessingSpec::m_tensor_input_size` field. */
   getTensorInputSize(tensorIndex: number = 0): number {
     return this.wasmInstance._processingspec_get_tensor_input_size(this.ptr, tensorIndex)